@@ -2,32 +2,76 @@
 
 #include "EngineClasses/Components/ActorInterestComponent.h"
 
+#include "EngineClasses/SpatialNetDriver.h"
 #include "Schema/Interest.h"
 #include "Interop/SpatialClassInfoManager.h"
+#include "Utils/InterestFactory.h"
 
-void UActorInterestComponent::PopulateFrequencyToConstraintsMap(const USpatialClassInfoManager& ClassInfoManager, SpatialGDK::FrequencyToConstraintsMap& OutFrequencyToQueryConstraints) const
+#include "GameFramework/Actor.h"
+
+void UActorInterestComponent::InvalidateCompiledConstraints()
+{
+	CompiledFrequencyToConstraints.Reset();
+	NotifyInterestFactory();
+}
+
+void UActorInterestComponent::OnRegister()
 {
-	// Loop through the user specified queries to extract the constraints and frequencies.
-	// We don't construct the actual query at this point because the interest factory enforces the result types.
-	for (const auto& QueryData : Queries)
+	Super::OnRegister();
+
+	// An Actor gaining the component at runtime changes its interest.
+	NotifyInterestFactory();
+}
+
+void UActorInterestComponent::OnUnregister()
+{
+	NotifyInterestFactory();
+
+	Super::OnUnregister();
+}
+
+void UActorInterestComponent::NotifyInterestFactory() const
+{
+	const AActor* Owner = GetOwner();
+	if (Owner == nullptr)
 	{
-		if (!QueryData.Constraint)
-		{
-			continue;
-		}
+		return;
+	}
+
+	USpatialNetDriver* NetDriver = Cast<USpatialNetDriver>(Owner->GetNetDriver());
+	if (NetDriver != nullptr && NetDriver->InterestFactory.IsValid())
+	{
+		NetDriver->InterestFactory->OnUserDefinedInterestChanged(Owner);
+	}
+}
 
-		SpatialGDK::QueryConstraint NewQueryConstraint{};
-		QueryData.Constraint->CreateConstraint(ClassInfoManager, NewQueryConstraint);
+void UActorInterestComponent::PopulateFrequencyToConstraintsMap(const USpatialClassInfoManager& ClassInfoManager, SpatialGDK::FrequencyToConstraintsMap& OutFrequencyToQueryConstraints)
+{
+	if (!CompiledFrequencyToConstraints.IsSet())
+	{
+		CompiledFrequencyToConstraints.Emplace();
+		SpatialGDK::FrequencyToConstraintsMap& FrequencyToConstraints = CompiledFrequencyToConstraints.GetValue();
 
-		// If there is already a query defined with this frequency, group them to avoid making too many queries down the line.
-		// This avoids any extra cost due to duplicate result types across the network if they are large.
-		if (OutFrequencyToQueryConstraints.Find(QueryData.Frequency))
+		// Loop through the user specified queries to extract the constraints and frequencies.
+		// We don't construct the actual query at this point because the interest factory enforces the result types.
+		for (const auto& QueryData : Queries)
 		{
-			OutFrequencyToQueryConstraints.Find(QueryData.Frequency)->Add(NewQueryConstraint);
-			continue;
+			if (!QueryData.Constraint)
+			{
+				continue;
+			}
+
+			SpatialGDK::QueryConstraint NewQueryConstraint{};
+			QueryData.Constraint->CreateConstraint(ClassInfoManager, NewQueryConstraint);
+
+			FrequencyToConstraints.FindOrAdd(QueryData.Frequency).Add(MoveTemp(NewQueryConstraint));
 		}
+	}
 
-		TArray<SpatialGDK::QueryConstraint> ConstraintList = { NewQueryConstraint };
-		OutFrequencyToQueryConstraints.Add(QueryData.Frequency, ConstraintList);
+	// If there is already a query defined with this frequency, group them to avoid making too many queries down the line.
+	// This avoids any extra cost due to duplicate result types across the network if they are large.
+	for (const auto& FrequencyConstraintsPair : CompiledFrequencyToConstraints.GetValue())
+	{
+		OutFrequencyToQueryConstraints.FindOrAdd(FrequencyConstraintsPair.Key).Append(FrequencyConstraintsPair.Value);
 	}
 }
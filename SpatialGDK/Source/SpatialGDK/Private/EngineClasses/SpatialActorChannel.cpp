@@ -18,6 +18,7 @@
 #include "EngineClasses/SpatialNetConnection.h"
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
+#include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "Interop/GlobalStateManager.h"
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialSender.h"
@@ -201,6 +202,8 @@ USpatialActorChannel::USpatialActorChannel(const FObjectInitializer& ObjectIniti
 	, NetDriver(nullptr)
 	, LastPositionSinceUpdate(FVector::ZeroVector)
 	, TimeWhenPositionLastUpdated(0.0f)
+	, TimeWhenAuthorityGained(-1.0f)
+	, PrefetchedAuthorityIntent(SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
 {
 }
 
@@ -218,6 +221,8 @@ void USpatialActorChannel::Init(UNetConnection* InConnection, int32 ChannelIndex
 	bIsAuthServer = false;
 	LastPositionSinceUpdate = FVector::ZeroVector;
 	TimeWhenPositionLastUpdated = 0.0f;
+	TimeWhenAuthorityGained = -1.0f;
+	PrefetchedAuthorityIntent = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
 
 	PendingDynamicSubobjects.Empty();
 	SavedConnectionOwningWorkerId.Empty();
@@ -234,6 +239,51 @@ void USpatialActorChannel::Init(UNetConnection* InConnection, int32 ChannelIndex
 	Receiver = NetDriver->Receiver;
 }
 
+void USpatialActorChannel::SetServerAuthority(const bool IsAuth)
+{
+	if (IsAuth && !bIsAuthServer)
+	{
+		TimeWhenAuthorityGained = NetDriver->Time;
+	}
+
+	if (IsAuth != bIsAuthServer)
+	{
+		// A prefetched handover is only counted as a migration once authority has actually moved, since the intent can
+		// still be taken back before then.
+		if (!IsAuth && PrefetchedAuthorityIntent != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+		{
+			NetDriver->TrackAuthorityMigration(PrefetchedAuthorityIntent);
+		}
+
+		PrefetchedAuthorityIntent = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	bIsAuthServer = IsAuth;
+}
+
+void USpatialActorChannel::PrefetchHandover(const FClassInfo& Info, VirtualWorkerId PredictedVirtualWorkerId)
+{
+	// Send the complete handover state, so that the new worker is up to date even if it only recently gained interest in
+	// the Actor. Later changes reach it through the usual handover updates until authority moves.
+	if (ActorHandoverShadowData != nullptr)
+	{
+		FHandoverChangeState HandoverChangeState = CreateInitialHandoverChangeState(Info);
+		Sender->SendComponentUpdates(Actor, Info, this, nullptr, &HandoverChangeState, ReplicationBytesWritten);
+	}
+
+	for (auto& SubobjectInfoPair : GetHandoverSubobjects())
+	{
+		FHandoverChangeState SubobjectHandoverChangeState = CreateInitialHandoverChangeState(*SubobjectInfoPair.Value);
+		Sender->SendComponentUpdates(SubobjectInfoPair.Key, *SubobjectInfoPair.Value, this, nullptr, &SubobjectHandoverChangeState, ReplicationBytesWritten);
+	}
+
+	// Unlike a regular migration, this worker keeps its role and simulates the Actor until the EntityACL moves. Workers
+	// are always checked out on the entities they are authoritative over, so the new worker also has the Actor before
+	// it reaches its area.
+	Sender->SendAuthorityIntentUpdate(*Actor, PredictedVirtualWorkerId);
+	PrefetchedAuthorityIntent = PredictedVirtualWorkerId;
+}
+
 void USpatialActorChannel::DeleteEntityIfAuthoritative()
 {
 	if (NetDriver->Connection == nullptr)
@@ -720,22 +770,57 @@ int64 USpatialActorChannel::ReplicateActor()
 	if (SpatialGDKSettings->bEnableUnrealLoadBalancer &&
 		NetDriver->StaticComponentView->HasAuthority(EntityId, SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID))
 	{
-		if (!NetDriver->LoadBalanceStrategy->ShouldHaveAuthority(*Actor) && !NetDriver->LockingPolicy->IsLocked(Actor))
-		{		
-			const VirtualWorkerId NewAuthVirtualWorkerId = NetDriver->LoadBalanceStrategy->WhoShouldHaveAuthority(*Actor);
-			if (NewAuthVirtualWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
-			{
-				Sender->SendAuthorityIntentUpdate(*Actor, NewAuthVirtualWorkerId);
+		// Keep Actors that only just arrived, so that an Actor moving along a boundary doesn't pay for a handover every few frames.
+		const bool bHasDwelled = TimeWhenAuthorityGained < 0.0f || NetDriver->Time - TimeWhenAuthorityGained >= SpatialGDKSettings->MinimumAuthorityDwellTime;
 
-				// If we're setting a different authority intent, preemptively changed to ROLE_SimulatedProxy 
-				Actor->Role = ROLE_SimulatedProxy;
-				Actor->RemoteRole = ROLE_Authority;
+		if (bHasDwelled && !NetDriver->LockingPolicy->IsLocked(Actor))
+		{
+			const VirtualWorkerId LocalVirtualWorkerId = NetDriver->VirtualWorkerTranslator->GetLocalVirtualWorkerId();
+
+			// With handover prefetch, the worker expected to own the Actor soon, or the local worker if it is expected to stay.
+			const VirtualWorkerId PredictedVirtualWorkerId = SpatialGDKSettings->HandoverPrefetchTime > 0.0f
+				? NetDriver->LoadBalanceStrategy->PredictAuthority(*Actor, SpatialGDKSettings->HandoverPrefetchTime)
+				: SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
 
-				Actor->OnAuthorityLost();
+			if (!NetDriver->LoadBalanceStrategy->ShouldRelinquishAuthority(*Actor))
+			{
+				if (PredictedVirtualWorkerId != SpatialConstants::INVALID_VIRTUAL_WORKER_ID && PredictedVirtualWorkerId != LocalVirtualWorkerId)
+				{
+					if (PredictedVirtualWorkerId != PrefetchedAuthorityIntent)
+					{
+						PrefetchHandover(Info, PredictedVirtualWorkerId);
+					}
+				}
+				else if (PrefetchedAuthorityIntent != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+				{
+					// The Actor turned back before authority moved, so take the intent back.
+					Sender->SendAuthorityIntentUpdate(*Actor, LocalVirtualWorkerId);
+					PrefetchedAuthorityIntent = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+				}
 			}
-			else
+			// Keep Actors heading back into this worker's area, such as ones that arrived through a prefetched handover
+			// before crossing the boundary.
+			else if (PredictedVirtualWorkerId != LocalVirtualWorkerId)
 			{
-				UE_LOG(LogSpatialActorChannel, Error, TEXT("Load Balancing Strategy returned invalid virtual worker for actor %s"), *Actor->GetName());
+				const VirtualWorkerId NewAuthVirtualWorkerId = NetDriver->LoadBalanceStrategy->WhoShouldHaveAuthority(*Actor);
+				if (NewAuthVirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+				{
+					UE_LOG(LogSpatialActorChannel, Error, TEXT("Load Balancing Strategy returned invalid virtual worker for actor %s"), *Actor->GetName());
+				}
+				// If the intent was already sent when the migration was predicted, this worker keeps simulating the Actor
+				// until the EntityACL moves, and the receiver updates its role then.
+				else if (NewAuthVirtualWorkerId != PrefetchedAuthorityIntent)
+				{
+					Sender->SendAuthorityIntentUpdate(*Actor, NewAuthVirtualWorkerId);
+
+					NetDriver->TrackAuthorityMigration(NewAuthVirtualWorkerId);
+
+					// If we're setting a different authority intent, preemptively changed to ROLE_SimulatedProxy 
+					Actor->Role = ROLE_SimulatedProxy;
+					Actor->RemoteRole = ROLE_Authority;
+
+					Actor->OnAuthorityLost();
+				}
 			}
 		}
 
@@ -1339,7 +1424,7 @@ void USpatialActorChannel::ServerProcessOwnershipChange()
 	Worker_ComponentId NewInterestBucketComponentId = NetDriver->ClassInfoManager->ComputeActorInterestComponentId(Actor);
 	if (SavedInterestBucketComponentID != NewInterestBucketComponentId)
 	{
-		Sender->SendInterestBucketComponentChange(EntityId, SavedInterestBucketComponentID, NewInterestBucketComponentId);
+		Sender->QueueInterestBucketComponentChange(EntityId, SavedInterestBucketComponentID, NewInterestBucketComponentId);
 
 		SavedInterestBucketComponentID = NewInterestBucketComponentId;
 
@@ -17,6 +17,8 @@ SpatialLoadBalanceEnforcer::SpatialLoadBalanceEnforcer(const PhysicalWorkerName&
 	: WorkerId(InWorkerId)
 	, StaticComponentView(InStaticComponentView)
 	, VirtualWorkerTranslator(InVirtualWorkerTranslator)
+	, NextAclAssignmentRequestSequence(0)
+	, MaxAclAssignmentsPerTick(GetDefault<USpatialGDKSettings>()->MaxAclAssignmentsPerTick)
 {
 	check(InStaticComponentView != nullptr);
 	check(InVirtualWorkerTranslator != nullptr);
@@ -40,22 +42,29 @@ void SpatialLoadBalanceEnforcer::OnLoadBalancingComponentRemoved(const Worker_Re
 {
 	check(HandlesComponent(Op.component_id));
 
+	if (Op.component_id == SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID || Op.component_id == SpatialConstants::ENTITY_ACL_COMPONENT_ID)
+	{
+		RemoveEnforcedIntent(Op.entity_id);
+	}
+
 	if (AclAssignmentRequestIsQueued(Op.entity_id))
 	{
 		UE_LOG(LogSpatialLoadBalanceEnforcer, Log,
 			TEXT("Component %d for entity %lld removed. Can no longer enforce the previous request for this entity."),
 			Op.component_id, Op.entity_id);
-		AclWriteAuthAssignmentRequests.Remove(Op.entity_id);
+		DropAclAssignmentRequest(Op.entity_id);
 	}
 }
 
 void SpatialLoadBalanceEnforcer::OnEntityRemoved(const Worker_RemoveEntityOp& Op)
 {
+	RemoveEnforcedIntent(Op.entity_id);
+
 	if (AclAssignmentRequestIsQueued(Op.entity_id))
 	{
 		UE_LOG(LogSpatialLoadBalanceEnforcer, Log, TEXT("Entity %lld removed. Can no longer enforce the previous request for this entity."),
 			Op.entity_id);
-		AclWriteAuthAssignmentRequests.Remove(Op.entity_id);
+		DropAclAssignmentRequest(Op.entity_id);
 	}
 }
 
@@ -66,12 +75,14 @@ void SpatialLoadBalanceEnforcer::OnAclAuthorityChanged(const Worker_AuthorityCha
 
 	if (AuthOp.authority != WORKER_AUTHORITY_AUTHORITATIVE)
 	{
+		RemoveEnforcedIntent(AuthOp.entity_id);
+
 		if (AclAssignmentRequestIsQueued(AuthOp.entity_id))
 		{
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Log,
 				TEXT("ACL authority lost for entity %lld. Can no longer enforce the previous request for this entity."),
 				AuthOp.entity_id);
-			AclWriteAuthAssignmentRequests.Remove(AuthOp.entity_id);
+			DropAclAssignmentRequest(AuthOp.entity_id);
 		}
 		return;
 	}
@@ -79,6 +90,34 @@ void SpatialLoadBalanceEnforcer::OnAclAuthorityChanged(const Worker_AuthorityCha
 	MaybeQueueAclAssignmentRequest(AuthOp.entity_id);
 }
 
+void SpatialLoadBalanceEnforcer::OnVirtualWorkerMappingChanged(const TArray<VirtualWorkerId>& ChangedVirtualWorkerIds)
+{
+	for (const VirtualWorkerId ChangedVirtualWorkerId : ChangedVirtualWorkerIds)
+	{
+		const TSet<Worker_EntityId_Key>* EntityIds = EnforcedEntitiesByIntent.Find(ChangedVirtualWorkerId);
+		if (EntityIds == nullptr)
+		{
+			continue;
+		}
+
+		// Entities can't be assigned to a virtual worker without a physical worker. They are re-evaluated once it is mapped again.
+		if (VirtualWorkerTranslator->GetPhysicalWorkerForVirtualWorker(ChangedVirtualWorkerId) == nullptr)
+		{
+			UE_LOG(LogSpatialLoadBalanceEnforcer, Warning, TEXT("Virtual worker %d is not mapped to a physical worker, not re-evaluating %d entities."), ChangedVirtualWorkerId, EntityIds->Num());
+			continue;
+		}
+
+		UE_LOG(LogSpatialLoadBalanceEnforcer, Log, TEXT("Mapping for virtual worker %d changed, re-evaluating %d entities."), ChangedVirtualWorkerId, EntityIds->Num());
+
+		// Queueing can update the index, so iterate over a copy.
+		const TArray<Worker_EntityId_Key> EntityIdsToEvaluate = EntityIds->Array();
+		for (const Worker_EntityId EntityId : EntityIdsToEvaluate)
+		{
+			MaybeQueueAclAssignmentRequest(EntityId);
+		}
+	}
+}
+
 // MaybeQueueAclAssignmentRequest is called from three places.
 // 1) AuthorityIntent change - Intent is not authoritative on this worker - ACL is authoritative on this worker.
 //    (another worker changed the intent, but this worker is responsible for the ACL, so update it.)
@@ -96,6 +135,8 @@ void SpatialLoadBalanceEnforcer::MaybeQueueAclAssignmentRequest(const Worker_Ent
 	}
 
 	const SpatialGDK::AuthorityIntent* AuthorityIntentComponent = StaticComponentView->GetComponentData<SpatialGDK::AuthorityIntent>(EntityId);
+	SetEnforcedIntent(EntityId, AuthorityIntentComponent->VirtualWorkerId);
+
 	const PhysicalWorkerName* OwningWorkerId = VirtualWorkerTranslator->GetPhysicalWorkerForVirtualWorker(AuthorityIntentComponent->VirtualWorkerId);
 
 	check(OwningWorkerId != nullptr);
@@ -125,49 +166,68 @@ void SpatialLoadBalanceEnforcer::MaybeQueueAclAssignmentRequest(const Worker_Ent
 
 bool SpatialLoadBalanceEnforcer::AclAssignmentRequestIsQueued(const Worker_EntityId EntityId) const
 {
-	return AclWriteAuthAssignmentRequests.Contains(EntityId);
+	return QueuedAclAssignmentRequests.Contains(EntityId);
 }
 
 TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceEnforcer::ProcessQueuedAclAssignmentRequests()
 {
 	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> PendingRequests;
 
-	TArray<Worker_EntityId> CompletedRequests;
-	CompletedRequests.Reserve(AclWriteAuthAssignmentRequests.Num());
+	// Requests that can't be processed yet, but should be retried next time.
+	TArray<Worker_EntityId> RetryRequests;
 
-	for (Worker_EntityId EntityId : AclWriteAuthAssignmentRequests)
+	int32 NumVisited = 0;
+	for (; NumVisited < AclWriteAuthAssignmentRequests.Num(); NumVisited++)
 	{
-		const SpatialGDK::AuthorityIntent* AuthorityIntentComponent = StaticComponentView->GetComponentData<SpatialGDK::AuthorityIntent>(EntityId);
+		// When a lot of entities change authority at once, such as when a worker joins or leaves, spread the ACL updates
+		// over several ticks instead of stalling this one.
+		if (MaxAclAssignmentsPerTick > 0 && PendingRequests.Num() >= MaxAclAssignmentsPerTick)
+		{
+			break;
+		}
+
+		const Worker_EntityId EntityId = AclWriteAuthAssignmentRequests[NumVisited].EntityId;
+		const uint64* LiveSequence = QueuedAclAssignmentRequests.Find(EntityId);
+		if (LiveSequence == nullptr || *LiveSequence != AclWriteAuthAssignmentRequests[NumVisited].Sequence)
+		{
+			// The request was dropped, or this is an older entry for an entity that was queued again.
+			continue;
+		}
+
+		// Look the entity up once and read every component the request needs from it.
+		const USpatialStaticComponentView::ComponentStorage* Components = StaticComponentView->GetEntityComponents(EntityId);
+
+		const SpatialGDK::AuthorityIntent* AuthorityIntentComponent = Components != nullptr ? USpatialStaticComponentView::FindComponentData<SpatialGDK::AuthorityIntent>(*Components) : nullptr;
 		if (AuthorityIntentComponent == nullptr)
 		{
 			// This happens if the authority intent component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as AuthIntent component has been removed since the request was queued. EntityId: %lld"), EntityId);
-			CompletedRequests.Add(EntityId);
+			QueuedAclAssignmentRequests.Remove(EntityId);
 			continue;
 		}
 
-		const SpatialGDK::NetOwningClientWorker* NetOwningClientWorkerComponent = StaticComponentView->GetComponentData<SpatialGDK::NetOwningClientWorker>(EntityId);
+		const SpatialGDK::NetOwningClientWorker* NetOwningClientWorkerComponent = USpatialStaticComponentView::FindComponentData<SpatialGDK::NetOwningClientWorker>(*Components);
 		if (NetOwningClientWorkerComponent == nullptr)
 		{
 			// This happens if the NetOwningClientWorker component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as NetOwningClientWorker component has been removed since the request was queued. EntityId: %lld"), EntityId);
-			CompletedRequests.Add(EntityId);
+			QueuedAclAssignmentRequests.Remove(EntityId);
 			continue;
 		}
 
-		const SpatialGDK::ComponentPresence* ComponentPresenceComponent = StaticComponentView->GetComponentData<SpatialGDK::ComponentPresence>(EntityId);
+		const SpatialGDK::ComponentPresence* ComponentPresenceComponent = USpatialStaticComponentView::FindComponentData<SpatialGDK::ComponentPresence>(*Components);
 		if (ComponentPresenceComponent == nullptr)
 		{
 			// This happens if the ComponentPresence component is removed in the same tick as a request is queued, but the request was not removed from the queue - shouldn't happen.
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("Cannot process entity as ComponentPresence component has been removed since the request was queued. EntityId: %lld"), EntityId);
-			CompletedRequests.Add(EntityId);
+			QueuedAclAssignmentRequests.Remove(EntityId);
 			continue;
 		}
 
 		if (AuthorityIntentComponent->VirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
 		{
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Warning, TEXT("Entity with invalid virtual worker ID assignment will not be processed. EntityId: %lld. This should not happen - investigate if you see this warning."), EntityId);
-			CompletedRequests.Add(EntityId);
+			QueuedAclAssignmentRequests.Remove(EntityId);
 			continue;
 		}
 
@@ -176,20 +236,23 @@ TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceE
 		if (DestinationWorkerId == nullptr)
 		{
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Error, TEXT("This worker is not assigned a virtual worker. This shouldn't happen! Worker: %s"), *WorkerId);
+			RetryRequests.Add(EntityId);
 			continue;
 		}
 
-		if (!StaticComponentView->HasAuthority(EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID))
+		const USpatialStaticComponentView::ComponentAuthority* Authority = StaticComponentView->GetEntityAuthority(EntityId);
+		const Worker_Authority* AclAuthority = Authority != nullptr ? Authority->Find(SpatialConstants::ENTITY_ACL_COMPONENT_ID) : nullptr;
+		if (AclAuthority == nullptr || *AclAuthority != WORKER_AUTHORITY_AUTHORITATIVE)
 		{
 			UE_LOG(LogSpatialLoadBalanceEnforcer, Log, TEXT("Failed to update the EntityACL to match the authority intent; this worker lost authority over the EntityACL since the request was queued."
 				" Source worker ID: %s. Entity ID %lld. Desination worker ID: %s."), *WorkerId, EntityId, **DestinationWorkerId);
-			CompletedRequests.Add(EntityId);
+			QueuedAclAssignmentRequests.Remove(EntityId);
 			continue;
 		}
 
 		TArray<Worker_ComponentId> ComponentIds;
 
-		EntityAcl* Acl = StaticComponentView->GetComponentData<EntityAcl>(EntityId);
+		const EntityAcl* Acl = USpatialStaticComponentView::FindComponentData<EntityAcl>(*Components);
 		Acl->ComponentWriteAcl.GetKeys(ComponentIds);
 
 		// Ensure that every component ID in ComponentPresence is set in the write ACL.
@@ -212,18 +275,82 @@ TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SpatialLoadBalanceE
 				ComponentIds
 			});
 
-		CompletedRequests.Add(EntityId);
+		QueuedAclAssignmentRequests.Remove(EntityId);
+	}
+
+	// Anything not visited because of the cap stays at the front of the queue for the next tick.
+	AclWriteAuthAssignmentRequests.RemoveAt(0, NumVisited, /* bAllowShrinking */ false);
+	for (const Worker_EntityId EntityId : RetryRequests)
+	{
+		AddAclAssignmentRequestEntry(EntityId);
 	}
 
-	AclWriteAuthAssignmentRequests.RemoveAll([CompletedRequests](const Worker_EntityId& EntityId) { return CompletedRequests.Contains(EntityId); });
+	if (NumVisited > 0 && AclWriteAuthAssignmentRequests.Num() > 0)
+	{
+		UE_LOG(LogSpatialLoadBalanceEnforcer, Verbose, TEXT("Processed %d ACL assignment requests, %d carried over to the next tick."),
+			PendingRequests.Num(), QueuedAclAssignmentRequests.Num());
+	}
 
 	return PendingRequests;
 }
 
 void SpatialLoadBalanceEnforcer::QueueAclAssignmentRequest(const Worker_EntityId EntityId)
 {
+	// A request that is still queued keeps its place, since it reads the entity's components when it is processed.
+	if (QueuedAclAssignmentRequests.Contains(EntityId))
+	{
+		return;
+	}
+
 	UE_LOG(LogSpatialLoadBalanceEnforcer, Verbose, TEXT("Queueing ACL assignment request for entity %lld on worker %s."), EntityId, *WorkerId);
-	AclWriteAuthAssignmentRequests.Add(EntityId);
+	AddAclAssignmentRequestEntry(EntityId);
+}
+
+void SpatialLoadBalanceEnforcer::AddAclAssignmentRequestEntry(const Worker_EntityId EntityId)
+{
+	// Any older entry for the entity, left behind by a dropped request, is now stale and skipped when processing.
+	const uint64 Sequence = NextAclAssignmentRequestSequence++;
+	AclWriteAuthAssignmentRequests.Add(QueuedAclAssignmentRequest{ EntityId, Sequence });
+	QueuedAclAssignmentRequests.Add(EntityId, Sequence);
+}
+
+void SpatialLoadBalanceEnforcer::DropAclAssignmentRequest(const Worker_EntityId EntityId)
+{
+	QueuedAclAssignmentRequests.Remove(EntityId);
+
+	if (QueuedAclAssignmentRequests.Num() == 0)
+	{
+		AclWriteAuthAssignmentRequests.Reset();
+	}
+}
+
+void SpatialLoadBalanceEnforcer::SetEnforcedIntent(const Worker_EntityId EntityId, VirtualWorkerId IntentVirtualWorkerId)
+{
+	if (VirtualWorkerId* EnforcedIntent = EnforcedEntityIntents.Find(EntityId))
+	{
+		if (*EnforcedIntent == IntentVirtualWorkerId)
+		{
+			return;
+		}
+
+		EnforcedEntitiesByIntent.FindChecked(*EnforcedIntent).Remove(EntityId);
+		*EnforcedIntent = IntentVirtualWorkerId;
+	}
+	else
+	{
+		EnforcedEntityIntents.Add(EntityId, IntentVirtualWorkerId);
+	}
+
+	EnforcedEntitiesByIntent.FindOrAdd(IntentVirtualWorkerId).Add(EntityId);
+}
+
+void SpatialLoadBalanceEnforcer::RemoveEnforcedIntent(const Worker_EntityId EntityId)
+{
+	VirtualWorkerId EnforcedIntent;
+	if (EnforcedEntityIntents.RemoveAndCopyValue(EntityId, EnforcedIntent))
+	{
+		EnforcedEntitiesByIntent.FindChecked(EnforcedIntent).Remove(EntityId);
+	}
 }
 
 bool SpatialLoadBalanceEnforcer::CanEnforce(Worker_EntityId EntityId) const
@@ -95,11 +95,13 @@ void USpatialNetConnection::UpdateLevelVisibility(const struct FUpdateLevelVisib
 	UNetConnection::UpdateLevelVisibility(LevelVisibility);
 #endif
 
-	// We want to update our interest as fast as possible
-	// So we send an Interest update immediately.
+	ResetCachedLevelConstraint();
+
+	// We want to update our interest as fast as possible, so the update is sent immediately unless interest updates
+	// are debounced or budgeted, in which case it is merged with the other visibility changes of this connection.
 
 	USpatialSender* Sender = Cast<USpatialNetDriver>(Driver)->Sender;
-	Sender->UpdateInterestComponent(Cast<AActor>(PlayerController));
+	Sender->QueueInterestUpdate(Cast<AActor>(PlayerController));
 }
 
 void USpatialNetConnection::FlushDormancy(AActor* Actor)
@@ -10,6 +10,7 @@
 #include "EngineGlobals.h"
 #include "GameFramework/GameModeBase.h"
 #include "GameFramework/GameNetworkManager.h"
+#include "Misc/App.h"
 #include "Misc/MessageDialog.h"
 #include "Net/DataReplication.h"
 #include "Net/RepLayout.h"
@@ -29,19 +30,25 @@
 #include "Interop/SpatialPlayerSpawner.h"
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialSender.h"
+#include "Interop/SpatialStaticComponentView.h"
 #include "Interop/SpatialWorkerFlags.h"
 #include "LoadBalancing/AbstractLBStrategy.h"
 #include "LoadBalancing/GridBasedLBStrategy.h"
 #include "LoadBalancing/OwnershipLockingPolicy.h"
+#include "Schema/ServerWorker.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
 #include "Utils/ComponentFactory.h"
 #include "Utils/EntityPool.h"
 #include "Utils/ErrorCodeRemapping.h"
+#include "Utils/Interest/NetCullDistanceInterest.h"
+#include "Utils/Interest/QueryConstraintEvaluator.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/OpUtils.h"
 #include "Utils/SpatialActorGroupManager.h"
+#include "Utils/SpatialActorUtils.h"
 #include "Utils/SpatialDebugger.h"
+#include "Utils/SpatialLatencyTracer.h"
 #include "Utils/SpatialMetrics.h"
 #include "Utils/SpatialMetricsDisplay.h"
 #include "Utils/SpatialStatics.h"
@@ -64,9 +71,12 @@ DECLARE_CYCLE_STAT(TEXT("ProcessPrioritizedActors"), STAT_SpatialProcessPrioriti
 DECLARE_CYCLE_STAT(TEXT("PrioritizeActors"), STAT_SpatialPrioritizeActors, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ProcessOps"), STAT_SpatialProcessOps, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("UpdateAuthority"), STAT_SpatialUpdateAuthority, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("UpdateNetCullDistanceFrequency"), STAT_SpatialUpdateNetCullDistanceFrequency, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("ThrottleActorsOutsideClientInterest"), STAT_SpatialThrottleActorsOutsideClientInterest, STATGROUP_SpatialNet);
 DEFINE_STAT(STAT_SpatialConsiderList);
 DEFINE_STAT(STAT_SpatialActorsRelevant);
 DEFINE_STAT(STAT_SpatialActorsChanged);
+DEFINE_STAT(STAT_SpatialActorsOutsideClientInterest);
 
 USpatialNetDriver::USpatialNetDriver(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -416,6 +426,37 @@ void USpatialNetDriver::CreateAndInitializeCoreClasses()
 
 	// The interest factory depends on the package map, so is created last.
 	InterestFactory = MakeUnique<SpatialGDK::InterestFactory>(ClassInfoManager, PackageMap);
+
+#if TRACE_LIB_ACTIVE
+	// Latency trace exporters buffer spans in memory, so write them out regularly rather than only when the buffer fills up.
+	FTimerHandle LatencyTraceFlushTimer;
+	TimerManager.SetTimer(LatencyTraceFlushTimer, [WeakThis = TWeakObjectPtr<USpatialNetDriver>(this)]()
+	{
+		if (WeakThis.IsValid())
+		{
+			WeakThis->FlushLatencyTraceExporters();
+		}
+	}, SpatialConstants::LATENCY_TRACE_EXPORTER_FLUSH_INTERVAL_SECONDS, true);
+#endif
+}
+
+void USpatialNetDriver::FlushLatencyTraceExporters()
+{
+#if TRACE_LIB_ACTIVE
+	UWorld* World = GetWorld();
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	if (USpatialGameInstance* GameInstance = Cast<USpatialGameInstance>(World->GetGameInstance()))
+	{
+		if (USpatialLatencyTracer* LatencyTracer = GameInstance->GetSpatialLatencyTracer())
+		{
+			LatencyTracer->FlushExporters();
+		}
+	}
+#endif // TRACE_LIB_ACTIVE
 }
 
 void USpatialNetDriver::CreateAndInitializeLoadBalancingClasses()
@@ -440,6 +481,7 @@ void USpatialNetDriver::CreateAndInitializeLoadBalancingClasses()
 			LoadBalanceStrategy = NewObject<UAbstractLBStrategy>(this, WorldSettings->LoadBalanceStrategy);
 		}
 		LoadBalanceStrategy->Init();
+		LoadBalanceStrategy->OnLayoutChanged.AddUObject(this, &USpatialNetDriver::OnLoadBalancingLayoutChanged);
 	}
 
 	VirtualWorkerTranslator = MakeUnique<SpatialVirtualWorkerTranslator>(LoadBalanceStrategy, Connection->GetWorkerId());
@@ -447,6 +489,7 @@ void USpatialNetDriver::CreateAndInitializeLoadBalancingClasses()
 	if (IsServer())
 	{
 		LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(Connection->GetWorkerId(), StaticComponentView, VirtualWorkerTranslator.Get());
+		VirtualWorkerTranslator->OnMappingChanged.AddRaw(LoadBalanceEnforcer.Get(), &SpatialLoadBalanceEnforcer::OnVirtualWorkerMappingChanged);
 
 		if (WorldSettings == nullptr || WorldSettings->LockingPolicy == nullptr)
 		{
@@ -716,13 +759,53 @@ void USpatialNetDriver::OnLevelAddedToWorld(ULevel* LoadedLevel, UWorld* OwningW
 		return;
 	}
 
+	// If load balancing is enabled, check the lb strategy.
+	if (bLoadBalancingEnabled)
+	{
+		BecomeAuthoritativeOverActorsBasedOnLBStrategy(LoadedLevel->Actors);
+		return;
+	}
+
+	// Otherwise, we must be the GSM-authoritative worker, so set Role_Authority.
 	for (auto Actor : LoadedLevel->Actors)
 	{
-		// If load balancing is disabled, we must be the GSM-authoritative worker, so set Role_Authority
-		// otherwise, load balancing is enabled, so check the lb strategy.
-		if (Actor->GetIsReplicated() &&
-			(!bLoadBalancingEnabled || LoadBalanceStrategy->ShouldHaveAuthority(*Actor)))
+		if (Actor != nullptr && Actor->GetIsReplicated())
+		{
+			Actor->Role = ROLE_Authority;
+			Actor->RemoteRole = ROLE_SimulatedProxy;
+		}
+	}
+}
+
+void USpatialNetDriver::BecomeAuthoritativeOverActorsBasedOnLBStrategy(const TArray<AActor*>& Actors)
+{
+	check(LoadBalanceStrategy != nullptr);
+
+	const VirtualWorkerId LocalVirtualWorkerId = VirtualWorkerTranslator.IsValid() ? VirtualWorkerTranslator->GetLocalVirtualWorkerId() : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	if (LocalVirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+	{
+		UE_LOG(LogSpatialOSNetDriver, Warning, TEXT("Not taking authority over %d Actors, since this worker has no virtual worker ID yet."), Actors.Num());
+		return;
+	}
+
+	TArray<AActor*> ReplicatedActors;
+	ReplicatedActors.Reserve(Actors.Num());
+	for (AActor* Actor : Actors)
+	{
+		if (Actor != nullptr && Actor->GetIsReplicated())
 		{
+			ReplicatedActors.Add(Actor);
+		}
+	}
+
+	TArray<VirtualWorkerId> AuthoritativeVirtualWorkerIds;
+	LoadBalanceStrategy->WhoShouldHaveAuthorityForActors(ReplicatedActors, AuthoritativeVirtualWorkerIds);
+
+	for (int32 i = 0; i < ReplicatedActors.Num(); i++)
+	{
+		if (AuthoritativeVirtualWorkerIds[i] == LocalVirtualWorkerId)
+		{
+			AActor* Actor = ReplicatedActors[i];
 			Actor->Role = ROLE_Authority;
 			Actor->RemoteRole = ROLE_SimulatedProxy;
 		}
@@ -963,6 +1046,8 @@ void USpatialNetDriver::Shutdown()
 
 	SpatialOutputDevice = nullptr;
 
+	FlushLatencyTraceExporters();
+
 	Super::Shutdown();
 
 	// This is done after Super::Shutdown so the NetDriver is given an opportunity to shutdown all open channels, and those
@@ -1017,6 +1102,11 @@ void USpatialNetDriver::OnOwnerUpdated(AActor* Actor, AActor* OldOwner)
 		LockingPolicy->OnOwnerUpdated(Actor, OldOwner);
 	}
 
+	if (InterestFactory.IsValid())
+	{
+		InterestFactory->OnActorOwnerChanged(Actor);
+	}
+
 	// If PackageMap doesn't exist, we haven't connected yet, which means
 	// we don't need to update the interest at this point
 	if (PackageMap == nullptr)
@@ -1388,7 +1478,11 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 							LastRelevantActors.Add(Actor);
 						}
 
-						if (Channel->ReplicateActor())
+						const int64 ReplicatedBits = Channel->ReplicateActor();
+						ReplicationBitsSinceNetCullDistanceFrequencyUpdated += ReplicatedBits;
+						ReplicationsSinceNetCullDistanceFrequencyUpdated++;
+
+						if (ReplicatedBits > 0)
 						{
 							ActorUpdatesThisConnectionSent++;
 							if (DebugRelevantActors)
@@ -1437,6 +1531,84 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 	// In Spatial we use ActorReplicationRateLimit and EntityCreationRateLimit to limit replication so this return value is not relevant.
 }
 
+void USpatialNetDriver::ServerReplicateActors_ThrottleActorsOutsideClientInterest(TArray<FNetworkObjectInfo*>& ConsiderList)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialThrottleActorsOutsideClientInterest);
+
+	SET_DWORD_STAT(STAT_SpatialActorsOutsideClientInterest, 0);
+
+	struct FClientInterest
+	{
+		const SpatialGDK::Interest* Interest;
+		SpatialGDK::Coordinates Origin;
+	};
+
+	// The interest of each client is the one this worker last sent for its player controller. If any client's interest isn't known,
+	// for example because its player controller is on another worker, nothing is throttled.
+	TArray<FClientInterest> ClientInterests;
+	for (int32 i = 1; i < ClientConnections.Num(); i++)
+	{
+		const USpatialNetConnection* ClientConnection = Cast<USpatialNetConnection>(ClientConnections[i]);
+		if (ClientConnection == nullptr || ClientConnection->PlayerController == nullptr)
+		{
+			continue;
+		}
+
+		const Worker_EntityId PlayerControllerEntityId = PackageMap->GetEntityIdFromObject(ClientConnection->PlayerController);
+		const SpatialGDK::Interest* SentInterest = InterestFactory->GetSentPlayerControllerInterest(PlayerControllerEntityId);
+		if (SentInterest == nullptr)
+		{
+			return;
+		}
+
+		ClientInterests.Add({ SentInterest, SpatialGDK::Coordinates::FromFVector(SpatialGDK::GetActorSpatialPosition(ClientConnection->PlayerController)) });
+	}
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const Worker_ComponentId ClientAuthorityComponentId = SpatialConstants::GetClientAuthorityComponent(SpatialGDKSettings->UseRPCRingBuffer());
+	const double NextUpdateTime = World->TimeSeconds + SpatialGDKSettings->ReplicationIntervalOutsideClientInterest;
+
+	uint32 NumActorsOutsideClientInterest = 0;
+	for (int32 i = ConsiderList.Num() - 1; i >= 0; i--)
+	{
+		FNetworkObjectInfo* ActorInfo = ConsiderList[i];
+		const AActor* Actor = ActorInfo->Actor;
+
+		// Actors owned by a client are in that client's interest through their owner, and may have RPCs waiting on replication.
+		if (Actor->GetNetConnection() != nullptr)
+		{
+			continue;
+		}
+
+		// Actors need to be replicated at least once for their entity to be created.
+		const Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(Actor);
+		if (EntityId == SpatialConstants::INVALID_ENTITY_ID || !StaticComponentView->HasComponent(EntityId, SpatialConstants::POSITION_COMPONENT_ID))
+		{
+			continue;
+		}
+
+		const SpatialGDK::Coordinates EntityPosition = SpatialGDK::Coordinates::FromFVector(SpatialGDK::GetActorSpatialPosition(Actor));
+		auto HasComponent = [this, EntityId](Worker_ComponentId ComponentId)
+		{
+			return StaticComponentView->HasComponent(EntityId, ComponentId);
+		};
+
+		const bool bIsInClientInterest = ClientInterests.ContainsByPredicate([&](const FClientInterest& ClientInterest)
+		{
+			return SpatialGDK::QueryConstraintEvaluator::IsEntityInInterest(*ClientInterest.Interest, ClientAuthorityComponentId, EntityId, EntityPosition, HasComponent, ClientInterest.Origin);
+		});
+
+		if (!bIsInClientInterest)
+		{
+			ActorInfo->NextUpdateTime = NextUpdateTime;
+			ConsiderList.RemoveAtSwap(i, 1, false);
+			NumActorsOutsideClientInterest++;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_SpatialActorsOutsideClientInterest, NumActorsOutsideClientInterest);
+}
+
 #endif // WITH_SERVER_CODE
 
 void USpatialNetDriver::ProcessRPC(AActor* Actor, UObject* SubObject, UFunction* Function, void* Parameters)
@@ -1531,6 +1703,11 @@ int32 USpatialNetDriver::ServerReplicateActors(float DeltaSeconds)
 	// Build the consider list (actors that are ready to replicate)
 	ServerReplicateActors_BuildConsiderList(ConsiderList, ServerTickTime);
 
+	if (GetDefault<USpatialGDKSettings>()->bThrottleReplicationOutsideClientInterest)
+	{
+		ServerReplicateActors_ThrottleActorsOutsideClientInterest(ConsiderList);
+	}
+
 	SET_DWORD_STAT(STAT_SpatialConsiderList, ConsiderList.Num());
 
 	FMemMark Mark(FMemStack::Get());
@@ -1640,6 +1817,16 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 			SpatialMetrics->TickMetrics(Time);
 		}
 
+		if (VirtualWorkerTranslationManager.IsValid())
+		{
+			VirtualWorkerTranslationManager->Tick(DeltaTime);
+		}
+
+		if (LoadBalanceStrategy != nullptr && LoadBalanceStrategy->GetLoadReportInterval() > 0.f)
+		{
+			ReportWorkerLoad(DeltaTime);
+		}
+
 		if (LoadBalanceEnforcer.IsValid())
 		{
 			SCOPE_CYCLE_COUNTER(STAT_SpatialUpdateAuthority);
@@ -1651,6 +1838,170 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 	}
 }
 
+void USpatialNetDriver::OnLoadBalancingLayoutChanged()
+{
+	// The worker's region has moved, so its interest and position need to follow it.
+	if (Sender != nullptr && WorkerEntityId != SpatialConstants::INVALID_ENTITY_ID && LoadBalanceStrategy->IsReady())
+	{
+		Sender->UpdateServerWorkerEntityInterestAndPosition();
+	}
+}
+
+void USpatialNetDriver::ReportWorkerLoad(float DeltaTime)
+{
+	TimeSinceWorkerLoadReported += DeltaTime;
+	FramesSinceWorkerLoadReported++;
+
+	// Report twice per collection so the translation manager always sees a recent value.
+	if (TimeSinceWorkerLoadReported < LoadBalanceStrategy->GetLoadReportInterval() / 2.f || WorkerEntityId == SpatialConstants::INVALID_ENTITY_ID)
+	{
+		return;
+	}
+
+	uint32 AuthoritativeActorCount = 0;
+	for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : GetNetworkObjectList().GetActiveObjects())
+	{
+		const AActor* Actor = ObjectInfo->Actor;
+		if (Actor != nullptr && Actor->HasAuthority())
+		{
+			AuthoritativeActorCount++;
+		}
+	}
+
+	const float AverageFrameTime = TimeSinceWorkerLoadReported / FramesSinceWorkerLoadReported;
+	const float AverageReplicationTime = static_cast<float>(ReplicationTimeSinceWorkerLoadReported / FramesSinceWorkerLoadReported);
+	const float RPCsPerSecond = RPCsSinceWorkerLoadReported / TimeSinceWorkerLoadReported;
+
+	TMap<VirtualWorkerId, float> MigrationsPerSecond;
+	MigrationsPerSecond.Reserve(MigrationsSinceWorkerLoadReported.Num());
+	for (const auto& Entry : MigrationsSinceWorkerLoadReported)
+	{
+		MigrationsPerSecond.Add(Entry.Key, Entry.Value / TimeSinceWorkerLoadReported);
+	}
+
+	FWorkerComponentUpdate Update = SpatialGDK::ServerWorker::CreateLoadReportUpdate(AuthoritativeActorCount, AverageFrameTime, AverageReplicationTime, RPCsPerSecond, MigrationsPerSecond);
+	Connection->SendComponentUpdate(WorkerEntityId, &Update);
+
+	TimeSinceWorkerLoadReported = 0.f;
+	FramesSinceWorkerLoadReported = 0;
+	ReplicationTimeSinceWorkerLoadReported = 0.0;
+	RPCsSinceWorkerLoadReported = 0;
+	MigrationsSinceWorkerLoadReported.Reset();
+}
+
+void USpatialNetDriver::UpdateNetCullDistanceFrequencyScale(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialUpdateNetCullDistanceFrequency);
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	TimeSinceNetCullDistanceFrequencyUpdated += DeltaTime;
+	// DeltaTime includes the time the engine waited to stay under the max tick rate, which isn't load.
+	IdleTimeSinceNetCullDistanceFrequencyUpdated += FMath::Min(static_cast<float>(FApp::GetIdleTime()), DeltaTime);
+	FramesSinceNetCullDistanceFrequencyUpdated++;
+
+	// Every change sends an interest update for each client, so changes are rate limited.
+	if (TimeSinceNetCullDistanceFrequencyUpdated < SpatialGDKSettings->NetCullDistanceFrequencyUpdateInterval || !InterestFactory.IsValid())
+	{
+		return;
+	}
+
+	const float CurrentScale = InterestFactory->GetNetCullDistanceFrequencyScale();
+
+	// Pressure is the load relative to its budget, for whichever budget is the most exceeded.
+	float Pressure = 0.f;
+	if (SpatialGDKSettings->ClientInterestBandwidthBudget > 0.f)
+	{
+		Pressure = EstimateMaxClientInterestBandwidth(CurrentScale) / SpatialGDKSettings->ClientInterestBandwidthBudget;
+	}
+	if (SpatialGDKSettings->bEnableClientQueriesOnServer)
+	{
+		Pressure = FMath::Max(Pressure, SpatialGDK::NetCullDistanceInterest::ComputeServerLoadPressure(TimeSinceNetCullDistanceFrequencyUpdated,
+			IdleTimeSinceNetCullDistanceFrequencyUpdated, FramesSinceNetCullDistanceFrequencyUpdated, NetServerMaxTickRate,
+			SpatialGDKSettings->NetCullDistanceFrequencyServerLoadBudget));
+	}
+
+	TimeSinceNetCullDistanceFrequencyUpdated = 0.f;
+	IdleTimeSinceNetCullDistanceFrequencyUpdated = 0.f;
+	FramesSinceNetCullDistanceFrequencyUpdated = 0;
+	ReplicationBitsSinceNetCullDistanceFrequencyUpdated = 0;
+	ReplicationsSinceNetCullDistanceFrequencyUpdated = 0;
+
+	const float NewScale = SpatialGDK::NetCullDistanceInterest::ComputeFrequencyDistanceScale(CurrentScale, Pressure,
+		SpatialGDKSettings->MinimumNetCullDistanceFrequencyScale, SpatialGDKSettings->NetCullDistanceFrequencyHysteresis);
+
+	if (!InterestFactory->SetNetCullDistanceFrequencyScale(NewScale))
+	{
+		return;
+	}
+
+	UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Net cull distance frequency scale changed from %.2f to %.2f (pressure %.2f)"), CurrentScale, NewScale, Pressure);
+
+	// The first client connection is the connection to SpatialOS.
+	for (int32 i = 1; i < ClientConnections.Num(); i++)
+	{
+		const USpatialNetConnection* ClientConnection = Cast<USpatialNetConnection>(ClientConnections[i]);
+		if (ClientConnection != nullptr && ClientConnection->PlayerController != nullptr && ClientConnection->PlayerController->HasAuthority())
+		{
+			Sender->QueueInterestUpdate(ClientConnection->PlayerController);
+		}
+	}
+}
+
+float USpatialNetDriver::EstimateMaxClientInterestBandwidth(float FrequencyDistanceScale) const
+{
+	if (ReplicationsSinceNetCullDistanceFrequencyUpdated == 0)
+	{
+		return 0.f;
+	}
+
+	// Average bytes sent per replication of an Actor, including replications which had nothing to send.
+	const float BytesPerReplication = ReplicationBitsSinceNetCullDistanceFrequencyUpdated / 8.f / ReplicationsSinceNetCullDistanceFrequencyUpdated;
+
+	// Servers can't see what their clients receive, so estimate it from the Actors this worker replicates and the frequency buckets
+	// each client would see them in.
+	float MaxBytesPerSecond = 0.f;
+	for (int32 i = 1; i < ClientConnections.Num(); i++)
+	{
+		const USpatialNetConnection* ClientConnection = Cast<USpatialNetConnection>(ClientConnections[i]);
+		if (ClientConnection == nullptr || ClientConnection->PlayerController == nullptr || !ClientConnection->PlayerController->HasAuthority())
+		{
+			continue;
+		}
+
+		const AActor* ViewTarget = ClientConnection->PlayerController->GetViewTarget();
+		const FVector ViewLocation = ViewTarget != nullptr ? ViewTarget->GetActorLocation() : ClientConnection->PlayerController->GetFocalLocation();
+
+		float ReplicationsPerSecond = 0.f;
+		for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : GetNetworkObjectList().GetActiveObjects())
+		{
+			const AActor* Actor = ObjectInfo->Actor;
+			if (Actor == nullptr || !Actor->HasAuthority() || Actor->NetCullDistanceSquared <= 0.f)
+			{
+				continue;
+			}
+
+			const float DistanceRatio = FMath::Sqrt(FVector::DistSquared(ViewLocation, Actor->GetActorLocation()) / Actor->NetCullDistanceSquared);
+			const float Frequency = SpatialGDK::NetCullDistanceInterest::GetFrequencyAtDistanceRatio(DistanceRatio, FrequencyDistanceScale);
+			ReplicationsPerSecond += FMath::Min(Actor->NetUpdateFrequency, Frequency);
+		}
+
+		MaxBytesPerSecond = FMath::Max(MaxBytesPerSecond, ReplicationsPerSecond * BytesPerReplication);
+	}
+
+	return MaxBytesPerSecond;
+}
+
+void USpatialNetDriver::TrackAuthorityMigration(VirtualWorkerId NewAuthVirtualWorkerId)
+{
+	MigrationsSinceWorkerLoadReported.FindOrAdd(NewAuthVirtualWorkerId)++;
+
+	if (SpatialMetrics != nullptr)
+	{
+		SpatialMetrics->TrackAuthorityMigration();
+	}
+}
+
 void USpatialNetDriver::ProcessRemoteFunction(
 	AActor* Actor,
 	UFunction* Function,
@@ -1727,6 +2078,7 @@ void USpatialNetDriver::ProcessRemoteFunction(
 
 	if (Function->FunctionFlags & FUNC_Net)
 	{
+		RPCsSinceWorkerLoadReported++;
 		ProcessRPC(Actor, SubObject, Function, Parameters);
 	}
 }
@@ -1773,7 +2125,14 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 		// Update all clients.
 #if WITH_SERVER_CODE
 
+		const double ReplicationStartTime = FPlatformTime::Seconds();
 		int32 Updated = ServerReplicateActors(DeltaTime);
+		ReplicationTimeSinceWorkerLoadReported += FPlatformTime::Seconds() - ReplicationStartTime;
+
+		if (SpatialGDKSettings->bEnableNetCullDistanceFrequency && SpatialGDKSettings->bEnableDynamicNetCullDistanceFrequency)
+		{
+			UpdateNetCullDistanceFrequencyScale(DeltaTime);
+		}
 
 		static int32 LastUpdateCount = 0;
 		// Only log the zero replicated actors once after replicating an actor
@@ -1793,6 +2152,12 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 			}
 		}
 
+		if (Sender != nullptr)
+		{
+			Sender->ProcessInterestBucketComponentChanges();
+			Sender->ProcessPendingInterestUpdates();
+		}
+
 #endif // WITH_SERVER_CODE
 	}
 
@@ -2181,6 +2546,11 @@ void USpatialNetDriver::RemoveActorChannel(Worker_EntityId EntityId, USpatialAct
 	}
 
 	EntityToActorChannel.FindAndRemoveChecked(EntityId);
+
+	if (InterestFactory.IsValid())
+	{
+		InterestFactory->ForgetSentInterest(EntityId);
+	}
 }
 
 TMap<Worker_EntityId_Key, USpatialActorChannel*>& USpatialNetDriver::GetEntityToActorChannelMap()
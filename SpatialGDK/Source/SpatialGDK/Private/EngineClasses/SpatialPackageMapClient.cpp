@@ -222,8 +222,7 @@ FNetworkGUID USpatialPackageMapClient::GetNetGUIDFromUnrealObjectRef(const FUnre
 FNetworkGUID USpatialPackageMapClient::GetNetGUIDFromEntityId(const Worker_EntityId& EntityId) const
 {
 	FSpatialNetGUIDCache* SpatialGuidCache = static_cast<FSpatialNetGUIDCache*>(GuidCache.Get());
-	FUnrealObjectRef ObjectRef(EntityId, 0);
-	return GetNetGUIDFromUnrealObjectRef(ObjectRef);
+	return SpatialGuidCache->GetNetGUIDFromEntityId(EntityId);
 }
 
 TWeakObjectPtr<UObject> USpatialPackageMapClient::GetObjectFromUnrealObjectRef(const FUnrealObjectRef& ObjectRef)
@@ -376,13 +375,13 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 		NetGUID = AssignNewStablyNamedObjectNetGUID(Actor);
 
 		// We register the entity id ref here.
-		UnrealObjectRefToNetGUID.Emplace(EntityObjectRef, NetGUID);
+		SetNetGUIDForObjectRef(EntityObjectRef, NetGUID);
 
 		// Once we have an entity id, we should always be using it to refer to entities.
 		// Since the path ref may have been registered previously, we first try to remove it
 		// and then register the entity id ref.
-		StablyNamedRef = NetGUIDToUnrealObjectRef[NetGUID];
-		NetGUIDToUnrealObjectRef.Emplace(NetGUID, EntityObjectRef);
+		verify(FindObjectRef(NetGUID, StablyNamedRef));
+		SetObjectRefForNetGUID(NetGUID, EntityObjectRef);
 	}
 	else
 	{
@@ -418,12 +417,12 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 			FUnrealObjectRef StablyNamedSubobjectRef(0, 0, Subobject->GetFName().ToString(), StablyNamedRef);
 
 			// This is the only extra object ref that has to be registered for the subobject.
-			UnrealObjectRefToNetGUID.Emplace(StablyNamedSubobjectRef, SubobjectNetGUID);
+			SetNetGUIDForObjectRef(StablyNamedSubobjectRef, SubobjectNetGUID);
 
 			// As the subobject may have be referred to previously in replication flow, it would
 			// have it's stable name registered as it's UnrealObjectRef inside NetGUIDToUnrealObjectRef.
 			// Update the map to point to the entity id version.
-			NetGUIDToUnrealObjectRef.Emplace(SubobjectNetGUID, EntityIdSubobjectRef);
+			SetObjectRefForNetGUID(SubobjectNetGUID, EntityIdSubobjectRef);
 		}
 
 		RegisterObjectRef(SubobjectNetGUID, EntityIdSubobjectRef);
@@ -514,14 +513,14 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 		for (auto& SubobjectInfoPair : Info.SubobjectInfo)
 		{
 			FUnrealObjectRef SubobjectRef(EntityId, SubobjectInfoPair.Key);
-			if (FNetworkGUID* SubobjectNetGUID = UnrealObjectRefToNetGUID.Find(SubobjectRef))
+			if (const FNetworkGUID* SubobjectNetGUID = FindNetGUID(SubobjectRef))
 			{
-				NetGUIDToUnrealObjectRef.Remove(*SubobjectNetGUID);
-				UnrealObjectRefToNetGUID.Remove(SubobjectRef);
+				RemoveObjectRefForNetGUID(*SubobjectNetGUID);
+				RemoveNetGUIDForObjectRef(SubobjectRef);
 
 				if (StablyNamedRefOption.IsSet())
 				{
-					UnrealObjectRefToNetGUID.Remove(FUnrealObjectRef(0, 0, SubobjectInfoPair.Value->SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
+					RemoveNetGUIDForObjectRef(FUnrealObjectRef(0, 0, SubobjectInfoPair.Value->SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
 				}
 			}
 		}
@@ -534,10 +533,11 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 		{
 			if (FNetworkGUID* SubobjectNetGUID = NetGUIDLookup.Find(DynamicSubobject))
 			{
-				if (FUnrealObjectRef* SubobjectRef = NetGUIDToUnrealObjectRef.Find(*SubobjectNetGUID))
+				FUnrealObjectRef SubobjectRef;
+				if (FindObjectRef(*SubobjectNetGUID, SubobjectRef))
 				{
-					UnrealObjectRefToNetGUID.Remove(*SubobjectRef);
-					NetGUIDToUnrealObjectRef.Remove(*SubobjectNetGUID);
+					RemoveNetGUIDForObjectRef(SubobjectRef);
+					RemoveObjectRefForNetGUID(*SubobjectNetGUID);
 				}
 			}
 		}
@@ -546,23 +546,26 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 	// Remove actor.
 	FNetworkGUID EntityNetGUID = GetNetGUIDFromEntityId(EntityId);
 	// TODO: Figure out why NetGUIDToUnrealObjectRef might not have this GUID. UNR-989
-	if (FUnrealObjectRef* ActorRef = NetGUIDToUnrealObjectRef.Find(EntityNetGUID))
+	FUnrealObjectRef ActorRef;
+	if (FindObjectRef(EntityNetGUID, ActorRef))
 	{
-		UnrealObjectRefToNetGUID.Remove(*ActorRef);
+		RemoveNetGUIDForObjectRef(ActorRef);
 	}
-	NetGUIDToUnrealObjectRef.Remove(EntityNetGUID);
+	RemoveObjectRefForNetGUID(EntityNetGUID);
 	if (StablyNamedRefOption.IsSet())
 	{
-		UnrealObjectRefToNetGUID.Remove(StablyNamedRefOption.GetValue());
+		RemoveNetGUIDForObjectRef(StablyNamedRefOption.GetValue());
 	}
 }
 
 void FSpatialNetGUIDCache::RemoveSubobjectNetGUID(const FUnrealObjectRef& SubobjectRef)
 {
-	if (!UnrealObjectRefToNetGUID.Contains(SubobjectRef))
+	const FNetworkGUID* ExistingNetGUID = FindNetGUID(SubobjectRef);
+	if (ExistingNetGUID == nullptr)
 	{
 		return;
 	}
+	const FNetworkGUID SubobjectNetGUID = *ExistingNetGUID;
 
 	USpatialNetDriver* SpatialNetDriver = Cast<USpatialNetDriver>(Driver);
 	SpatialGDK::UnrealMetadata* UnrealMetadata = SpatialNetDriver->StaticComponentView->GetComponentData<SpatialGDK::UnrealMetadata>(SubobjectRef.Entity);
@@ -595,13 +598,12 @@ void FSpatialNetGUIDCache::RemoveSubobjectNetGUID(const FUnrealObjectRef& Subobj
 
 			if (StablyNamedRefOption.IsSet())
 			{
-				UnrealObjectRefToNetGUID.Remove(FUnrealObjectRef(0, 0, SubobjectInfoPtr->Get().SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
+				RemoveNetGUIDForObjectRef(FUnrealObjectRef(0, 0, SubobjectInfoPtr->Get().SubobjectName.ToString(), StablyNamedRefOption.GetValue()));
 			}
 		}
 	}
-	FNetworkGUID SubobjectNetGUID = UnrealObjectRefToNetGUID[SubobjectRef];
-	NetGUIDToUnrealObjectRef.Remove(SubobjectNetGUID);
-	UnrealObjectRefToNetGUID.Remove(SubobjectRef);
+	RemoveObjectRefForNetGUID(SubobjectNetGUID);
+	RemoveNetGUIDForObjectRef(SubobjectRef);
 }
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRef(const FUnrealObjectRef& ObjectRef)
@@ -611,7 +613,7 @@ FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRef(const FUnrealOb
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRefInternal(const FUnrealObjectRef& ObjectRef)
 {
-	FNetworkGUID* CachedGUID = UnrealObjectRefToNetGUID.Find(ObjectRef);
+	const FNetworkGUID* CachedGUID = FindNetGUID(ObjectRef);
 	FNetworkGUID NetGUID = CachedGUID ? *CachedGUID : FNetworkGUID{};
 	if (!NetGUID.IsValid() && ObjectRef.Path.IsSet())
 	{
@@ -657,22 +659,22 @@ void FSpatialNetGUIDCache::NetworkRemapObjectRefPaths(FUnrealObjectRef& ObjectRe
 
 void FSpatialNetGUIDCache::UnregisterActorObjectRefOnly(const FUnrealObjectRef& ObjectRef)
 {
-	FNetworkGUID& NetGUID = UnrealObjectRefToNetGUID.FindChecked(ObjectRef);
-	// Remove ObjectRef first so the reference above isn't destroyed
-	NetGUIDToUnrealObjectRef.Remove(NetGUID);
-	UnrealObjectRefToNetGUID.Remove(ObjectRef);
+	const FNetworkGUID* NetGUID = FindNetGUID(ObjectRef);
+	check(NetGUID != nullptr);
+	// Remove ObjectRef first so the pointer above isn't invalidated
+	RemoveObjectRefForNetGUID(*NetGUID);
+	RemoveNetGUIDForObjectRef(ObjectRef);
 }
 
 FUnrealObjectRef FSpatialNetGUIDCache::GetUnrealObjectRefFromNetGUID(const FNetworkGUID& NetGUID) const
 {
-	const FUnrealObjectRef* ObjRef = NetGUIDToUnrealObjectRef.Find(NetGUID);
-	return ObjRef ? (FUnrealObjectRef)*ObjRef : FUnrealObjectRef::UNRESOLVED_OBJECT_REF;
+	FUnrealObjectRef ObjRef;
+	return FindObjectRef(NetGUID, ObjRef) ? ObjRef : FUnrealObjectRef::UNRESOLVED_OBJECT_REF;
 }
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromEntityId(Worker_EntityId EntityId) const
 {
-	FUnrealObjectRef ObjRef(EntityId, 0);
-	const FNetworkGUID* NetGUID = UnrealObjectRefToNetGUID.Find(ObjRef);
+	const FNetworkGUID* NetGUID = EntityOffsetToNetGUID.Find(SpatialGDK::FEntityOffsetKey(EntityId, 0));
 	return (NetGUID == nullptr) ? FNetworkGUID(0) : *NetGUID;
 }
 
@@ -738,12 +740,93 @@ void FSpatialNetGUIDCache::RegisterObjectRef(FNetworkGUID NetGUID, const FUnreal
 	FUnrealObjectRef RemappedObjectRef = ObjectRef;
 	NetworkRemapObjectRefPaths(RemappedObjectRef, false /*bIsReading*/);
 
-	checkfSlow(!NetGUIDToUnrealObjectRef.Contains(NetGUID) || (NetGUIDToUnrealObjectRef.Contains(NetGUID) && NetGUIDToUnrealObjectRef.FindChecked(NetGUID) == RemappedObjectRef),
+#if DO_GUARD_SLOW
+	FUnrealObjectRef ExistingObjectRef;
+	checkfSlow(!FindObjectRef(NetGUID, ExistingObjectRef) || ExistingObjectRef == RemappedObjectRef,
 		TEXT("NetGUID to UnrealObjectRef mismatch - NetGUID: %s ObjRef in map: %s ObjRef expected: %s"), *NetGUID.ToString(),
-		*NetGUIDToUnrealObjectRef.FindChecked(NetGUID).ToString(), *RemappedObjectRef.ToString());
-	checkfSlow(!UnrealObjectRefToNetGUID.Contains(RemappedObjectRef) || (UnrealObjectRefToNetGUID.Contains(RemappedObjectRef) && UnrealObjectRefToNetGUID.FindChecked(RemappedObjectRef) == NetGUID),
-		TEXT("UnrealObjectRef to NetGUID mismatch - UnrealObjectRef: %s NetGUID in map: %s NetGUID expected: %s"), *NetGUID.ToString(),
-		*UnrealObjectRefToNetGUID.FindChecked(RemappedObjectRef).ToString(), *RemappedObjectRef.ToString());
-	NetGUIDToUnrealObjectRef.Emplace(NetGUID, RemappedObjectRef);
-	UnrealObjectRefToNetGUID.Emplace(RemappedObjectRef, NetGUID);
+		*ExistingObjectRef.ToString(), *RemappedObjectRef.ToString());
+	const FNetworkGUID* ExistingNetGUID = FindNetGUID(RemappedObjectRef);
+	checkfSlow(ExistingNetGUID == nullptr || *ExistingNetGUID == NetGUID,
+		TEXT("UnrealObjectRef to NetGUID mismatch - UnrealObjectRef: %s NetGUID in map: %s NetGUID expected: %s"), *RemappedObjectRef.ToString(),
+		*ExistingNetGUID->ToString(), *NetGUID.ToString());
+#endif
+	SetObjectRefForNetGUID(NetGUID, RemappedObjectRef);
+	SetNetGUIDForObjectRef(RemappedObjectRef, NetGUID);
+}
+
+bool FSpatialNetGUIDCache::IsEntityOffsetRef(const FUnrealObjectRef& ObjectRef)
+{
+	return ObjectRef.Entity != SpatialConstants::INVALID_ENTITY_ID
+		&& !ObjectRef.Path.IsSet()
+		&& !ObjectRef.Outer.IsSet()
+		&& !ObjectRef.bUseSingletonClassPath;
+}
+
+const FNetworkGUID* FSpatialNetGUIDCache::FindNetGUID(const FUnrealObjectRef& ObjectRef) const
+{
+	if (IsEntityOffsetRef(ObjectRef))
+	{
+		return EntityOffsetToNetGUID.Find(SpatialGDK::FEntityOffsetKey(ObjectRef.Entity, ObjectRef.Offset));
+	}
+	return UnrealObjectRefToNetGUID.Find(ObjectRef);
+}
+
+bool FSpatialNetGUIDCache::FindObjectRef(const FNetworkGUID& NetGUID, FUnrealObjectRef& OutObjectRef) const
+{
+	if (const FUnrealObjectRef* EntityRef = NetGUIDToEntityRef.Find(NetGUID))
+	{
+		OutObjectRef = *EntityRef;
+		return true;
+	}
+	if (const FUnrealObjectRef* ObjectRef = NetGUIDToUnrealObjectRef.Find(NetGUID))
+	{
+		OutObjectRef = *ObjectRef;
+		return true;
+	}
+	return false;
+}
+
+void FSpatialNetGUIDCache::SetNetGUIDForObjectRef(const FUnrealObjectRef& ObjectRef, const FNetworkGUID& NetGUID)
+{
+	if (IsEntityOffsetRef(ObjectRef))
+	{
+		EntityOffsetToNetGUID.Add(SpatialGDK::FEntityOffsetKey(ObjectRef.Entity, ObjectRef.Offset), NetGUID);
+	}
+	else
+	{
+		UnrealObjectRefToNetGUID.Emplace(ObjectRef, NetGUID);
+	}
+}
+
+void FSpatialNetGUIDCache::SetObjectRefForNetGUID(const FNetworkGUID& NetGUID, const FUnrealObjectRef& ObjectRef)
+{
+	// A NetGUID refers to a single object ref, so make sure it is only present in one of the two tables.
+	if (IsEntityOffsetRef(ObjectRef))
+	{
+		NetGUIDToUnrealObjectRef.Remove(NetGUID);
+		NetGUIDToEntityRef.Add(NetGUID, ObjectRef);
+	}
+	else
+	{
+		NetGUIDToEntityRef.Remove(NetGUID);
+		NetGUIDToUnrealObjectRef.Emplace(NetGUID, ObjectRef);
+	}
+}
+
+void FSpatialNetGUIDCache::RemoveNetGUIDForObjectRef(const FUnrealObjectRef& ObjectRef)
+{
+	if (IsEntityOffsetRef(ObjectRef))
+	{
+		EntityOffsetToNetGUID.Remove(SpatialGDK::FEntityOffsetKey(ObjectRef.Entity, ObjectRef.Offset));
+	}
+	else
+	{
+		UnrealObjectRefToNetGUID.Remove(ObjectRef);
+	}
+}
+
+void FSpatialNetGUIDCache::RemoveObjectRefForNetGUID(const FNetworkGUID& NetGUID)
+{
+	NetGUIDToEntityRef.Remove(NetGUID);
+	NetGUIDToUnrealObjectRef.Remove(NetGUID);
 }
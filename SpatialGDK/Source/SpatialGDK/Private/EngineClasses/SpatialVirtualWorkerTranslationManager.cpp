@@ -4,6 +4,8 @@
 #include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/SpatialOSDispatcherInterface.h"
+#include "LoadBalancing/AbstractLBStrategy.h"
+#include "Schema/ServerWorker.h"
 #include "SpatialConstants.h"
 #include "Utils/SchemaUtils.h"
 
@@ -16,7 +18,12 @@ SpatialVirtualWorkerTranslationManager::SpatialVirtualWorkerTranslationManager(
 	: Receiver(InReceiver)
 	, Connection(InConnection)
 	, Translator(InTranslator)
+	, MappingVersion(0)
+	, bMappingChangedSinceLastUpdate(false)
 	, bWorkerEntityQueryInFlight(false)
+	, bIsAuthoritative(false)
+	, bWorkerLoadQueryInFlight(false)
+	, TimeSinceLoadsCollected(0.f)
 {}
 
 void SpatialVirtualWorkerTranslationManager::AddVirtualWorkerIds(const TSet<VirtualWorkerId>& InVirtualWorkerIds)
@@ -35,6 +42,7 @@ void SpatialVirtualWorkerTranslationManager::AuthorityChanged(const Worker_Autho
 	check(AuthOp.component_id == SpatialConstants::VIRTUAL_WORKER_TRANSLATION_COMPONENT_ID);
 
 	const bool bAuthoritative = AuthOp.authority == WORKER_AUTHORITY_AUTHORITATIVE;
+	bIsAuthoritative = bAuthoritative;
 
 	if (!bAuthoritative)
 	{
@@ -44,6 +52,10 @@ void SpatialVirtualWorkerTranslationManager::AuthorityChanged(const Worker_Autho
 
 	UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("This worker now has authority over the VirtualWorker translation."));
 
+	// Continue from the latest version this worker has applied, so that other workers accept the next update.
+	check(Translator != nullptr);
+	MappingVersion = FMath::Max(MappingVersion, Translator->GetMappingVersion());
+
 	// TODO(zoning): The prototype had an unassigned workers list. Need to follow up with Tim/Chris about whether
 	// that is necessary or we can continue to use the (possibly) stale list until we receive the query response.
 
@@ -52,15 +64,42 @@ void SpatialVirtualWorkerTranslationManager::AuthorityChanged(const Worker_Autho
 	QueryForServerWorkerEntities();
 }
 
-// For each entry in the map, write a VirtualWorkerMapping type object to the Schema object.
-void SpatialVirtualWorkerTranslationManager::WriteMappingToSchema(Schema_Object* Object) const
+// For each entry in the map, write a VirtualWorkerMapping type object to the Schema object, followed by the mapping version.
+// Without the mapping, the update only carries the current version, which receivers have already applied.
+void SpatialVirtualWorkerTranslationManager::WriteMappingToSchema(Schema_Object* Object, bool bIncludeMapping) const
 {
-	for (const auto& Entry : VirtualToPhysicalWorkerMapping)
+	if (bIncludeMapping)
+	{
+		for (const auto& Entry : VirtualToPhysicalWorkerMapping)
+		{
+			Schema_Object* EntryObject = Schema_AddObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID);
+			Schema_AddUint32(EntryObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID, Entry.Key);
+			SpatialGDK::AddStringToSchema(EntryObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME, Entry.Value.Key);
+			Schema_AddEntityId(EntryObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID, Entry.Value.Value);
+		}
+	}
+	Schema_AddUint32(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID, MappingVersion);
+
+	for (const auto& Entry : VirtualWorkerLoads)
+	{
+		Schema_Object* LoadObject = Schema_AddObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LOADS_ID);
+		Schema_AddUint32(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_VIRTUAL_WORKER_ID, Entry.Key);
+		Schema_AddUint32(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_AUTHORITATIVE_ACTOR_COUNT_ID, Entry.Value.AuthoritativeActorCount);
+		Schema_AddFloat(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_AVERAGE_FRAME_TIME_ID, Entry.Value.AverageFrameTime);
+		Schema_AddFloat(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_AVERAGE_REPLICATION_TIME_ID, Entry.Value.AverageReplicationTime);
+		Schema_AddFloat(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_RPCS_PER_SECOND_ID, Entry.Value.RPCsPerSecond);
+		SpatialGDK::AddUint32ToFloatMapToSchema(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_MIGRATIONS_PER_SECOND_ID, Entry.Value.MigrationsPerSecond);
+	}
+
+	const UAbstractLBStrategy* Strategy = Translator != nullptr ? Translator->GetLoadBalanceStrategy() : nullptr;
+	if (Strategy != nullptr)
 	{
-		Schema_Object* EntryObject = Schema_AddObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID);
-		Schema_AddUint32(EntryObject, SpatialConstants::MAPPING_VIRTUAL_WORKER_ID, Entry.Key);
-		SpatialGDK::AddStringToSchema(EntryObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME, Entry.Value.Key);
-		Schema_AddEntityId(EntryObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID, Entry.Value.Value);
+		TArray<uint8> Layout;
+		Strategy->WriteLayout(Layout);
+		if (Layout.Num() > 0)
+		{
+			SpatialGDK::AddBytesToSchema(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LAYOUT_ID, Layout.GetData(), Layout.Num());
+		}
 	}
 }
 
@@ -113,7 +152,16 @@ void SpatialVirtualWorkerTranslationManager::SendVirtualWorkerMappingUpdate()
 	Update.schema_type = Schema_CreateComponentUpdate();
 	Schema_Object* UpdateObject = Schema_GetComponentUpdateFields(Update.schema_type);
 
-	WriteMappingToSchema(UpdateObject);
+	// The mapping list is replaced as a whole by component updates, so it is only sent when an entry changed. Receivers
+	// diff it against their current mapping and only report the entries which changed.
+	const bool bIncludeMapping = bMappingChangedSinceLastUpdate;
+	if (bIncludeMapping)
+	{
+		++MappingVersion;
+		bMappingChangedSinceLastUpdate = false;
+	}
+
+	WriteMappingToSchema(UpdateObject, bIncludeMapping);
 
 	check(Connection != nullptr);
 	Connection->SendComponentUpdate(SpatialConstants::INITIAL_VIRTUAL_WORKER_TRANSLATOR_ENTITY_ID, &Update);
@@ -201,6 +249,109 @@ void SpatialVirtualWorkerTranslationManager::AssignWorker(const PhysicalWorkerNa
 
 	VirtualToPhysicalWorkerMapping.Add(Id, MakeTuple(Name, ServerWorkerEntityId));
 	PhysicalToVirtualWorkerMapping.Add(Name, Id);
+	bMappingChangedSinceLastUpdate = true;
 
 	UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("Assigned VirtualWorker %d to simulate on Worker %s"), Id, *Name);
 }
+
+void SpatialVirtualWorkerTranslationManager::Tick(float DeltaTime)
+{
+	const UAbstractLBStrategy* Strategy = Translator != nullptr ? Translator->GetLoadBalanceStrategy() : nullptr;
+	if (!bIsAuthoritative || Strategy == nullptr || Strategy->GetLoadReportInterval() <= 0.f)
+	{
+		return;
+	}
+
+	// Loads and layout changes are only published together with a complete mapping.
+	if (!UnassignedVirtualWorkers.IsEmpty() || bWorkerLoadQueryInFlight)
+	{
+		return;
+	}
+
+	TimeSinceLoadsCollected += DeltaTime;
+	if (TimeSinceLoadsCollected < Strategy->GetLoadReportInterval())
+	{
+		return;
+	}
+
+	TimeSinceLoadsCollected = 0.f;
+	QueryForServerWorkerLoads();
+}
+
+void SpatialVirtualWorkerTranslationManager::QueryForServerWorkerLoads()
+{
+	Worker_ComponentConstraint WorkerEntityComponentConstraint{};
+	WorkerEntityComponentConstraint.component_id = SpatialConstants::SERVER_WORKER_COMPONENT_ID;
+
+	Worker_Constraint WorkerEntityConstraint{};
+	WorkerEntityConstraint.constraint_type = WORKER_CONSTRAINT_TYPE_COMPONENT;
+	WorkerEntityConstraint.constraint.component_constraint = WorkerEntityComponentConstraint;
+
+	// Only the ServerWorker component is needed to read the loads.
+	Worker_ComponentId ServerWorkerComponentId = SpatialConstants::SERVER_WORKER_COMPONENT_ID;
+
+	Worker_EntityQuery WorkerEntityQuery{};
+	WorkerEntityQuery.constraint = WorkerEntityConstraint;
+	WorkerEntityQuery.result_type = WORKER_RESULT_TYPE_SNAPSHOT;
+	WorkerEntityQuery.snapshot_result_type_component_id_count = 1;
+	WorkerEntityQuery.snapshot_result_type_component_ids = &ServerWorkerComponentId;
+
+	check(Connection != nullptr);
+	Worker_RequestId RequestID = Connection->SendEntityQueryRequest(&WorkerEntityQuery);
+	bWorkerLoadQueryInFlight = true;
+
+	EntityQueryDelegate ServerWorkerLoadQueryDelegate;
+	ServerWorkerLoadQueryDelegate.BindRaw(this, &SpatialVirtualWorkerTranslationManager::ServerWorkerLoadQueryDelegate);
+	check(Receiver != nullptr);
+	Receiver->AddEntityQueryDelegate(RequestID, ServerWorkerLoadQueryDelegate);
+}
+
+void SpatialVirtualWorkerTranslationManager::ServerWorkerLoadQueryDelegate(const Worker_EntityQueryResponseOp& Op)
+{
+	bWorkerLoadQueryInFlight = false;
+
+	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
+	{
+		UE_LOG(LogSpatialVirtualWorkerTranslationManager, Warning, TEXT("Could not query server worker loads: %s"), UTF8_TO_TCHAR(Op.message));
+		return;
+	}
+
+	UAbstractLBStrategy* Strategy = Translator != nullptr ? Translator->GetLoadBalanceStrategy() : nullptr;
+	if (!bIsAuthoritative || Strategy == nullptr)
+	{
+		return;
+	}
+
+	VirtualWorkerLoads.Reset();
+	for (uint32_t i = 0; i < Op.result_count; ++i)
+	{
+		const Worker_Entity& Entity = Op.results[i];
+		for (uint32_t j = 0; j < Entity.component_count; j++)
+		{
+			const Worker_ComponentData& Data = Entity.components[j];
+			if (Data.component_id != SpatialConstants::SERVER_WORKER_COMPONENT_ID)
+			{
+				continue;
+			}
+
+			const SpatialGDK::ServerWorker ServerWorkerData(Data);
+			if (const VirtualWorkerId* Id = PhysicalToVirtualWorkerMapping.Find(ServerWorkerData.WorkerName))
+			{
+				FVirtualWorkerLoad& Load = VirtualWorkerLoads.Add(*Id);
+				Load.AuthoritativeActorCount = ServerWorkerData.AuthoritativeActorCount;
+				Load.AverageFrameTime = ServerWorkerData.AverageFrameTime;
+				Load.AverageReplicationTime = ServerWorkerData.AverageReplicationTime;
+				Load.RPCsPerSecond = ServerWorkerData.RPCsPerSecond;
+				Load.MigrationsPerSecond = ServerWorkerData.MigrationsPerSecond;
+			}
+		}
+	}
+
+	if (Strategy->UpdateLayout(VirtualWorkerLoads))
+	{
+		UE_LOG(LogSpatialVirtualWorkerTranslationManager, Log, TEXT("Load balancing layout changed, publishing translation update."));
+	}
+
+	// Publish the loads, so that strategies on every worker can query them.
+	SendVirtualWorkerMappingUpdate();
+}
@@ -10,6 +10,7 @@ DEFINE_LOG_CATEGORY(LogSpatialVirtualWorkerTranslator);
 SpatialVirtualWorkerTranslator::SpatialVirtualWorkerTranslator(UAbstractLBStrategy* InLoadBalanceStrategy,
 	PhysicalWorkerName InPhysicalWorkerName)
 	: LoadBalanceStrategy(InLoadBalanceStrategy)
+	, MappingVersion(0)
 	, bIsReady(false)
 	, LocalPhysicalWorkerName(InPhysicalWorkerName)
 	, LocalVirtualWorkerId(SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
@@ -41,11 +42,8 @@ void SpatialVirtualWorkerTranslator::ApplyVirtualWorkerManagerData(Schema_Object
 
 	// The translation schema is a list of Mappings, where each entry has a virtual and physical worker ID. 
 	ApplyMappingFromSchema(ComponentObject);
-
-	for (const auto& Entry : VirtualToPhysicalWorkerMapping)
-	{
-		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Translator assignment: Virtual Worker %d to %s with server worker entity: %lld"), Entry.Key, *(Entry.Value.Key), Entry.Value.Value);
-	}
+	ApplyLayoutFromSchema(ComponentObject);
+	ApplyLoadsFromSchema(ComponentObject);
 }
 
 // Check to see if this worker's physical worker name is in the mapping. If it isn't, it's possibly an old mapping.
@@ -79,16 +77,28 @@ bool SpatialVirtualWorkerTranslator::IsValidMapping(Schema_Object* Object) const
 // a worker first becomes authoritative for the mapping.
 void SpatialVirtualWorkerTranslator::ApplyMappingFromSchema(Schema_Object* Object)
 {
+	// Updates from the translation manager carry a version, and leave the mapping out if it hasn't changed. Mappings
+	// without a version are always applied.
+	const bool bIsVersioned = Schema_GetUint32Count(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID) > 0;
+	const uint32 ReceivedMappingVersion = bIsVersioned ? Schema_GetUint32(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID) : 0;
+	if (bIsVersioned && ReceivedMappingVersion <= MappingVersion)
+	{
+		UE_LOG(LogSpatialVirtualWorkerTranslator, Verbose, TEXT("(%d) Mapping version %u has already been received, current version: %u."), LocalVirtualWorkerId, ReceivedMappingVersion, MappingVersion);
+		return;
+	}
+
 	if (!IsValidMapping(Object))
 	{
 		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Received invalid mapping, likely due to PiE restart, will wait for a valid version."));
 		return;
 	}
 
-	// Resize the map to accept the new data.
-	VirtualToPhysicalWorkerMapping.Empty();
+	// Apply the mapping as a diff against the current one, so that only the entries which changed are reported.
+	TArray<VirtualWorkerId> ChangedVirtualWorkerIds;
+	TSet<VirtualWorkerId> ReceivedVirtualWorkerIds;
+
 	int32 TranslationCount = (int32)Schema_GetObjectCount(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_ID);
-	VirtualToPhysicalWorkerMapping.Reserve(TranslationCount);
+	ReceivedVirtualWorkerIds.Reserve(TranslationCount);
 
 	for (int32 i = 0; i < TranslationCount; i++)
 	{
@@ -98,13 +108,86 @@ void SpatialVirtualWorkerTranslator::ApplyMappingFromSchema(Schema_Object* Objec
 		PhysicalWorkerName PhysicalWorkerName = SpatialGDK::GetStringFromSchema(MappingObject, SpatialConstants::MAPPING_PHYSICAL_WORKER_NAME);
 		Worker_EntityId ServerWorkerEntityId = Schema_GetEntityId(MappingObject, SpatialConstants::MAPPING_SERVER_WORKER_ENTITY_ID);
 
-		// Insert each into the provided map.
-		UpdateMapping(VirtualWorkerId, PhysicalWorkerName, ServerWorkerEntityId);
+		ReceivedVirtualWorkerIds.Add(VirtualWorkerId);
+		if (UpdateMapping(VirtualWorkerId, PhysicalWorkerName, ServerWorkerEntityId))
+		{
+			UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Translator assignment: Virtual Worker %d to %s with server worker entity: %lld"), VirtualWorkerId, *PhysicalWorkerName, ServerWorkerEntityId);
+			ChangedVirtualWorkerIds.Add(VirtualWorkerId);
+		}
+	}
+
+	for (auto It = VirtualToPhysicalWorkerMapping.CreateIterator(); It; ++It)
+	{
+		if (!ReceivedVirtualWorkerIds.Contains(It.Key()))
+		{
+			UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("Translator assignment removed: Virtual Worker %d"), It.Key());
+			It.RemoveCurrent();
+		}
+	}
+
+	// Only remember the version once its mapping has been applied, so that a rejected mapping can still be applied if it is
+	// received again once it is valid.
+	if (bIsVersioned)
+	{
+		MappingVersion = ReceivedMappingVersion;
+	}
+
+	if (ChangedVirtualWorkerIds.Num() > 0)
+	{
+		OnMappingChanged.Broadcast(ChangedVirtualWorkerIds);
 	}
 }
 
-void SpatialVirtualWorkerTranslator::UpdateMapping(VirtualWorkerId Id, PhysicalWorkerName Name, Worker_EntityId ServerWorkerEntityId)
+// Strategies with a runtime layout (for example, UAdaptiveLBStrategy) publish it alongside the mapping.
+void SpatialVirtualWorkerTranslator::ApplyLayoutFromSchema(Schema_Object* Object)
 {
+	if (!LoadBalanceStrategy.IsValid() || Schema_GetBytesCount(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LAYOUT_ID) == 0)
+	{
+		return;
+	}
+
+	const uint32 LayoutLength = Schema_GetBytesLength(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LAYOUT_ID);
+	const uint8* LayoutBytes = Schema_GetBytes(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LAYOUT_ID);
+	if (LoadBalanceStrategy->ApplyLayout(TArray<uint8>(LayoutBytes, LayoutLength)))
+	{
+		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("(%d) Applied new load balancing layout"), LocalVirtualWorkerId);
+	}
+}
+
+// The translation manager publishes the loads of all server workers whenever it collects them.
+void SpatialVirtualWorkerTranslator::ApplyLoadsFromSchema(Schema_Object* Object)
+{
+	const int32 LoadCount = (int32)Schema_GetObjectCount(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LOADS_ID);
+	if (!LoadBalanceStrategy.IsValid() || LoadCount == 0)
+	{
+		return;
+	}
+
+	TMap<VirtualWorkerId, FVirtualWorkerLoad> VirtualWorkerLoads;
+	VirtualWorkerLoads.Reserve(LoadCount);
+
+	for (int32 i = 0; i < LoadCount; i++)
+	{
+		Schema_Object* LoadObject = Schema_IndexObject(Object, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LOADS_ID, i);
+		FVirtualWorkerLoad& Load = VirtualWorkerLoads.Add(Schema_GetUint32(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_VIRTUAL_WORKER_ID));
+		Load.AuthoritativeActorCount = Schema_GetUint32(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_AUTHORITATIVE_ACTOR_COUNT_ID);
+		Load.AverageFrameTime = Schema_GetFloat(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_AVERAGE_FRAME_TIME_ID);
+		Load.AverageReplicationTime = Schema_GetFloat(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_AVERAGE_REPLICATION_TIME_ID);
+		Load.RPCsPerSecond = Schema_GetFloat(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_RPCS_PER_SECOND_ID);
+		Load.MigrationsPerSecond = SpatialGDK::GetUint32ToFloatMapFromSchema(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_MIGRATIONS_PER_SECOND_ID);
+	}
+
+	LoadBalanceStrategy->SetVirtualWorkerLoads(MoveTemp(VirtualWorkerLoads));
+}
+
+bool SpatialVirtualWorkerTranslator::UpdateMapping(VirtualWorkerId Id, PhysicalWorkerName Name, Worker_EntityId ServerWorkerEntityId)
+{
+	const TPair<PhysicalWorkerName, Worker_EntityId>* ExistingEntry = VirtualToPhysicalWorkerMapping.Find(Id);
+	if (ExistingEntry != nullptr && ExistingEntry->Key == Name && ExistingEntry->Value == ServerWorkerEntityId)
+	{
+		return false;
+	}
+
 	VirtualToPhysicalWorkerMapping.Add(Id, MakeTuple(Name, ServerWorkerEntityId));
 
 	if (LocalVirtualWorkerId == SpatialConstants::INVALID_VIRTUAL_WORKER_ID && Name == LocalPhysicalWorkerName)
@@ -121,4 +204,6 @@ void SpatialVirtualWorkerTranslator::UpdateMapping(VirtualWorkerId Id, PhysicalW
 
 		UE_LOG(LogSpatialVirtualWorkerTranslator, Log, TEXT("VirtualWorkerTranslator is now ready for loadbalancing."));
 	}
+
+	return true;
 }
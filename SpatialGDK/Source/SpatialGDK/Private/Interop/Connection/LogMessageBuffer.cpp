@@ -0,0 +1,147 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/LogMessageBuffer.h"
+
+#include "Containers/StringConv.h"
+#include "Misc/ScopeLock.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace
+{
+// Rough size of the " (repeated N times)" suffix added to merged messages.
+constexpr int32 RepeatSuffixCost = 32;
+} // anonymous namespace
+
+namespace SpatialGDK
+{
+
+FLogMessageBuffer::FLogMessageBuffer(uint32 InBytesPerSecond, int32 InMaxBufferedMessages)
+	: BytesPerSecond(InBytesPerSecond)
+	, MaxBufferedMessages(FMath::Max(InMaxBufferedMessages, 1))
+	, AvailableBytes(InBytesPerSecond)
+{
+}
+
+void FLogMessageBuffer::Add(uint8 Level, const FName& LoggerName, const TCHAR* Message)
+{
+	FScopeLock Lock(&Mutex);
+
+	FLogMessageKey Key{ Level, LoggerName, Message };
+	if (const int64* PendingIndex = PendingIndexByMessage.Find(Key))
+	{
+		PendingMessages[*PendingIndex - PendingIndexOffset].Repeats++;
+		return;
+	}
+
+	// Fatal messages are always kept, since they are usually the last thing a worker logs.
+	if (PendingMessages.Num() >= MaxBufferedMessages && Level != WORKER_LOG_LEVEL_FATAL)
+	{
+		TotalDroppedMessages++;
+		DroppedMessagesToReport++;
+		return;
+	}
+
+	FBufferedLogMessage& Added = PendingMessages.AddDefaulted_GetRef();
+	Added.Level = Level;
+	Added.LoggerName = LoggerName;
+	Added.Message = Key.Message;
+	Added.Repeats = 1;
+
+	PendingIndexByMessage.Add(MoveTemp(Key), PendingIndexOffset + PendingMessages.Num() - 1);
+}
+
+void FLogMessageBuffer::Flush(double CurrentTime, FSendLogMessageFunction SendLogMessage)
+{
+	TArray<FBufferedLogMessage> MessagesToSend;
+	int64 DroppedMessages = 0;
+
+	{
+		FScopeLock Lock(&Mutex);
+
+		if (BytesPerSecond > 0)
+		{
+			if (LastFlushTime >= 0.0)
+			{
+				AvailableBytes = FMath::Min<double>(BytesPerSecond, AvailableBytes + (CurrentTime - LastFlushTime) * BytesPerSecond);
+			}
+			LastFlushTime = CurrentTime;
+		}
+
+		int32 NumToSend = 0;
+		for (const FBufferedLogMessage& Pending : PendingMessages)
+		{
+			// The budget is in bytes of the UTF-8 string sent to the worker, not in characters.
+			const int32 Cost = FTCHARToUTF8(*Pending.Message).Length() + (Pending.Repeats > 1 ? RepeatSuffixCost : 0);
+
+			// A message larger than the whole budget is still sent once the budget is full, so it can't block the buffer.
+			if (BytesPerSecond > 0 && Cost > AvailableBytes && AvailableBytes < BytesPerSecond)
+			{
+				break;
+			}
+
+			if (BytesPerSecond > 0)
+			{
+				AvailableBytes -= Cost;
+			}
+
+			// Every pending message has its own key, so it can be removed unconditionally.
+			PendingIndexByMessage.Remove(FLogMessageKey{ Pending.Level, Pending.LoggerName, Pending.Message });
+
+			NumToSend++;
+		}
+
+		if (NumToSend > 0)
+		{
+			MessagesToSend.Reserve(NumToSend);
+			for (int32 i = 0; i < NumToSend; i++)
+			{
+				MessagesToSend.Add(MoveTemp(PendingMessages[i]));
+			}
+			PendingMessages.RemoveAt(0, NumToSend, /* bAllowShrinking */ false);
+			PendingIndexOffset += NumToSend;
+		}
+
+		if (DroppedMessagesToReport > 0 && (BytesPerSecond == 0 || AvailableBytes > 0))
+		{
+			DroppedMessages = DroppedMessagesToReport;
+			DroppedMessagesToReport = 0;
+		}
+	}
+
+	// Send outside the lock so that threads adding messages are not blocked on the connection.
+	for (const FBufferedLogMessage& Message : MessagesToSend)
+	{
+		SendLogMessage(Message.Level, Message.LoggerName, FormatMessage(Message));
+	}
+
+	if (DroppedMessages > 0)
+	{
+		static const FName LoggerName(TEXT("SpatialLogMessageBuffer"));
+		SendLogMessage(WORKER_LOG_LEVEL_WARN, LoggerName,
+			FString::Printf(TEXT("Dropped %lld log messages because the log forwarding buffer was full."), DroppedMessages));
+	}
+}
+
+int32 FLogMessageBuffer::GetNumBufferedMessages() const
+{
+	FScopeLock Lock(&Mutex);
+	return PendingMessages.Num();
+}
+
+int64 FLogMessageBuffer::GetNumDroppedMessages() const
+{
+	FScopeLock Lock(&Mutex);
+	return TotalDroppedMessages;
+}
+
+FString FLogMessageBuffer::FormatMessage(const FBufferedLogMessage& BufferedMessage)
+{
+	if (BufferedMessage.Repeats > 1)
+	{
+		return FString::Printf(TEXT("%s (repeated %u times)"), *BufferedMessage.Message, BufferedMessage.Repeats);
+	}
+	return BufferedMessage.Message;
+}
+
+} // namespace SpatialGDK
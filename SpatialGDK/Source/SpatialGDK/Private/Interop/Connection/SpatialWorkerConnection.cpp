@@ -3,6 +3,8 @@
 #include "Interop/Connection/SpatialWorkerConnection.h"
 
 #include "Async/Async.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
 #include "SpatialGDKSettings.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialWorkerConnection);
@@ -14,8 +16,14 @@ void USpatialWorkerConnection::SetConnection(Worker_Connection* WorkerConnection
 	WorkerConnection = WorkerConnectionIn;
 
 	CacheWorkerAttributes();
+	InitializeOpListRecording();
 
 	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();    
+	if (!LogMessageBuffer.IsValid())
+	{
+		LogMessageBuffer = MakeUnique<FLogMessageBuffer>(SpatialGDKSettings->WorkerLogBytesPerSecond, SpatialGDKSettings->MaxBufferedWorkerLogMessages);
+	}
+
 	if (!SpatialGDKSettings->bRunSpatialWorkerConnectionOnGameThread)  
 	{
 		if (OpsProcessingThread == nullptr)
@@ -43,8 +51,13 @@ void USpatialWorkerConnection::DestroyConnection()
 		OpsProcessingThread = nullptr;
 	}
 
+	OpListRecorder.Reset();
+
 	if (WorkerConnection)
 	{
+		// Give buffered logs one last chance to go out, within the remaining budget.
+		FlushLogMessages();
+
 		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WorkerConnection = WorkerConnection]
 		{
 			Worker_Connection_Destroy(WorkerConnection);
@@ -121,7 +134,14 @@ void USpatialWorkerConnection::SendCommandFailure(Worker_RequestId RequestId, co
 
 void USpatialWorkerConnection::SendLogMessage(const uint8_t Level, const FName& LoggerName, const TCHAR* Message)
 {
-	QueueOutgoingMessage<FLogMessage>(Level, LoggerName, Message);
+	if (LogMessageBuffer.IsValid())
+	{
+		LogMessageBuffer->Add(Level, LoggerName, Message);
+	}
+	else
+	{
+		QueueOutgoingMessage<FLogMessage>(Level, LoggerName, Message);
+	}
 }
 
 void USpatialWorkerConnection::SendComponentInterest(Worker_EntityId EntityId, TArray<Worker_InterestOverride>&& ComponentInterest)
@@ -202,11 +222,35 @@ void USpatialWorkerConnection::InitializeOpsProcessingThread()
 	check(OpsProcessingThread);
 }
 
+void USpatialWorkerConnection::InitializeOpListRecording()
+{
+	FString RecordingDirectory;
+	if (OpListRecorder.IsValid() || !FParse::Value(FCommandLine::Get(), TEXT("RecordOpLists="), RecordingDirectory))
+	{
+		return;
+	}
+
+	const FString RecordingPath = FPaths::Combine(RecordingDirectory, GetWorkerId() + TEXT(".oplist"));
+	OpListRecorder = SpatialGDK::OpListRecorder::CreateForFile(RecordingPath);
+	if (OpListRecorder.IsValid())
+	{
+		UE_LOG(LogSpatialWorkerConnection, Log, TEXT("Recording received op lists to %s"), *RecordingPath);
+	}
+	else
+	{
+		UE_LOG(LogSpatialWorkerConnection, Error, TEXT("Failed to open %s for op list recording"), *RecordingPath);
+	}
+}
+
 void USpatialWorkerConnection::QueueLatestOpList()
 {
 	Worker_OpList* OpList = Worker_Connection_GetOpList(WorkerConnection, 0);
 	if (OpList->op_count > 0)
 	{
+		if (OpListRecorder.IsValid())
+		{
+			OpListRecorder->RecordOpList(*OpList);
+		}
 		OpListQueue.Enqueue(OpList);
 	}
 	else
@@ -215,8 +259,38 @@ void USpatialWorkerConnection::QueueLatestOpList()
 	}
 }
 
+void USpatialWorkerConnection::FlushLogMessages()
+{
+	if (!LogMessageBuffer.IsValid())
+	{
+		return;
+	}
+
+	LogMessageBuffer->Flush(FPlatformTime::Seconds(), [this](uint8 Level, const FName& LoggerName, const FString& Message)
+	{
+		// Buffered messages bypass the outgoing message queue, so they are passed to OnDequeueMessage here instead,
+		// as they are sent. This is once per merged message, not once per SendLogMessage call.
+		if (OnDequeueMessage.IsBound())
+		{
+			const FLogMessage OutgoingMessage(Level, LoggerName, Message);
+			OnDequeueMessage.Broadcast(&OutgoingMessage);
+		}
+
+		FTCHARToUTF8 LoggerNameString(*LoggerName.ToString());
+		FTCHARToUTF8 LogString(*Message);
+
+		Worker_LogMessage LogMessage{};
+		LogMessage.level = Level;
+		LogMessage.logger_name = LoggerNameString.Get();
+		LogMessage.message = LogString.Get();
+		Worker_Connection_SendLogMessage(WorkerConnection, &LogMessage);
+	});
+}
+
 void USpatialWorkerConnection::ProcessOutgoingMessages()
 {
+	FlushLogMessages();
+
 	while (!OutgoingMessagesQueue.IsEmpty())
 	{
 		TUniquePtr<FOutgoingMessage> OutgoingMessage;
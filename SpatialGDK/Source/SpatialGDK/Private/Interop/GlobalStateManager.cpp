@@ -623,18 +623,17 @@ void UGlobalStateManager::BecomeAuthoritativeOverAllActors()
 
 void UGlobalStateManager::BecomeAuthoritativeOverActorsBasedOnLBStrategy()
 {
+	TArray<AActor*> Actors;
 	for (TActorIterator<AActor> It(NetDriver->World); It; ++It)
 	{
 		AActor* Actor = *It;
 		if (Actor != nullptr && !Actor->IsPendingKill())
 		{
-			if (Actor->GetIsReplicated() && NetDriver->LoadBalanceStrategy->ShouldHaveAuthority(*Actor))
-			{
-				Actor->Role = ROLE_Authority;
-				Actor->RemoteRole = ROLE_SimulatedProxy;
-			}
+			Actors.Add(Actor);
 		}
 	}
+
+	NetDriver->BecomeAuthoritativeOverActorsBasedOnLBStrategy(Actors);
 }
 
 void UGlobalStateManager::TriggerBeginPlay()
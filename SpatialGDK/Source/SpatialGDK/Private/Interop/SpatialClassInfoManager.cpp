@@ -40,6 +40,12 @@ bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver, SpatialAc
 		return false;
 	}
 
+	LevelNameToComponentId.Reserve(SchemaDatabase->LevelPathToComponentId.Num());
+	for (const auto& LevelPathAndComponentId : SchemaDatabase->LevelPathToComponentId)
+	{
+		LevelNameToComponentId.Add(FName(*LevelPathAndComponentId.Key), LevelPathAndComponentId.Value);
+	}
+
 	return true;
 }
 
@@ -475,6 +481,18 @@ Worker_ComponentId USpatialClassInfoManager::GetComponentIdFromLevelPath(const F
 	return SpatialConstants::INVALID_COMPONENT_ID;
 }
 
+Worker_ComponentId USpatialClassInfoManager::GetComponentIdFromLevelName(const FName& LevelName)
+{
+	if (const Worker_ComponentId* ComponentId = LevelNameToComponentId.Find(LevelName))
+	{
+		return *ComponentId;
+	}
+
+	const Worker_ComponentId ComponentId = GetComponentIdFromLevelPath(LevelName.ToString());
+	LevelNameToComponentId.Add(LevelName, ComponentId);
+	return ComponentId;
+}
+
 bool USpatialClassInfoManager::IsSublevelComponent(Worker_ComponentId ComponentId) const
 {
 	return SchemaDatabase->LevelComponentIds.Contains(ComponentId);
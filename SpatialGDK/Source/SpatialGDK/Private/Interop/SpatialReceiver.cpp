@@ -547,6 +547,12 @@ void USpatialReceiver::HandleActorAuthority(const Worker_AuthorityChangeOp& Op)
 		NetDriver->SpatialDebugger->ActorAuthorityChanged(Op);
 	}
 
+	// Another worker may update the interest while this one isn't authoritative over it.
+	if (Op.component_id == SpatialConstants::INTEREST_COMPONENT_ID && Op.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE && NetDriver->InterestFactory.IsValid())
+	{
+		NetDriver->InterestFactory->ForgetSentInterest(Op.entity_id);
+	}
+
 	AActor* Actor = Cast<AActor>(NetDriver->PackageMap->GetObjectFromEntityId(Op.entity_id));
 	if (Actor == nullptr)
 	{
@@ -29,6 +29,7 @@
 #include "Utils/EntityFactory.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/RepLayoutUtils.h"
+#include "Utils/RPCRingBuffer.h"
 #include "Utils/SpatialActorGroupManager.h"
 #include "Utils/SpatialActorUtils.h"
 #include "Utils/SpatialDebugger.h"
@@ -44,9 +45,27 @@ DECLARE_CYCLE_STAT(TEXT("Sender SendComponentUpdates"), STAT_SpatialSenderSendCo
 DECLARE_CYCLE_STAT(TEXT("Sender ResetOutgoingUpdate"), STAT_SpatialSenderResetOutgoingUpdate, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Sender QueueOutgoingUpdate"), STAT_SpatialSenderQueueOutgoingUpdate, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Sender UpdateInterestComponent"), STAT_SpatialSenderUpdateInterestComponent, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("Sender ProcessInterestBucketComponentChanges"), STAT_SpatialSenderProcessInterestBucketComponentChanges, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("Sender ProcessPendingInterestUpdates"), STAT_SpatialSenderProcessPendingInterestUpdates, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Sender FlushRetryRPCs"), STAT_SpatialSenderFlushRetryRPCs, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("Sender SendRPC"), STAT_SpatialSenderSendRPC, STATGROUP_SpatialNet);
 
+#if !UE_BUILD_SHIPPING
+namespace
+{
+uint32 GetComponentDataSize(const Worker_ComponentData& Data)
+{
+	return Schema_GetWriteBufferLength(Schema_GetComponentDataFields(Data.schema_type));
+}
+
+uint32 GetComponentUpdateSize(const Worker_ComponentUpdate& Update)
+{
+	return Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(Update.schema_type)) +
+		Schema_GetWriteBufferLength(Schema_GetComponentUpdateEvents(Update.schema_type));
+}
+} // anonymous namespace
+#endif // !UE_BUILD_SHIPPING
+
 FReliableRPCForRetry::FReliableRPCForRetry(UObject* InTargetObject, UFunction* InFunction, Worker_ComponentId InComponentId, Schema_FieldId InRPCIndex, const TArray<uint8>& InPayload, int InRetryIndex)
 	: TargetObject(InTargetObject)
 	, Function(InFunction)
@@ -84,6 +103,10 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel, uin
 
 	ComponentDatas.Add(ComponentPresence(EntityFactory::GetComponentPresenceList(ComponentDatas)).CreateComponentPresenceData());
 
+#if !UE_BUILD_SHIPPING
+	TrackEntityCreation(Channel->Actor, ComponentDatas);
+#endif // !UE_BUILD_SHIPPING
+
 	Worker_EntityId EntityId = Channel->GetEntityId();
 	Worker_RequestId CreateEntityRequestId = Connection->SendCreateEntityRequest(MoveTemp(ComponentDatas), &EntityId);
 
@@ -401,35 +424,46 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 
 	TArray<FWorkerComponentUpdate> ComponentUpdates = UpdateFactory.CreateComponentUpdates(Object, Info, EntityId, RepChanges, HandoverChanges, OutBytesWritten);
 
-	for(int i = 0; i < ComponentUpdates.Num(); i++)
+	for (const FWorkerComponentUpdate& Update : ComponentUpdates)
 	{
-		FWorkerComponentUpdate& Update = ComponentUpdates[i];
-		if (!NetDriver->StaticComponentView->HasAuthority(EntityId, Update.component_id))
-		{
-			UE_LOG(LogSpatialSender, Verbose, TEXT("Trying to send component update but don't have authority! Update will be queued and sent when authority gained. Component Id: %d, entity: %lld"), Update.component_id, EntityId);
+		SendOrQueueComponentUpdate(Object, EntityId, Update);
+	}
+}
 
-			// This is a temporary fix. A task to improve this has been created: UNR-955
-			// It may be the case that upon resolving a component, we do not have authority to send the update. In this case, we queue the update, to send upon receiving authority.
-			// Note: This will break in a multi-worker context, if we try to create an entity that we don't intend to have authority over. For this reason, this fix is only temporary.
-			TArray<FWorkerComponentUpdate>& UpdatesQueuedUntilAuthority = UpdatesQueuedUntilAuthorityMap.FindOrAdd(EntityId);
-			UpdatesQueuedUntilAuthority.Add(Update);
-			continue;
-		}
+void USpatialSender::SendOrQueueComponentUpdate(UObject* Object, Worker_EntityId EntityId, const FWorkerComponentUpdate& Update)
+{
+	if (!NetDriver->StaticComponentView->HasAuthority(EntityId, Update.component_id))
+	{
+		UE_LOG(LogSpatialSender, Verbose, TEXT("Trying to send component update but don't have authority! Update will be queued and sent when authority gained. Component Id: %d, entity: %lld"), Update.component_id, EntityId);
 
-		Connection->SendComponentUpdate(EntityId, &Update);
+		// This is a temporary fix. A task to improve this has been created: UNR-955
+		// It may be the case that upon resolving a component, we do not have authority to send the update. In this case, we queue the update, to send upon receiving authority.
+		// Note: This will break in a multi-worker context, if we try to create an entity that we don't intend to have authority over. For this reason, this fix is only temporary.
+		TArray<FUpdateQueuedUntilAuthority>& UpdatesQueuedUntilAuthority = UpdatesQueuedUntilAuthorityMap.FindOrAdd(EntityId);
+		UpdatesQueuedUntilAuthority.Add(FUpdateQueuedUntilAuthority{ Update, Object->GetClass() });
+		return;
 	}
+
+#if !UE_BUILD_SHIPPING
+	TrackComponentUpdate(Object->GetClass(), Update);
+#endif // !UE_BUILD_SHIPPING
+
+	Connection->SendComponentUpdate(EntityId, &Update);
 }
 
 // Apply (and clean up) any updates queued, due to being sent previously when they didn't have authority.
 void USpatialSender::ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
 {
-	if (TArray<FWorkerComponentUpdate>* UpdatesQueuedUntilAuthority = UpdatesQueuedUntilAuthorityMap.Find(EntityId))
+	if (TArray<FUpdateQueuedUntilAuthority>* UpdatesQueuedUntilAuthority = UpdatesQueuedUntilAuthorityMap.Find(EntityId))
 	{
 		for (auto It = UpdatesQueuedUntilAuthority->CreateIterator(); It; It++)
 		{
-			if (ComponentId == It->component_id)
+			if (ComponentId == It->Update.component_id)
 			{
-				Connection->SendComponentUpdate(EntityId, &(*It));
+#if !UE_BUILD_SHIPPING
+				TrackComponentUpdate(It->ObjectClass.Get(), It->Update);
+#endif // !UE_BUILD_SHIPPING
+				Connection->SendComponentUpdate(EntityId, &It->Update);
 				It.RemoveCurrent();
 			}
 		}
@@ -551,6 +585,63 @@ void USpatialSender::SendInterestBucketComponentChange(const Worker_EntityId Ent
 	}
 }
 
+void USpatialSender::QueueInterestBucketComponentChange(const Worker_EntityId EntityId, const Worker_ComponentId OldComponent, const Worker_ComponentId NewComponent)
+{
+	if (FInterestBucketChange* PendingChange = PendingInterestBucketChanges.Find(EntityId))
+	{
+		PendingChange->NewComponent = NewComponent;
+		PendingChange->NumRequested++;
+		return;
+	}
+
+	PendingInterestBucketChanges.Add(EntityId, FInterestBucketChange{ OldComponent, NewComponent, 1 });
+}
+
+void USpatialSender::ProcessInterestBucketComponentChanges()
+{
+	if (PendingInterestBucketChanges.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderProcessInterestBucketComponentChanges);
+
+	int32 NumRequested = 0;
+	int32 NumSent = 0;
+	int32 NumDropped = 0;
+
+	for (const auto& EntityChangePair : PendingInterestBucketChanges)
+	{
+		const Worker_EntityId EntityId = EntityChangePair.Key;
+		const FInterestBucketChange& Change = EntityChangePair.Value;
+
+		NumRequested += Change.NumRequested;
+
+		// The entity ended up back in the bucket it started the frame in.
+		if (Change.OldComponent == Change.NewComponent)
+		{
+			continue;
+		}
+
+		if (!StaticComponentView->HasAuthority(EntityId, SpatialConstants::POSITION_COMPONENT_ID))
+		{
+			UE_LOG(LogSpatialSender, Log, TEXT("Dropping interest bucket change for entity %lld, which this worker is no longer authoritative over."), EntityId);
+			NumDropped += Change.NumRequested;
+			continue;
+		}
+
+		SendInterestBucketComponentChange(EntityId, Change.OldComponent, Change.NewComponent);
+		NumSent++;
+	}
+
+	PendingInterestBucketChanges.Reset();
+
+	if (NetDriver->SpatialMetrics != nullptr)
+	{
+		NetDriver->SpatialMetrics->TrackInterestBucketChanges(NumRequested, NumSent, NumDropped);
+	}
+}
+
 void USpatialSender::SendComponentInterestForSubobject(const FClassInfo& Info, Worker_EntityId EntityId, bool bNetOwned)
 {
 	checkf(!NetDriver->IsServer(), TEXT("Tried to set ComponentInterest on a server-worker. This should never happen!"));
@@ -617,24 +708,41 @@ void USpatialSender::SetAclWriteAuthority(const SpatialLoadBalanceEnforcer::AclW
 	const WorkerAttributeSet OwningServerWorkerAttributeSet = { WriteWorkerId };
 
 	EntityAcl* NewAcl = StaticComponentView->GetComponentData<EntityAcl>(Request.EntityId);
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const Worker_ComponentId ClientAuthorityComponentId = SpatialConstants::GetClientAuthorityComponent(SpatialGDKSettings->UseRPCRingBuffer());
+	const WorkerRequirementSet LoadBalancerRequirementSet = { SpatialConstants::GetLoadBalancerAttributeSet(SpatialGDKSettings->LoadBalancingWorkerType.WorkerTypeName) };
+	const WorkerRequirementSet OwningServerRequirementSet = { OwningServerWorkerAttributeSet };
+
+	bool bAclChanged = !(NewAcl->ReadAcl == Request.ReadAcl);
 	NewAcl->ReadAcl = Request.ReadAcl;
 
 	for (const Worker_ComponentId& ComponentId : Request.ComponentIds)
 	{
-		if (ComponentId == SpatialConstants::HEARTBEAT_COMPONENT_ID
-			|| ComponentId == SpatialConstants::GetClientAuthorityComponent(GetDefault<USpatialGDKSettings>()->UseRPCRingBuffer()))
+		const WorkerRequirementSet* RequirementSet = &OwningServerRequirementSet;
+		if (ComponentId == SpatialConstants::HEARTBEAT_COMPONENT_ID || ComponentId == ClientAuthorityComponentId)
 		{
-			NewAcl->ComponentWriteAcl.Add(ComponentId, Request.ClientRequirementSet);
-			continue;
+			RequirementSet = &Request.ClientRequirementSet;
+		}
+		else if (ComponentId == SpatialConstants::ENTITY_ACL_COMPONENT_ID)
+		{
+			RequirementSet = &LoadBalancerRequirementSet;
 		}
 
-		if (ComponentId == SpatialConstants::ENTITY_ACL_COMPONENT_ID)
+		WorkerRequirementSet* ExistingRequirementSet = NewAcl->ComponentWriteAcl.Find(ComponentId);
+		if (ExistingRequirementSet == nullptr || !(*ExistingRequirementSet == *RequirementSet))
 		{
-			NewAcl->ComponentWriteAcl.Add(ComponentId, { SpatialConstants::GetLoadBalancerAttributeSet(GetDefault<USpatialGDKSettings>()->LoadBalancingWorkerType.WorkerTypeName) });
-			continue;
+			NewAcl->ComponentWriteAcl.Add(ComponentId, *RequirementSet);
+			bAclChanged = true;
 		}
+	}
 
-		NewAcl->ComponentWriteAcl.Add(ComponentId, { OwningServerWorkerAttributeSet });
+	// Several requests for the same entity can resolve to the ACL it already has, for example when an intent is changed
+	// and changed back before the request is processed. Skip the update in that case.
+	if (!bAclChanged)
+	{
+		UE_LOG(LogSpatialLoadBalanceEnforcer, Verbose, TEXT("(%s) Acl WriteAuth for entity %lld is already set to %s"), *NetDriver->Connection->GetWorkerId(), Request.EntityId, *Request.OwningWorkerId);
+		return;
 	}
 
 	UE_LOG(LogSpatialLoadBalanceEnforcer, Verbose, TEXT("(%s) Setting Acl WriteAuth for entity %lld to %s"), *NetDriver->Connection->GetWorkerId(), Request.EntityId, *Request.OwningWorkerId);
@@ -695,6 +803,59 @@ void USpatialSender::TrackRPC(AActor* Actor, UFunction* Function, const RPCPaylo
 {
 	NETWORK_PROFILER(GNetworkProfiler.TrackSendRPC(Actor, Function, 0, Payload.CountDataBits(), 0, NetDriver->GetSpatialOSNetConnection()));
 	NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCType, Payload.PayloadData.Num());
+
+	USpatialMetrics* SpatialMetrics = NetDriver->SpatialMetrics;
+	if (SpatialMetrics->IsBandwidthTrackingEnabled())
+	{
+		Worker_ComponentId ComponentId = SpatialConstants::INVALID_COMPONENT_ID;
+		if (RPCType == ERPCType::CrossServer)
+		{
+			ComponentId = SpatialConstants::SERVER_TO_SERVER_COMMAND_ENDPOINT_COMPONENT_ID;
+		}
+		else if (GetDefault<USpatialGDKSettings>()->UseRPCRingBuffer() && RPCService != nullptr)
+		{
+			ComponentId = RPCRingBufferUtils::GetRingBufferComponentId(RPCType);
+		}
+		else
+		{
+			ComponentId = SpatialConstants::RPCTypeToWorkerComponentIdLegacy(RPCType);
+		}
+
+		const uint32 PayloadBytes = Payload.PayloadData.Num();
+		SpatialMetrics->TrackSentClassBandwidth(Actor->GetClass(), EBandwidthCategory::RPC, PayloadBytes);
+		SpatialMetrics->TrackSentComponentBandwidth(ComponentId, EBandwidthCategory::RPC, PayloadBytes);
+	}
+}
+
+void USpatialSender::TrackComponentUpdate(const UClass* ObjectClass, const Worker_ComponentUpdate& Update)
+{
+	USpatialMetrics* SpatialMetrics = NetDriver->SpatialMetrics;
+	if (!SpatialMetrics->IsBandwidthTrackingEnabled())
+	{
+		return;
+	}
+
+	const uint32 UpdateBytes = GetComponentUpdateSize(Update);
+	SpatialMetrics->TrackSentClassBandwidth(ObjectClass, EBandwidthCategory::ComponentUpdate, UpdateBytes);
+	SpatialMetrics->TrackSentComponentBandwidth(Update.component_id, EBandwidthCategory::ComponentUpdate, UpdateBytes);
+}
+
+void USpatialSender::TrackEntityCreation(AActor* Actor, const TArray<FWorkerComponentData>& ComponentDatas)
+{
+	USpatialMetrics* SpatialMetrics = NetDriver->SpatialMetrics;
+	if (!SpatialMetrics->IsBandwidthTrackingEnabled())
+	{
+		return;
+	}
+
+	uint32 EntityBytes = 0;
+	for (const FWorkerComponentData& ComponentData : ComponentDatas)
+	{
+		const uint32 ComponentBytes = GetComponentDataSize(ComponentData);
+		SpatialMetrics->TrackSentComponentBandwidth(ComponentData.component_id, EBandwidthCategory::EntityCreation, ComponentBytes);
+		EntityBytes += ComponentBytes;
+	}
+	SpatialMetrics->TrackSentClassBandwidth(Actor->GetClass(), EBandwidthCategory::EntityCreation, EntityBytes);
 }
 #endif
 
@@ -1094,9 +1255,104 @@ void USpatialSender::UpdateInterestComponent(AActor* Actor)
 		return;
 	}
 
-	FWorkerComponentUpdate Update = NetDriver->InterestFactory->CreateInterestUpdate(Actor, ClassInfoManager->GetOrCreateClassInfoByObject(Actor), EntityId);
+	FWorkerComponentUpdate Update = {};
+	if (NetDriver->InterestFactory->CreateInterestUpdate(Actor, ClassInfoManager->GetOrCreateClassInfoByObject(Actor), EntityId, Update))
+	{
+		Connection->SendComponentUpdate(EntityId, &Update);
+	}
+}
 
-	Connection->SendComponentUpdate(EntityId, &Update);
+bool USpatialSender::ShouldQueueInterestUpdates() const
+{
+	// Pending interest updates are processed after server replication, so clients always send them immediately.
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	return NetDriver->IsServer() && (SpatialGDKSettings->InterestUpdateDebounceTime > 0.f || SpatialGDKSettings->MaxInterestUpdatesPerTick > 0);
+}
+
+void USpatialSender::QueueInterestUpdate(AActor* Actor)
+{
+	if (!ShouldQueueInterestUpdates())
+	{
+		UpdateInterestComponent(Actor);
+		return;
+	}
+
+	Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(Actor);
+	if (EntityId == SpatialConstants::INVALID_ENTITY_ID)
+	{
+		UE_LOG(LogSpatialSender, Verbose, TEXT("Attempted to queue interest update for non replicated actor: %s"), *GetNameSafe(Actor));
+		return;
+	}
+
+	// Later requests are merged into the pending one, which keeps its age.
+	if (!PendingInterestUpdates.Contains(EntityId))
+	{
+		PendingInterestUpdates.Add(EntityId, FPendingInterestUpdate{ Actor, NetDriver->Time });
+	}
+}
+
+void USpatialSender::ProcessPendingInterestUpdates()
+{
+	if (PendingInterestUpdates.Num() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderProcessPendingInterestUpdates);
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	for (AActor* Actor : TakeInterestUpdatesToSend(PendingInterestUpdates, NetDriver->Time, SpatialGDKSettings->InterestUpdateDebounceTime, SpatialGDKSettings->MaxInterestUpdatesPerTick))
+	{
+		UpdateInterestComponent(Actor);
+	}
+}
+
+TArray<AActor*> USpatialSender::TakeInterestUpdatesToSend(FPendingInterestUpdates& PendingUpdates, float CurrentTime, float DebounceTime, int32 MaxUpdates)
+{
+	const float ReadyTime = CurrentTime - DebounceTime;
+
+	TArray<TPair<Worker_EntityId, float>> ReadyUpdates;
+	for (auto It = PendingUpdates.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Actor.IsValid())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (It.Value().FirstRequestTime <= ReadyTime)
+		{
+			ReadyUpdates.Emplace(It.Key(), It.Value().FirstRequestTime);
+		}
+	}
+
+	int32 NumToSend = ReadyUpdates.Num();
+	if (MaxUpdates > 0 && NumToSend > MaxUpdates)
+	{
+		NumToSend = MaxUpdates;
+		ReadyUpdates.Sort([](const TPair<Worker_EntityId, float>& Lhs, const TPair<Worker_EntityId, float>& Rhs)
+		{
+			return Lhs.Value < Rhs.Value;
+		});
+
+		UE_LOG(LogSpatialSender, Verbose, TEXT("Interest update budget reached, deferring %d interest updates to later ticks."), ReadyUpdates.Num() - NumToSend);
+	}
+
+	TArray<AActor*> ActorsToUpdate;
+	for (int32 i = 0; i < NumToSend; i++)
+	{
+		const Worker_EntityId EntityId = ReadyUpdates[i].Key;
+		AActor* Actor = PendingUpdates.FindChecked(EntityId).Actor.Get();
+		PendingUpdates.Remove(EntityId);
+
+		// Another worker is responsible for the interest of Actors this worker is no longer authoritative over.
+		if (Actor->HasAuthority())
+		{
+			ActorsToUpdate.Add(Actor);
+		}
+	}
+
+	return ActorsToUpdate;
 }
 
 void USpatialSender::RetireEntity(const Worker_EntityId EntityId)
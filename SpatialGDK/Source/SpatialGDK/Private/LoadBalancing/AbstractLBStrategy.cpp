@@ -3,6 +3,8 @@
 #include "LoadBalancing/AbstractLBStrategy.h"
 
 #include "EngineClasses/SpatialNetDriver.h"
+#include "SpatialGDKSettings.h"
+#include "Utils/SpatialActorUtils.h"
 
 UAbstractLBStrategy::UAbstractLBStrategy()
 	: Super()
@@ -14,3 +16,99 @@ void UAbstractLBStrategy::SetLocalVirtualWorkerId(VirtualWorkerId InLocalVirtual
 {
 	LocalVirtualWorkerId = InLocalVirtualWorkerId;
 }
+
+float UAbstractLBStrategy::GetLoadReportInterval() const
+{
+	const float LayoutUpdateInterval = GetLayoutUpdateInterval();
+	return LayoutUpdateInterval > 0.f ? LayoutUpdateInterval : GetDefault<USpatialGDKSettings>()->WorkerLoadReportInterval;
+}
+
+void UAbstractLBStrategy::WhoShouldHaveAuthorityForActors(TArrayView<const AActor* const> Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const
+{
+	OutVirtualWorkerIds.Reset(Actors.Num());
+	for (const AActor* Actor : Actors)
+	{
+		OutVirtualWorkerIds.Add(Actor != nullptr ? WhoShouldHaveAuthority(*Actor) : SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+	}
+}
+
+TArray<FWorkerInterestRegion> UAbstractLBStrategy::GetWorkerInterestRegions() const
+{
+	FWorkerInterestRegion Region;
+	Region.Constraint = GetWorkerInterestQueryConstraint();
+	return { Region };
+}
+
+SpatialGDK::QueryConstraint UAbstractLBStrategy::CreateBoxConstraint(const FBox2D& Area)
+{
+	const FVector2D Center2D = Area.GetCenter();
+	const FVector Center3D{ Center2D.X, Center2D.Y, 0.0f };
+
+	const FVector2D EdgeLengths2D = Area.GetSize();
+	check(EdgeLengths2D.X > 0.0f && EdgeLengths2D.Y > 0.0f);
+	const FVector EdgeLengths3D{ EdgeLengths2D.X, EdgeLengths2D.Y, FLT_MAX };
+
+	SpatialGDK::QueryConstraint Constraint;
+	Constraint.BoxConstraint = SpatialGDK::BoxConstraint{ SpatialGDK::Coordinates::FromFVector(Center3D), SpatialGDK::EdgeLength::FromFVector(EdgeLengths3D) };
+	return Constraint;
+}
+
+TArray<FWorkerInterestRegion> UAbstractLBStrategy::CreateBorderedInterestRegions(const FBox2D& Area, float AuthorityBorder, float InterestBorder, float BorderFrequency, bool bBorderDataOnly)
+{
+	TArray<FWorkerInterestRegion> Regions;
+
+	// Without any limits on the border, a single box is the cheapest query.
+	const bool bLimitBorder = BorderFrequency > 0.f || bBorderDataOnly;
+	if (!bLimitBorder || InterestBorder <= AuthorityBorder)
+	{
+		FWorkerInterestRegion& Region = Regions.AddDefaulted_GetRef();
+		Region.Constraint = CreateBoxConstraint(Area.ExpandBy(FMath::Max(InterestBorder, AuthorityBorder)));
+		return Regions;
+	}
+
+	// The worker can keep authority over Actors up to AuthorityBorder outside its area, so it needs all of their data.
+	const FBox2D Inner = Area.ExpandBy(AuthorityBorder);
+	const FBox2D Outer = Area.ExpandBy(InterestBorder);
+
+	FWorkerInterestRegion& InnerRegion = Regions.AddDefaulted_GetRef();
+	InnerRegion.Constraint = CreateBoxConstraint(Inner);
+
+	// Cover the rest of the border with four strips that don't overlap: the left and right ones span the full height.
+	const FBox2D Strips[] = {
+		FBox2D(FVector2D(Outer.Min.X, Outer.Min.Y), FVector2D(Inner.Min.X, Outer.Max.Y)),
+		FBox2D(FVector2D(Inner.Max.X, Outer.Min.Y), FVector2D(Outer.Max.X, Outer.Max.Y)),
+		FBox2D(FVector2D(Inner.Min.X, Outer.Min.Y), FVector2D(Inner.Max.X, Inner.Min.Y)),
+		FBox2D(FVector2D(Inner.Min.X, Inner.Max.Y), FVector2D(Inner.Max.X, Outer.Max.Y))
+	};
+
+	FWorkerInterestRegion BorderRegion;
+	BorderRegion.Frequency = BorderFrequency;
+	if (bBorderDataOnly)
+	{
+		BorderRegion.SchemaComponentTypes = { SCHEMA_Data };
+	}
+
+	for (const FBox2D& Strip : Strips)
+	{
+		BorderRegion.Constraint = CreateBoxConstraint(Strip);
+		Regions.Add(BorderRegion);
+	}
+
+	return Regions;
+}
+
+VirtualWorkerId UAbstractLBStrategy::PredictAuthority(const AActor& Actor, float LookaheadTime) const
+{
+	if (!IsReady() || !SupportsLocationQueries())
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	const FVector PredictedLocation = SpatialGDK::GetActorSpatialPosition(&Actor) + Actor.GetVelocity() * LookaheadTime;
+	if (!ShouldRelinquishAuthorityAtLocation(PredictedLocation))
+	{
+		return LocalVirtualWorkerId;
+	}
+
+	return WhoShouldHaveAuthorityAtLocation(PredictedLocation);
+}
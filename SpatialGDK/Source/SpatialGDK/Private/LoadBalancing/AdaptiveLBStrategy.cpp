@@ -0,0 +1,557 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/AdaptiveLBStrategy.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Utils/SpatialActorUtils.h"
+
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Templates/Tuple.h"
+
+DEFINE_LOG_CATEGORY(LogAdaptiveLBStrategy);
+
+UAdaptiveLBStrategy::UAdaptiveLBStrategy()
+	: Super()
+	, NumWorkers(1)
+	, WorldWidth(1000000.f)
+	, WorldHeight(1000000.f)
+	, InterestBorder(0.f)
+	, AuthorityHysteresisBand(0.f)
+	, BorderInterestFrequency(0.f)
+	, bBorderInterestDataOnly(false)
+	, LoadMetric(EAdaptiveLBLoadMetric::AuthoritativeActorCount)
+	, LayoutUpdateInterval(10.f)
+	, SplitLoadRatio(1.5f)
+	, MergeLoadRatio(1.f)
+	, MinRegionSize(5000.f)
+	, LayoutVersion(0)
+{
+}
+
+void UAdaptiveLBStrategy::Init()
+{
+	Super::Init();
+
+	UE_LOG(LogAdaptiveLBStrategy, Log, TEXT("AdaptiveLBStrategy initialized with NumWorkers = %d."), NumWorkers);
+
+	TArray<FNode> InitialNodes;
+	BuildEvenLayout(GetWorldBounds(), 1, NumWorkers, INDEX_NONE, InitialNodes);
+	RebuildLayout(InitialNodes);
+	LayoutVersion = 0;
+}
+
+TSet<VirtualWorkerId> UAdaptiveLBStrategy::GetVirtualWorkerIds() const
+{
+	TSet<VirtualWorkerId> VirtualWorkerIds;
+	for (uint32 i = 1; i <= NumWorkers; i++)
+	{
+		VirtualWorkerIds.Add(i);
+	}
+	return VirtualWorkerIds;
+}
+
+bool UAdaptiveLBStrategy::ShouldHaveAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		UE_LOG(LogAdaptiveLBStrategy, Warning, TEXT("AdaptiveLBStrategy not ready to relinquish authority for Actor %s."), *AActor::GetDebugName(&Actor));
+		return false;
+	}
+
+	return WhoShouldHaveAuthorityAtLocation(SpatialGDK::GetActorSpatialPosition(&Actor)) == LocalVirtualWorkerId;
+}
+
+bool UAdaptiveLBStrategy::ShouldRelinquishAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		return !ShouldHaveAuthority(Actor);
+	}
+
+	return ShouldRelinquishAuthorityAtLocation(SpatialGDK::GetActorSpatialPosition(&Actor));
+}
+
+bool UAdaptiveLBStrategy::ShouldRelinquishAuthorityAtLocation(const FVector& Location) const
+{
+	if (!IsReady())
+	{
+		return false;
+	}
+
+	const FVector2D Actor2DLocation = FVector2D(Location);
+	if (AuthorityHysteresisBand <= 0.f)
+	{
+		return GetVirtualWorkerForLocation(Actor2DLocation) != LocalVirtualWorkerId;
+	}
+
+	// Regions at the edge of the world extend to infinity, so only test against edges shared with another region.
+	const FBox2D WorldBounds = GetWorldBounds();
+	const FBox2D& Region = WorkerRegions[LocalVirtualWorkerId - 1];
+
+	for (int32 Axis = 0; Axis < 2; Axis++)
+	{
+		if (Region.Min[Axis] > WorldBounds.Min[Axis] && Actor2DLocation[Axis] < Region.Min[Axis] - AuthorityHysteresisBand)
+		{
+			return true;
+		}
+		if (Region.Max[Axis] < WorldBounds.Max[Axis] && Actor2DLocation[Axis] >= Region.Max[Axis] + AuthorityHysteresisBand)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+VirtualWorkerId UAdaptiveLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		UE_LOG(LogAdaptiveLBStrategy, Warning, TEXT("AdaptiveLBStrategy not ready to decide on authority for Actor %s."), *AActor::GetDebugName(&Actor));
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	return WhoShouldHaveAuthorityAtLocation(SpatialGDK::GetActorSpatialPosition(&Actor));
+}
+
+VirtualWorkerId UAdaptiveLBStrategy::WhoShouldHaveAuthorityAtLocation(const FVector& Location) const
+{
+	if (!IsReady())
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	return GetVirtualWorkerForLocation(FVector2D(Location));
+}
+
+void UAdaptiveLBStrategy::WhoShouldHaveAuthorityForActors(TArrayView<const AActor* const> Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const
+{
+	OutVirtualWorkerIds.Reset(Actors.Num());
+
+	if (!IsReady())
+	{
+		UE_LOG(LogAdaptiveLBStrategy, Warning, TEXT("AdaptiveLBStrategy not ready to decide on authority for %d Actors."), Actors.Num());
+		OutVirtualWorkerIds.Init(SpatialConstants::INVALID_VIRTUAL_WORKER_ID, Actors.Num());
+		return;
+	}
+
+	for (const AActor* Actor : Actors)
+	{
+		if (Actor == nullptr)
+		{
+			OutVirtualWorkerIds.Add(SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+			continue;
+		}
+
+		const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(Actor));
+		OutVirtualWorkerIds.Add(GetVirtualWorkerForLocation(Actor2DLocation));
+	}
+}
+
+VirtualWorkerId UAdaptiveLBStrategy::GetVirtualWorkerForLocation(const FVector2D& Location) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	int32 Index = 0;
+	while (!Nodes[Index].IsLeaf())
+	{
+		const FNode& Node = Nodes[Index];
+		Index = Node.Children[Location[Node.SplitAxis] >= Node.SplitPosition ? 1 : 0];
+	}
+
+	return Nodes[Index].WorkerId;
+}
+
+SpatialGDK::QueryConstraint UAdaptiveLBStrategy::GetWorkerInterestQueryConstraint() const
+{
+	// The interest area is the region that the worker is currently authoritative over plus some border region.
+	// This is re-derived whenever the layout changes. The border always covers the hysteresis band.
+	check(IsReady());
+
+	const FBox2D Interest2D = WorkerRegions[LocalVirtualWorkerId - 1].ExpandBy(FMath::Max(InterestBorder, AuthorityHysteresisBand));
+
+	return CreateBoxConstraint(Interest2D);
+}
+
+TArray<FWorkerInterestRegion> UAdaptiveLBStrategy::GetWorkerInterestRegions() const
+{
+	check(IsReady());
+
+	return CreateBorderedInterestRegions(WorkerRegions[LocalVirtualWorkerId - 1], AuthorityHysteresisBand, InterestBorder, BorderInterestFrequency, bBorderInterestDataOnly);
+}
+
+FVector UAdaptiveLBStrategy::GetWorkerEntityPosition() const
+{
+	check(IsReady());
+	const FVector2D Centre = WorkerRegions[LocalVirtualWorkerId - 1].GetCenter();
+	return FVector{ Centre.X, Centre.Y, 0.f };
+}
+
+bool UAdaptiveLBStrategy::UpdateLayout(const TMap<VirtualWorkerId, FVirtualWorkerLoad>& VirtualWorkerLoads)
+{
+	if (LayoutUpdateInterval <= 0.f || NumWorkers < 2 || Nodes.Num() == 0)
+	{
+		return false;
+	}
+
+	// Wait until every worker has reported, otherwise a missing worker would look idle.
+	TArray<float> WorkerLoads;
+	WorkerLoads.SetNumZeroed(NumWorkers);
+	float TotalLoad = 0.f;
+	for (uint32 i = 1; i <= NumWorkers; i++)
+	{
+		const FVirtualWorkerLoad* Load = VirtualWorkerLoads.Find(i);
+		if (Load == nullptr)
+		{
+			return false;
+		}
+		WorkerLoads[i - 1] = GetLoadValue(*Load);
+		TotalLoad += WorkerLoads[i - 1];
+	}
+
+	const float AverageLoad = TotalLoad / NumWorkers;
+	if (AverageLoad <= 0.f)
+	{
+		return false;
+	}
+
+	auto GetNodeLoad = [this, &WorkerLoads](int32 Index)
+	{
+		return WorkerLoads[Nodes[Index].WorkerId - 1];
+	};
+
+	// Find the most loaded region, which is the one we would like to split.
+	int32 HotIndex = INDEX_NONE;
+	for (int32 i = 0; i < Nodes.Num(); i++)
+	{
+		if (Nodes[i].IsLeaf() && (HotIndex == INDEX_NONE || GetNodeLoad(i) > GetNodeLoad(HotIndex)))
+		{
+			HotIndex = i;
+		}
+	}
+
+	const float HotLoad = GetNodeLoad(HotIndex);
+	if (HotLoad < SplitLoadRatio * AverageLoad)
+	{
+		return false;
+	}
+
+	const FVector2D HotSize = Nodes[HotIndex].Bounds.GetSize();
+	const uint8 SplitAxis = HotSize.X >= HotSize.Y ? 0 : 1;
+	if (HotSize[SplitAxis] / 2.f < MinRegionSize)
+	{
+		UE_LOG(LogAdaptiveLBStrategy, Verbose, TEXT("Virtual worker %d is overloaded but its region is too small to split."), Nodes[HotIndex].WorkerId);
+		return false;
+	}
+
+	// Find the pair of sibling regions with the lowest combined load to merge, freeing a virtual worker for the split.
+	int32 MergeIndex = INDEX_NONE;
+	float MergeLoad = 0.f;
+	for (int32 i = 0; i < Nodes.Num(); i++)
+	{
+		const FNode& Node = Nodes[i];
+		if (Node.IsLeaf() || i == Nodes[HotIndex].Parent || !Nodes[Node.Children[0]].IsLeaf() || !Nodes[Node.Children[1]].IsLeaf())
+		{
+			continue;
+		}
+
+		const float CombinedLoad = GetNodeLoad(Node.Children[0]) + GetNodeLoad(Node.Children[1]);
+		if (MergeIndex == INDEX_NONE || CombinedLoad < MergeLoad)
+		{
+			MergeIndex = i;
+			MergeLoad = CombinedLoad;
+		}
+	}
+
+	if (MergeIndex == INDEX_NONE || MergeLoad > MergeLoadRatio * AverageLoad || MergeLoad >= HotLoad)
+	{
+		return false;
+	}
+
+	TArray<FNode> NewNodes = Nodes;
+
+	// Merge: the busier of the two siblings keeps the merged region, so fewer actors migrate.
+	FNode& MergeNode = NewNodes[MergeIndex];
+	const int32 KeptChild = GetNodeLoad(MergeNode.Children[0]) >= GetNodeLoad(MergeNode.Children[1]) ? 0 : 1;
+	const VirtualWorkerId KeptWorkerId = Nodes[MergeNode.Children[KeptChild]].WorkerId;
+	const VirtualWorkerId FreedWorkerId = Nodes[MergeNode.Children[1 - KeptChild]].WorkerId;
+	MergeNode.Children[0] = INDEX_NONE;
+	MergeNode.Children[1] = INDEX_NONE;
+	MergeNode.WorkerId = KeptWorkerId;
+
+	// Split: the overloaded worker keeps the lower half and the freed worker takes the upper half.
+	const VirtualWorkerId HotWorkerId = Nodes[HotIndex].WorkerId;
+	const int32 LowerIndex = NewNodes.AddDefaulted();
+	NewNodes[LowerIndex].WorkerId = HotWorkerId;
+	NewNodes[LowerIndex].Parent = HotIndex;
+	const int32 UpperIndex = NewNodes.AddDefaulted();
+	NewNodes[UpperIndex].WorkerId = FreedWorkerId;
+	NewNodes[UpperIndex].Parent = HotIndex;
+
+	FNode& HotNode = NewNodes[HotIndex];
+	HotNode.SplitAxis = SplitAxis;
+	HotNode.SplitPosition = HotNode.Bounds.GetCenter()[SplitAxis];
+	HotNode.WorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	HotNode.Children[0] = LowerIndex;
+	HotNode.Children[1] = UpperIndex;
+
+	RebuildLayout(NewNodes);
+	LayoutVersion++;
+
+	UE_LOG(LogAdaptiveLBStrategy, Log, TEXT("Layout version %u: split the region of virtual worker %d (load %.2f, average %.2f) with virtual worker %d, merged into virtual worker %d."),
+		LayoutVersion, HotWorkerId, HotLoad, AverageLoad, FreedWorkerId, KeptWorkerId);
+
+	OnLayoutChanged.Broadcast();
+	return true;
+}
+
+void UAdaptiveLBStrategy::WriteLayout(TArray<uint8>& OutLayout) const
+{
+	FMemoryWriter Writer(OutLayout);
+
+	uint32 Version = LayoutVersion;
+	int32 NumNodes = Nodes.Num();
+	Writer << Version;
+	Writer << NumNodes;
+
+	// Nodes are kept in pre-order, so the tree structure is implied by the order of the nodes.
+	for (const FNode& Node : Nodes)
+	{
+		uint8 bIsLeaf = Node.IsLeaf() ? 1 : 0;
+		Writer << bIsLeaf;
+		if (bIsLeaf)
+		{
+			uint32 WorkerId = Node.WorkerId;
+			Writer << WorkerId;
+		}
+		else
+		{
+			uint8 SplitAxis = Node.SplitAxis;
+			float SplitPosition = Node.SplitPosition;
+			Writer << SplitAxis;
+			Writer << SplitPosition;
+		}
+	}
+}
+
+bool UAdaptiveLBStrategy::ApplyLayout(const TArray<uint8>& Layout)
+{
+	FMemoryReader Reader(Layout);
+
+	uint32 Version = 0;
+	int32 NumNodes = 0;
+	Reader << Version;
+	Reader << NumNodes;
+
+	if (Reader.IsError() || Version <= LayoutVersion)
+	{
+		return false;
+	}
+
+	TArray<FNode> ReceivedNodes;
+	ReceivedNodes.Reserve(NumNodes);
+	ReadNode(Reader, INDEX_NONE, 0, ReceivedNodes);
+
+	if (Reader.IsError() || ReceivedNodes.Num() != NumNodes || !IsValidLayout(ReceivedNodes))
+	{
+		UE_LOG(LogAdaptiveLBStrategy, Error, TEXT("Received an invalid load balancing layout (version %u). Keeping layout version %u."), Version, LayoutVersion);
+		return false;
+	}
+
+	RebuildLayout(ReceivedNodes);
+	LayoutVersion = Version;
+
+	OnLayoutChanged.Broadcast();
+	return true;
+}
+
+UAdaptiveLBStrategy::LBStrategyRegions UAdaptiveLBStrategy::GetLBStrategyRegions() const
+{
+	LBStrategyRegions VirtualWorkerToRegion;
+	VirtualWorkerToRegion.SetNum(WorkerRegions.Num());
+
+	for (int32 i = 0; i < WorkerRegions.Num(); i++)
+	{
+		VirtualWorkerToRegion[i] = MakeTuple(static_cast<VirtualWorkerId>(i + 1), WorkerRegions[i]);
+	}
+	return VirtualWorkerToRegion;
+}
+
+FBox2D UAdaptiveLBStrategy::GetWorldBounds() const
+{
+	// Match the grid strategy: X spans WorldHeight and Y spans WorldWidth, centred on the origin.
+	return FBox2D(FVector2D(-WorldHeight / 2.f, -WorldWidth / 2.f), FVector2D(WorldHeight / 2.f, WorldWidth / 2.f));
+}
+
+int32 UAdaptiveLBStrategy::BuildEvenLayout(const FBox2D& Bounds, VirtualWorkerId FirstWorkerId, uint32 NumLeaves, int32 Parent, TArray<FNode>& OutNodes) const
+{
+	const int32 Index = OutNodes.AddDefaulted();
+	OutNodes[Index].Parent = Parent;
+
+	if (NumLeaves <= 1)
+	{
+		OutNodes[Index].WorkerId = FirstWorkerId;
+		return Index;
+	}
+
+	// Split along the longer axis, in proportion to the number of workers on each side so all regions have the same area.
+	const FVector2D Size = Bounds.GetSize();
+	const uint8 SplitAxis = Size.X >= Size.Y ? 0 : 1;
+	const uint32 NumLowerLeaves = NumLeaves / 2;
+	const float SplitPosition = Bounds.Min[SplitAxis] + Size[SplitAxis] * NumLowerLeaves / NumLeaves;
+
+	FBox2D LowerBounds = Bounds;
+	LowerBounds.Max[SplitAxis] = SplitPosition;
+	FBox2D UpperBounds = Bounds;
+	UpperBounds.Min[SplitAxis] = SplitPosition;
+
+	OutNodes[Index].SplitAxis = SplitAxis;
+	OutNodes[Index].SplitPosition = SplitPosition;
+
+	const int32 LowerIndex = BuildEvenLayout(LowerBounds, FirstWorkerId, NumLowerLeaves, Index, OutNodes);
+	const int32 UpperIndex = BuildEvenLayout(UpperBounds, FirstWorkerId + NumLowerLeaves, NumLeaves - NumLowerLeaves, Index, OutNodes);
+	OutNodes[Index].Children[0] = LowerIndex;
+	OutNodes[Index].Children[1] = UpperIndex;
+
+	return Index;
+}
+
+float UAdaptiveLBStrategy::GetLoadValue(const FVirtualWorkerLoad& Load) const
+{
+	switch (LoadMetric)
+	{
+	case EAdaptiveLBLoadMetric::AverageFrameTime:
+		return Load.AverageFrameTime;
+	case EAdaptiveLBLoadMetric::AuthoritativeActorCount:
+	default:
+		return static_cast<float>(Load.AuthoritativeActorCount);
+	}
+}
+
+void UAdaptiveLBStrategy::RebuildLayout(const TArray<FNode>& SourceNodes)
+{
+	Nodes.Reset(SourceNodes.Num());
+	WorkerRegions.Init(FBox2D(ForceInit), NumWorkers);
+
+	CopySubtree(SourceNodes, 0, INDEX_NONE, GetWorldBounds());
+}
+
+int32 UAdaptiveLBStrategy::CopySubtree(const TArray<FNode>& SourceNodes, int32 SourceIndex, int32 Parent, const FBox2D& Bounds)
+{
+	const FNode& Source = SourceNodes[SourceIndex];
+
+	const int32 Index = Nodes.Add(Source);
+	Nodes[Index].Parent = Parent;
+	Nodes[Index].Bounds = Bounds;
+
+	if (Source.IsLeaf())
+	{
+		WorkerRegions[Source.WorkerId - 1] = Bounds;
+		return Index;
+	}
+
+	FBox2D LowerBounds = Bounds;
+	LowerBounds.Max[Source.SplitAxis] = Source.SplitPosition;
+	FBox2D UpperBounds = Bounds;
+	UpperBounds.Min[Source.SplitAxis] = Source.SplitPosition;
+
+	const int32 LowerIndex = CopySubtree(SourceNodes, Source.Children[0], Index, LowerBounds);
+	const int32 UpperIndex = CopySubtree(SourceNodes, Source.Children[1], Index, UpperBounds);
+	Nodes[Index].Children[0] = LowerIndex;
+	Nodes[Index].Children[1] = UpperIndex;
+
+	return Index;
+}
+
+int32 UAdaptiveLBStrategy::ReadNode(FArchive& Ar, int32 Parent, int32 Depth, TArray<FNode>& OutNodes) const
+{
+	// A tree with NumWorkers leaves can't be deeper than NumWorkers, so anything deeper is malformed.
+	if (Ar.IsError() || Ar.AtEnd() || Depth > static_cast<int32>(NumWorkers))
+	{
+		Ar.SetError();
+		return INDEX_NONE;
+	}
+
+	const int32 Index = OutNodes.AddDefaulted();
+	OutNodes[Index].Parent = Parent;
+
+	uint8 bIsLeaf = 0;
+	Ar << bIsLeaf;
+	if (bIsLeaf)
+	{
+		uint32 WorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+		Ar << WorkerId;
+		OutNodes[Index].WorkerId = WorkerId;
+		return Index;
+	}
+
+	uint8 SplitAxis = 0;
+	float SplitPosition = 0.f;
+	Ar << SplitAxis;
+	Ar << SplitPosition;
+	OutNodes[Index].SplitAxis = SplitAxis;
+	OutNodes[Index].SplitPosition = SplitPosition;
+
+	const int32 LowerIndex = ReadNode(Ar, Index, Depth + 1, OutNodes);
+	const int32 UpperIndex = ReadNode(Ar, Index, Depth + 1, OutNodes);
+	OutNodes[Index].Children[0] = LowerIndex;
+	OutNodes[Index].Children[1] = UpperIndex;
+
+	return Index;
+}
+
+bool UAdaptiveLBStrategy::IsValidLayout(const TArray<FNode>& SourceNodes) const
+{
+	// Every virtual worker must own exactly one leaf, and every split must be along X or Y and strictly inside the bounds of
+	// its node, so that no region is empty. Nodes are read parent first, so a node's bounds are known before it is checked.
+	TArray<bool> SeenWorkers;
+	SeenWorkers.SetNumZeroed(NumWorkers);
+	int32 NumLeaves = 0;
+
+	TArray<FBox2D> NodeBounds;
+	NodeBounds.Init(FBox2D(ForceInit), SourceNodes.Num());
+	if (SourceNodes.Num() > 0)
+	{
+		NodeBounds[0] = GetWorldBounds();
+	}
+
+	for (int32 Index = 0; Index < SourceNodes.Num(); Index++)
+	{
+		const FNode& Node = SourceNodes[Index];
+		if (Node.IsLeaf())
+		{
+			if (Node.WorkerId < 1 || Node.WorkerId > NumWorkers || SeenWorkers[Node.WorkerId - 1])
+			{
+				return false;
+			}
+			SeenWorkers[Node.WorkerId - 1] = true;
+			NumLeaves++;
+			continue;
+		}
+
+		if (Node.SplitAxis > 1 || !SourceNodes.IsValidIndex(Node.Children[0]) || !SourceNodes.IsValidIndex(Node.Children[1])
+			|| Node.Children[0] <= Index || Node.Children[1] <= Index)
+		{
+			return false;
+		}
+
+		const FBox2D& Bounds = NodeBounds[Index];
+		if (!(Node.SplitPosition > Bounds.Min[Node.SplitAxis] && Node.SplitPosition < Bounds.Max[Node.SplitAxis]))
+		{
+			return false;
+		}
+
+		FBox2D& LowerBounds = NodeBounds[Node.Children[0]];
+		LowerBounds = Bounds;
+		LowerBounds.Max[Node.SplitAxis] = Node.SplitPosition;
+		FBox2D& UpperBounds = NodeBounds[Node.Children[1]];
+		UpperBounds = Bounds;
+		UpperBounds.Min[Node.SplitAxis] = Node.SplitPosition;
+	}
+
+	return NumLeaves == static_cast<int32>(NumWorkers);
+}
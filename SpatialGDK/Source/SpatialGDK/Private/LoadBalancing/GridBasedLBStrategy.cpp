@@ -16,6 +16,12 @@ UGridBasedLBStrategy::UGridBasedLBStrategy()
 	, WorldWidth(1000000.f)
 	, WorldHeight(1000000.f)
 	, InterestBorder(0.f)
+	, AuthorityHysteresisBand(0.f)
+	, BorderInterestFrequency(0.f)
+	, bBorderInterestDataOnly(false)
+	, GridMin(FVector2D::ZeroVector)
+	, RowHeight(0.f)
+	, ColumnWidth(0.f)
 {
 }
 
@@ -33,8 +39,9 @@ void UGridBasedLBStrategy::Init()
 	const float WorldWidthMin = -(WorldWidth / 2.f);
 	const float WorldHeightMin = -(WorldHeight / 2.f);
 
-	const float ColumnWidth = WorldWidth / Cols;
-	const float RowHeight = WorldHeight / Rows;
+	ColumnWidth = WorldWidth / Cols;
+	RowHeight = WorldHeight / Rows;
+	GridMin = FVector2D(WorldHeightMin, WorldWidthMin);
 
 	// We would like the inspector's representation of the load balancing strategy to match our intuition.
 	// +x is forward, so rows are perpendicular to the x-axis and columns are perpendicular to the y-axis.
@@ -76,8 +83,17 @@ bool UGridBasedLBStrategy::ShouldHaveAuthority(const AActor& Actor) const
 		return false;
 	}
 
-	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
-	return IsInside(WorkerCells[LocalVirtualWorkerId - 1], Actor2DLocation);
+	return WhoShouldHaveAuthorityAtLocation(SpatialGDK::GetActorSpatialPosition(&Actor)) == LocalVirtualWorkerId;
+}
+
+bool UGridBasedLBStrategy::ShouldRelinquishAuthority(const AActor& Actor) const
+{
+	if (!IsReady())
+	{
+		return !ShouldHaveAuthority(Actor);
+	}
+
+	return ShouldRelinquishAuthorityAtLocation(SpatialGDK::GetActorSpatialPosition(&Actor));
 }
 
 VirtualWorkerId UGridBasedLBStrategy::WhoShouldHaveAuthority(const AActor& Actor) const
@@ -88,36 +104,108 @@ VirtualWorkerId UGridBasedLBStrategy::WhoShouldHaveAuthority(const AActor& Actor
 		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
 	}
 
-	const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(&Actor));
+	return WhoShouldHaveAuthorityAtLocation(SpatialGDK::GetActorSpatialPosition(&Actor));
+}
 
-	for (int i = 0; i < WorkerCells.Num(); i++)
+void UGridBasedLBStrategy::WhoShouldHaveAuthorityForActors(TArrayView<const AActor* const> Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const
+{
+	OutVirtualWorkerIds.Reset(Actors.Num());
+
+	if (!IsReady())
+	{
+		UE_LOG(LogGridBasedLBStrategy, Warning, TEXT("GridBasedLBStrategy not ready to decide on authority for %d Actors."), Actors.Num());
+		OutVirtualWorkerIds.Init(SpatialConstants::INVALID_VIRTUAL_WORKER_ID, Actors.Num());
+		return;
+	}
+
+	for (const AActor* Actor : Actors)
 	{
-		if (IsInside(WorkerCells[i], Actor2DLocation))
+		if (Actor == nullptr)
 		{
-			return VirtualWorkerIds[i];
+			OutVirtualWorkerIds.Add(SpatialConstants::INVALID_VIRTUAL_WORKER_ID);
+			continue;
 		}
+
+		const FVector2D Actor2DLocation = FVector2D(SpatialGDK::GetActorSpatialPosition(Actor));
+		OutVirtualWorkerIds.Add(GetVirtualWorkerForLocation(Actor2DLocation));
 	}
+}
 
-	return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+bool UGridBasedLBStrategy::ShouldRelinquishAuthorityAtLocation(const FVector& Location) const
+{
+	if (!IsReady())
+	{
+		return false;
+	}
+
+	const FBox2D& LocalCell = WorkerCells[LocalVirtualWorkerId - 1];
+	const FVector2D Location2D = FVector2D(Location);
+	return !IsInside(AuthorityHysteresisBand > 0.f ? LocalCell.ExpandBy(AuthorityHysteresisBand) : LocalCell, Location2D);
+}
+
+VirtualWorkerId UGridBasedLBStrategy::WhoShouldHaveAuthorityAtLocation(const FVector& Location) const
+{
+	if (!IsReady())
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	return GetVirtualWorkerForLocation(FVector2D(Location));
+}
+
+VirtualWorkerId UGridBasedLBStrategy::GetVirtualWorkerForLocation(const FVector2D& Location) const
+{
+	if (WorkerCells.Num() == 0)
+	{
+		return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	}
+
+	const int32 NumRows = static_cast<int32>(Rows);
+	const int32 MaxRow = NumRows - 1;
+	const int32 MaxCol = static_cast<int32>(Cols) - 1;
+	int32 Row = FMath::Clamp(FMath::FloorToInt((Location.X - GridMin.X) / RowHeight), 0, MaxRow);
+	int32 Col = FMath::Clamp(FMath::FloorToInt((Location.Y - GridMin.Y) / ColumnWidth), 0, MaxCol);
+
+	// The cell bounds were accumulated in Init, so rounding can put a point right on an edge in the neighbouring cell.
+	// Correct against the stored bounds so the result always matches IsInside.
+	const FBox2D& Estimate = WorkerCells[Col * NumRows + Row];
+	if (Location.X < Estimate.Min.X && Row > 0)
+	{
+		Row--;
+	}
+	else if (Location.X >= Estimate.Max.X && Row < MaxRow)
+	{
+		Row++;
+	}
+	if (Location.Y < Estimate.Min.Y && Col > 0)
+	{
+		Col--;
+	}
+	else if (Location.Y >= Estimate.Max.Y && Col < MaxCol)
+	{
+		Col++;
+	}
+
+	const int32 CellIndex = Col * NumRows + Row;
+	return IsInside(WorkerCells[CellIndex], Location) ? VirtualWorkerIds[CellIndex] : SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
 }
 
 SpatialGDK::QueryConstraint UGridBasedLBStrategy::GetWorkerInterestQueryConstraint() const
 {
 	// For a grid-based strategy, the interest area is the cell that the worker is authoritative over plus some border region.
+	// The border always covers the hysteresis band, since the worker can keep authority over Actors inside it.
 	check(IsReady());
 
-	const FBox2D Interest2D = WorkerCells[LocalVirtualWorkerId - 1].ExpandBy(InterestBorder);
+	const FBox2D Interest2D = WorkerCells[LocalVirtualWorkerId - 1].ExpandBy(FMath::Max(InterestBorder, AuthorityHysteresisBand));
 
-	const FVector2D Center2D = Interest2D.GetCenter();
-	const FVector Center3D{ Center2D.X, Center2D.Y, 0.0f};
+	return CreateBoxConstraint(Interest2D);
+}
 
-	const FVector2D EdgeLengths2D = Interest2D.GetSize();
-	check(EdgeLengths2D.X > 0.0f && EdgeLengths2D.Y > 0.0f);
-	const FVector EdgeLengths3D{ EdgeLengths2D.X, EdgeLengths2D.Y, FLT_MAX};
+TArray<FWorkerInterestRegion> UGridBasedLBStrategy::GetWorkerInterestRegions() const
+{
+	check(IsReady());
 
-	SpatialGDK::QueryConstraint Constraint;
-	Constraint.BoxConstraint = SpatialGDK::BoxConstraint{ SpatialGDK::Coordinates::FromFVector(Center3D), SpatialGDK::EdgeLength::FromFVector(EdgeLengths3D) };
-	return Constraint;
+	return CreateBorderedInterestRegions(WorkerCells[LocalVirtualWorkerId - 1], AuthorityHysteresisBand, InterestBorder, BorderInterestFrequency, bBorderInterestDataOnly);
 }
 
 FVector UGridBasedLBStrategy::GetWorkerEntityPosition() const
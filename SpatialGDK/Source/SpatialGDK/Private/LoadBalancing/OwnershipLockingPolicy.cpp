@@ -36,17 +36,12 @@ ActorLockToken UOwnershipLockingPolicy::AcquireLock(AActor* Actor, FString Debug
 	}
 	else
 	{
-		// We want to avoid memory leak if a locked actor is deleted.
-		// To do this, we register with the Actor OnDestroyed delegate with a function that cleans up the internal map.
-		if (!Actor->OnDestroyed.IsAlreadyBound(this, &UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted))
-		{
-			Actor->OnDestroyed.AddDynamic(this, &UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted);
-		}
+		// Locks are counted against the hierarchy root, which locks every Actor in the hierarchy. Adding the Actor to the
+		// cached hierarchy also registers with its OnDestroyed delegate, so we don't leak the lock if the Actor is deleted.
+		const OwnershipHierarchyNode& HierarchyNode = FindOrAddHierarchyNode(Actor);
+		AddLockedActorToHierarchy(HierarchyNode.HierarchyRoot);
 
-		AActor* OwnershipHierarchyRoot = SpatialGDK::GetHierarchyRoot(Actor);
-		AddOwnershipHierarchyRootInformation(OwnershipHierarchyRoot, Actor);
-		
-		ActorToLockingState.Add(Actor, MigrationLockElement{ 1, OwnershipHierarchyRoot });
+		ActorToLockingState.Add(Actor, MigrationLockElement{ 1 });
 	}
 
 	UE_LOG(LogOwnershipLockingPolicy, Log, TEXT("Acquiring migration lock. "
@@ -77,9 +72,9 @@ bool UOwnershipLockingPolicy::ReleaseLock(const ActorLockToken Token)
 		if (ActorLockingState.LockCount == 1)
 		{
 			UE_LOG(LogOwnershipLockingPolicy, Log, TEXT("Actor migration no longer locked. Actor: %s"), *Actor->GetName());
-			Actor->OnDestroyed.RemoveDynamic(this, &UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted);
-			RemoveOwnershipHierarchyRootInformation(ActorLockingState.HierarchyRoot, Actor);
+			RemoveLockedActorFromHierarchy(OwnershipHierarchy.FindChecked(Actor).HierarchyRoot);
 			CountIt.RemoveCurrent();
+			RemoveHierarchyNodeIfUnused(Actor);
 		}
 		else
 		{
@@ -100,19 +95,8 @@ bool UOwnershipLockingPolicy::IsLocked(const AActor* Actor) const
 		return false;
 	}
 
-	// Is this Actor explicitly locked or on a locked hierarchy ownership path.
-	if (IsExplicitlyLocked(Actor) || IsLockedHierarchyRoot(Actor))
-	{
-		return true;
-	}
-
-	// Is the hierarchy root of this Actor explicitly locked or on a locked hierarchy ownership path.
-	if (AActor* HierarchyRoot = SpatialGDK::GetHierarchyRoot(Actor))
-	{
-		return IsExplicitlyLocked(HierarchyRoot) || IsLockedHierarchyRoot(HierarchyRoot);
-	}
-
-	return false;
+	// An Actor is locked if any Actor in its ownership hierarchy is explicitly locked.
+	return HierarchyRootToLockedActorCount.Contains(GetCachedHierarchyRoot(Actor));
 }
 
 bool UOwnershipLockingPolicy::IsExplicitlyLocked(const AActor* Actor) const
@@ -120,9 +104,21 @@ bool UOwnershipLockingPolicy::IsExplicitlyLocked(const AActor* Actor) const
 	return ActorToLockingState.Contains(Actor);
 }
 
-bool UOwnershipLockingPolicy::IsLockedHierarchyRoot(const AActor* Actor) const
+const AActor* UOwnershipLockingPolicy::GetCachedHierarchyRoot(const AActor* Actor) const
 {
-	return LockedOwnershipRootActorToExplicitlyLockedActors.Contains(Actor);
+	if (const OwnershipHierarchyNode* HierarchyNode = OwnershipHierarchy.Find(Actor))
+	{
+		return HierarchyNode->HierarchyRoot;
+	}
+
+	// Actors which gained an owner without OnOwnerUpdated being called, for example before this policy was created,
+	// aren't in the cached hierarchy. Fall back to walking their ownership chain.
+	if (const AActor* HierarchyRoot = SpatialGDK::GetHierarchyRoot(Actor))
+	{
+		return HierarchyRoot;
+	}
+
+	return Actor;
 }
 
 bool UOwnershipLockingPolicy::AcquireLockFromDelegate(AActor* ActorToLock, const FString& DelegateLockIdentifier)
@@ -155,117 +151,210 @@ void UOwnershipLockingPolicy::OnOwnerUpdated(const AActor* Actor, const AActor*
 {
 	check(Actor != nullptr);
 
-	// If an explicitly locked Actor is changing owner.
-	if (IsExplicitlyLocked(Actor))
+	// Destroyed Actors have already been removed from the hierarchy by OnHierarchyActorRemoved.
+	if (Actor->IsPendingKillPending())
 	{
-		RecalculateLockedActorOwnershipHierarchyInformation(Actor);
+		return;
 	}
 
-	// If a locked hierarchy root is changing owner.
-	if (IsLockedHierarchyRoot(Actor))
+	const AActor* NewOwner = Actor->GetOwner();
+	if (NewOwner != nullptr && NewOwner->IsPendingKillPending())
 	{
-		RecalculateAllExplicitlyLockedActorsInThisHierarchy(Actor);
+		NewOwner = nullptr;
 	}
-	// If an Actor in a locked hierarchy is changing owner (i.e. either the old owner or
-	// the root hierarchy of the old owner is the root of a locked hierarchy), we need to
-	// recalculate ownership hierarchies of all explicitly locked Actors in that hierarchy.
-	else if (OldOwner != nullptr)
+
+	OwnershipHierarchyNode* HierarchyNode = OwnershipHierarchy.Find(Actor);
+	if (HierarchyNode == nullptr)
 	{
-		const AActor* OldHierarchyRoot = OldOwner->GetOwner() != nullptr ? SpatialGDK::GetHierarchyRoot(OldOwner) : OldOwner;
-		if (IsLockedHierarchyRoot(OldHierarchyRoot))
+		// An Actor outside the hierarchy owns no other Actor and isn't locked, so only its own hierarchy root changes.
+		if (NewOwner != nullptr)
 		{
-			RecalculateAllExplicitlyLockedActorsInThisHierarchy(OldHierarchyRoot);
+			FindOrAddHierarchyNode(Actor);
 		}
+		return;
 	}
- }
 
-void UOwnershipLockingPolicy::OnExplicitlyLockedActorDeleted(AActor* DestroyedActor)
-{
-	// Find all tokens for this Actor and unlock.
-	for (auto TokenNameActorIterator = TokenToNameAndActor.CreateIterator(); TokenNameActorIterator; ++TokenNameActorIterator)
+	if (HierarchyNode->Owner == NewOwner)
 	{
-		if (TokenNameActorIterator->Value.Actor == DestroyedActor)
-		{
-			TokenNameActorIterator.RemoveCurrent();
-		}
+		return;
+	}
+
+	const AActor* PreviousOwner = HierarchyNode->Owner;
+	if (PreviousOwner != nullptr)
+	{
+		OwnershipHierarchy.FindChecked(PreviousOwner).OwnedActors.RemoveSingleSwap(Actor);
+	}
+
+	const AActor* NewHierarchyRoot = Actor;
+	if (NewOwner != nullptr)
+	{
+		// This can add to the hierarchy, which invalidates HierarchyNode.
+		OwnershipHierarchyNode& NewOwnerNode = FindOrAddHierarchyNode(NewOwner);
+		NewOwnerNode.OwnedActors.Add(Actor);
+		NewHierarchyRoot = NewOwnerNode.HierarchyRoot;
 	}
 
-	// Delete Actor from local mapping.
-	MigrationLockElement ActorLockingState = ActorToLockingState.FindAndRemoveChecked(DestroyedActor);
+	OwnershipHierarchy.FindChecked(Actor).Owner = NewOwner;
 
-	// Update ownership path Actor mapping to remove this Actor.
-	RemoveOwnershipHierarchyRootInformation(ActorLockingState.HierarchyRoot, DestroyedActor);
+	// Only the Actors owned, directly or indirectly, by this Actor move to the new hierarchy.
+	SetHierarchyRoot(Actor, NewHierarchyRoot);
+
+	// Losing an owner or an owned Actor can leave either Actor with nothing to cache.
+	RemoveHierarchyNodeIfUnused(Actor);
+	if (PreviousOwner != nullptr)
+	{
+		RemoveHierarchyNodeIfUnused(PreviousOwner);
+	}
 }
 
-void UOwnershipLockingPolicy::OnHierarchyRootActorDeleted(AActor* DeletedHierarchyRoot)
+bool UOwnershipLockingPolicy::IsInCachedHierarchy(const AActor* Actor) const
 {
-	check(LockedOwnershipRootActorToExplicitlyLockedActors.Contains(DeletedHierarchyRoot));
+	return OwnershipHierarchy.Contains(Actor);
+}
 
-	// For all explicitly locked Actors where this Actor is on the ownership path, recalculate the
-	// ownership path information to account for this Actor's deletion.
-	RecalculateAllExplicitlyLockedActorsInThisHierarchy(DeletedHierarchyRoot);
-	LockedOwnershipRootActorToExplicitlyLockedActors.Remove(DeletedHierarchyRoot);
+void UOwnershipLockingPolicy::OnHierarchyActorDestroyed(AActor* DestroyedActor)
+{
+	OnHierarchyActorRemoved(DestroyedActor);
 }
 
-void UOwnershipLockingPolicy::RecalculateAllExplicitlyLockedActorsInThisHierarchy(const AActor* HierarchyRoot)
+void UOwnershipLockingPolicy::OnHierarchyActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
 {
-	TArray<const AActor*> ExplicitlyLockedActorsWithThisActorInOwnershipPath = LockedOwnershipRootActorToExplicitlyLockedActors.FindChecked(HierarchyRoot);
-	for (const AActor* ExplicitlyLockedActor : ExplicitlyLockedActorsWithThisActorInOwnershipPath)
+	// Actors can leave the world without being destroyed, for example when their level is streamed out or the world is
+	// torn down. They must not stay in the hierarchy, as the cache is keyed by Actor address.
+	OnHierarchyActorRemoved(Actor);
+}
+
+void UOwnershipLockingPolicy::OnHierarchyActorRemoved(AActor* RemovedActor)
+{
+	if (IsExplicitlyLocked(RemovedActor))
 	{
-		RecalculateLockedActorOwnershipHierarchyInformation(ExplicitlyLockedActor);
+		// Find all tokens for this Actor and unlock.
+		for (auto TokenNameActorIterator = TokenToNameAndActor.CreateIterator(); TokenNameActorIterator; ++TokenNameActorIterator)
+		{
+			if (TokenNameActorIterator->Value.Actor == RemovedActor)
+			{
+				TokenNameActorIterator.RemoveCurrent();
+			}
+		}
+
+		ActorToLockingState.Remove(RemovedActor);
+		RemoveLockedActorFromHierarchy(OwnershipHierarchy.FindChecked(RemovedActor).HierarchyRoot);
 	}
+
+	RemoveHierarchyNode(RemovedActor);
 }
 
-void UOwnershipLockingPolicy::RecalculateLockedActorOwnershipHierarchyInformation(const AActor* ExplicitlyLockedActor)
+UOwnershipLockingPolicy::OwnershipHierarchyNode& UOwnershipLockingPolicy::FindOrAddHierarchyNode(const AActor* Actor)
 {
-	// For the old ownership path, update ownership path Actor mapping to explicitly locked Actors to remove this Actor.
-	AActor* OldHierarchyRoot = ActorToLockingState.FindChecked(ExplicitlyLockedActor).HierarchyRoot;
-	RemoveOwnershipHierarchyRootInformation(OldHierarchyRoot, ExplicitlyLockedActor);
-
-	// For the new ownership path, update ownership path Actor mapping to explicitly locked Actors to include this Actor.
-	AActor* NewOwnershipHierarchyRoot = SpatialGDK::GetHierarchyRoot(ExplicitlyLockedActor);
-	ActorToLockingState.FindChecked(ExplicitlyLockedActor).HierarchyRoot = NewOwnershipHierarchyRoot;
-	AddOwnershipHierarchyRootInformation(NewOwnershipHierarchyRoot, ExplicitlyLockedActor);
+	if (OwnershipHierarchy.Contains(Actor))
+	{
+		return OwnershipHierarchy.FindChecked(Actor);
+	}
+
+	const AActor* Owner = Actor->GetOwner();
+	if (Owner != nullptr && Owner->IsPendingKillPending())
+	{
+		Owner = nullptr;
+	}
+
+	const AActor* HierarchyRoot = Actor;
+	if (Owner != nullptr)
+	{
+		OwnershipHierarchyNode& OwnerNode = FindOrAddHierarchyNode(Owner);
+		OwnerNode.OwnedActors.Add(Actor);
+		HierarchyRoot = OwnerNode.HierarchyRoot;
+	}
+
+	// Remove the Actor from the hierarchy when it's deleted or leaves the world, so that the Actors it owns become hierarchy roots.
+	AActor* MutableActor = const_cast<AActor*>(Actor);
+	if (!MutableActor->OnDestroyed.IsAlreadyBound(this, &UOwnershipLockingPolicy::OnHierarchyActorDestroyed))
+	{
+		MutableActor->OnDestroyed.AddDynamic(this, &UOwnershipLockingPolicy::OnHierarchyActorDestroyed);
+	}
+	if (!MutableActor->OnEndPlay.IsAlreadyBound(this, &UOwnershipLockingPolicy::OnHierarchyActorEndPlay))
+	{
+		MutableActor->OnEndPlay.AddDynamic(this, &UOwnershipLockingPolicy::OnHierarchyActorEndPlay);
+	}
+
+	return OwnershipHierarchy.Add(Actor, OwnershipHierarchyNode{ Owner, HierarchyRoot, {} });
 }
 
-void UOwnershipLockingPolicy::RemoveOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor)
+void UOwnershipLockingPolicy::RemoveHierarchyNode(const AActor* Actor)
 {
-	if (HierarchyRoot == nullptr)
+	OwnershipHierarchyNode HierarchyNode;
+	if (!OwnershipHierarchy.RemoveAndCopyValue(Actor, HierarchyNode))
 	{
 		return;
 	}
 
-	// Find Actors in this root Actor's hierarchy which are explicitly locked.
-	TArray<const AActor*>& ExplicitlyLockedActorsWithThisActorOnPath = LockedOwnershipRootActorToExplicitlyLockedActors.FindChecked(HierarchyRoot);
-	check(ExplicitlyLockedActorsWithThisActorOnPath.Num() > 0);
+	AActor* MutableActor = const_cast<AActor*>(Actor);
+	MutableActor->OnDestroyed.RemoveDynamic(this, &UOwnershipLockingPolicy::OnHierarchyActorDestroyed);
+	MutableActor->OnEndPlay.RemoveDynamic(this, &UOwnershipLockingPolicy::OnHierarchyActorEndPlay);
 
-	// If there's only one explicitly locked Actor in the hierarchy, we're removing the only Actor with this root,
-	// so we can stop caring about the root itself. Otherwise, just remove the specific Actor entry in the root's list.
-	if (ExplicitlyLockedActorsWithThisActorOnPath.Num() == 1)
+	if (HierarchyNode.Owner != nullptr)
 	{
-		LockedOwnershipRootActorToExplicitlyLockedActors.Remove(HierarchyRoot);
-		HierarchyRoot->OnDestroyed.RemoveDynamic(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted);
+		OwnershipHierarchy.FindChecked(HierarchyNode.Owner).OwnedActors.RemoveSingleSwap(Actor);
+		RemoveHierarchyNodeIfUnused(HierarchyNode.Owner);
 	}
-	else
+
+	// Actors owned by a deleted Actor become the roots of their own hierarchies, as in SpatialGDK::GetHierarchyRoot.
+	for (const AActor* OwnedActor : HierarchyNode.OwnedActors)
 	{
-		ExplicitlyLockedActorsWithThisActorOnPath.Remove(ExplicitlyLockedActor);
+		OwnershipHierarchy.FindChecked(OwnedActor).Owner = nullptr;
+		SetHierarchyRoot(OwnedActor, OwnedActor);
+		RemoveHierarchyNodeIfUnused(OwnedActor);
 	}
 }
 
-void UOwnershipLockingPolicy::AddOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor)
+void UOwnershipLockingPolicy::RemoveHierarchyNodeIfUnused(const AActor* Actor)
 {
-	if (HierarchyRoot == nullptr)
+	// An Actor without an owner, owned Actors or locks is its own hierarchy root, which is also what GetCachedHierarchyRoot
+	// returns for Actors that aren't in the hierarchy.
+	const OwnershipHierarchyNode& HierarchyNode = OwnershipHierarchy.FindChecked(Actor);
+	if (HierarchyNode.Owner == nullptr && HierarchyNode.OwnedActors.Num() == 0 && !IsExplicitlyLocked(Actor))
+	{
+		RemoveHierarchyNode(Actor);
+	}
+}
+
+void UOwnershipLockingPolicy::SetHierarchyRoot(const AActor* SubtreeRoot, const AActor* NewHierarchyRoot)
+{
+	// Every Actor in a subtree shares the same hierarchy root, so there's nothing to do if the subtree root already has it.
+	if (OwnershipHierarchy.FindChecked(SubtreeRoot).HierarchyRoot == NewHierarchyRoot)
 	{
 		return;
 	}
 
-	// For the hierarchy root of an explicitly locked Actor, we store a reference from the hierarchy root Actor back to
-	// the explicitly locked Actor, as well as binding a deletion delegate to the hierarchy root Actor.
-	TArray<const AActor*>& ExplicitlyLockedActorsWithThisActorOnPath = LockedOwnershipRootActorToExplicitlyLockedActors.FindOrAdd(HierarchyRoot);
-	ExplicitlyLockedActorsWithThisActorOnPath.AddUnique(ExplicitlyLockedActor);
+	TArray<const AActor*> ActorsToUpdate;
+	ActorsToUpdate.Add(SubtreeRoot);
+	while (ActorsToUpdate.Num() > 0)
+	{
+		const AActor* Actor = ActorsToUpdate.Pop(/* bAllowShrinking */ false);
+		OwnershipHierarchyNode& HierarchyNode = OwnershipHierarchy.FindChecked(Actor);
+
+		if (IsExplicitlyLocked(Actor))
+		{
+			RemoveLockedActorFromHierarchy(HierarchyNode.HierarchyRoot);
+			AddLockedActorToHierarchy(NewHierarchyRoot);
+		}
+
+		HierarchyNode.HierarchyRoot = NewHierarchyRoot;
+		ActorsToUpdate.Append(HierarchyNode.OwnedActors);
+	}
+}
+
+void UOwnershipLockingPolicy::AddLockedActorToHierarchy(const AActor* HierarchyRoot)
+{
+	++HierarchyRootToLockedActorCount.FindOrAdd(HierarchyRoot);
+}
+
+void UOwnershipLockingPolicy::RemoveLockedActorFromHierarchy(const AActor* HierarchyRoot)
+{
+	int32& LockedActorCount = HierarchyRootToLockedActorCount.FindChecked(HierarchyRoot);
+	check(LockedActorCount > 0);
 
-	if (!HierarchyRoot->OnDestroyed.IsAlreadyBound(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted))
+	if (--LockedActorCount == 0)
 	{
-		HierarchyRoot->OnDestroyed.AddDynamic(this, &UOwnershipLockingPolicy::OnHierarchyRootActorDeleted);
+		HierarchyRootToLockedActorCount.Remove(HierarchyRoot);
 	}
 }
@@ -43,6 +43,8 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, ActorReplicationRateLimit(0)
 	, EntityCreationRateLimit(0)
 	, bUseIsActorRelevantForConnection(false)
+	, bThrottleReplicationOutsideClientInterest(false)
+	, ReplicationIntervalOutsideClientInterest(1.0f)
 	, OpsUpdateRate(1000.0f)
 	, bEnableHandover(true)
 	, MaxNetCullDistanceSquared(0.0f) // Default disabled
@@ -62,7 +64,13 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, bEnableOffloading(false)
 	, ServerWorkerTypes({ SpatialConstants::DefaultServerWorkerType })
 	, WorkerLogLevel(ESettingsWorkerLogVerbosity::Warning)
+	, WorkerLogBytesPerSecond(0)
+	, MaxBufferedWorkerLogMessages(1024)
 	, bEnableUnrealLoadBalancer(false)
+	, MinimumAuthorityDwellTime(0.0f)
+	, HandoverPrefetchTime(0.0f)
+	, WorkerLoadReportInterval(0.0f)
+	, MaxAclAssignmentsPerTick(0)
 	, bRunSpatialWorkerConnectionOnGameThread(false)
 	, bUseRPCRingBuffers(true)
 	, DefaultRPCRingBufferSize(32)
@@ -79,6 +87,16 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, bEnableNetCullDistanceInterest(true)
 	, bEnableNetCullDistanceFrequency(false)
 	, FullFrequencyNetCullDistanceRatio(1.0f)
+	, bEnableLowDetailDistantInterest(false)
+	, LowDetailInterestFrequency(1.0f)
+	, bEnableDynamicNetCullDistanceFrequency(false)
+	, ClientInterestBandwidthBudget(32768.0f)
+	, NetCullDistanceFrequencyServerLoadBudget(0.9f)
+	, MinimumNetCullDistanceFrequencyScale(0.25f)
+	, NetCullDistanceFrequencyUpdateInterval(10.0f)
+	, NetCullDistanceFrequencyHysteresis(0.1f)
+	, InterestUpdateDebounceTime(0.0f)
+	, MaxInterestUpdatesPerTick(0)
 	, bUseSecureClientConnection(false)
 	, bUseSecureServerConnection(false)
 	, bEnableClientQueriesOnServer(false)
@@ -0,0 +1,62 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "SpatialView/OpListRecorder.h"
+#include "SpatialView/OpList/ReplayOpList.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace SpatialGDK
+{
+
+OpListRecorder::OpListRecorder(TUniquePtr<FArchive> InWriter)
+: Writer(MoveTemp(InWriter))
+, StartTime(FPlatformTime::Seconds())
+{
+	check(Writer.IsValid() && Writer->IsSaving());
+
+	uint32 Magic = OpListRecording::FileMagic;
+	uint32 Version = OpListRecording::FileVersion;
+	*Writer << Magic;
+	*Writer << Version;
+}
+
+OpListRecorder::~OpListRecorder()
+{
+	Writer->Close();
+}
+
+TUniquePtr<OpListRecorder> OpListRecorder::CreateForFile(const FString& FilePath)
+{
+	FArchive* FileWriter = IFileManager::Get().CreateFileWriter(*FilePath);
+	if (FileWriter == nullptr)
+	{
+		return nullptr;
+	}
+
+	return MakeUnique<OpListRecorder>(TUniquePtr<FArchive>(FileWriter));
+}
+
+void OpListRecorder::RecordOpList(const AbstractOpList& OpList)
+{
+	WriteFrameHeader();
+	ReplayOpList::WriteToArchive(*Writer, OpList);
+}
+
+void OpListRecorder::RecordOpList(const Worker_OpList& OpList)
+{
+	WriteFrameHeader();
+	ReplayOpList::WriteToArchive(*Writer, OpList);
+}
+
+void OpListRecorder::Flush()
+{
+	Writer->Flush();
+}
+
+void OpListRecorder::WriteFrameHeader()
+{
+	double Timestamp = FPlatformTime::Seconds() - StartTime;
+	*Writer << Timestamp;
+}
+
+}  // namespace SpatialGDK
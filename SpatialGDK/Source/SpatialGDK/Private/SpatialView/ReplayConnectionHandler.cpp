@@ -0,0 +1,123 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "SpatialView/ConnectionHandlers/ReplayConnectionHandler.h"
+#include "SpatialView/OpListRecorder.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace SpatialGDK
+{
+
+ReplayConnectionHandler::ReplayConnectionHandler(TUniquePtr<FArchive> InReader, float InPlaybackRate)
+: Reader(MoveTemp(InReader))
+, PlaybackRate(InPlaybackRate)
+{
+	check(Reader.IsValid() && Reader->IsLoading());
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	*Reader << Magic;
+	*Reader << Version;
+
+	bValid = !Reader->IsError() && Magic == OpListRecording::FileMagic && Version == OpListRecording::FileVersion;
+	if (bValid)
+	{
+		ReadNextFrame();
+	}
+}
+
+TUniquePtr<ReplayConnectionHandler> ReplayConnectionHandler::CreateForFile(const FString& FilePath, float PlaybackRate)
+{
+	FArchive* FileReader = IFileManager::Get().CreateFileReader(*FilePath);
+	if (FileReader == nullptr)
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<ReplayConnectionHandler> Handler = MakeUnique<ReplayConnectionHandler>(TUniquePtr<FArchive>(FileReader), PlaybackRate);
+	if (!Handler->IsValid())
+	{
+		return nullptr;
+	}
+	return Handler;
+}
+
+bool ReplayConnectionHandler::IsValid() const
+{
+	return bValid;
+}
+
+bool ReplayConnectionHandler::IsFinished() const
+{
+	return !PendingOpList.IsValid() && ReadyOpLists.Num() == 0;
+}
+
+void ReplayConnectionHandler::Advance()
+{
+	if (PlaybackRate <= 0.f)
+	{
+		if (PendingOpList.IsValid())
+		{
+			ReadyOpLists.Push(MoveTemp(PendingOpList));
+			ReadNextFrame();
+		}
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (!bStarted)
+	{
+		ReplayStartTime = Now;
+		bStarted = true;
+	}
+
+	const double RecordingTime = (Now - ReplayStartTime) * PlaybackRate;
+	while (PendingOpList.IsValid() && PendingTimestamp <= RecordingTime)
+	{
+		ReadyOpLists.Push(MoveTemp(PendingOpList));
+		ReadNextFrame();
+	}
+}
+
+uint32 ReplayConnectionHandler::GetOpListCount()
+{
+	return ReadyOpLists.Num();
+}
+
+TUniquePtr<AbstractOpList> ReplayConnectionHandler::GetNextOpList()
+{
+	if (ReadyOpLists.Num() == 0)
+	{
+		return MakeUnique<ReplayOpList>();
+	}
+
+	TUniquePtr<AbstractOpList> NextOpList = MoveTemp(ReadyOpLists[0]);
+	ReadyOpLists.RemoveAt(0);
+	return NextOpList;
+}
+
+void ReplayConnectionHandler::SendMessages(TUniquePtr<MessagesToSend> Messages)
+{
+	// There is no deployment to send to during a replay.
+}
+
+bool ReplayConnectionHandler::ReadNextFrame()
+{
+	PendingOpList.Reset();
+
+	if (Reader->AtEnd())
+	{
+		return false;
+	}
+
+	*Reader << PendingTimestamp;
+	if (Reader->IsError())
+	{
+		return false;
+	}
+
+	PendingOpList = ReplayOpList::ReadFromArchive(*Reader);
+	return PendingOpList.IsValid();
+}
+
+}  // namespace SpatialGDK
@@ -0,0 +1,599 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "SpatialView/OpList/ReplayOpList.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+
+constexpr uint32 NullStringLength = MAX_uint32;
+
+template <typename StoredType, typename ValueType>
+void WriteValue(FArchive& Ar, ValueType Value)
+{
+	// Worker SDK typedefs don't always match the UE integer types FArchive is overloaded for, so convert explicitly.
+	StoredType Stored = static_cast<StoredType>(Value);
+	Ar << Stored;
+}
+
+template <typename StoredType>
+StoredType ReadValue(FArchive& Ar)
+{
+	StoredType Stored{};
+	Ar << Stored;
+	return Stored;
+}
+
+// Reads an element count, and fails the read if that many elements can't fit in the bytes left in the archive.
+// Counts come straight from the file, so this stops a corrupt recording from causing a huge allocation.
+bool ReadCount(FArchive& Ar, uint32 MinElementSize, uint32& OutCount)
+{
+	OutCount = ReadValue<uint32>(Ar);
+	if (Ar.IsError() || static_cast<int64>(OutCount) * MinElementSize > Ar.TotalSize() - Ar.Tell())
+	{
+		Ar.SetError();
+		return false;
+	}
+	return true;
+}
+
+void WriteString(FArchive& Ar, const char* String)
+{
+	uint32 Length = String != nullptr ? static_cast<uint32>(FCStringAnsi::Strlen(String)) : NullStringLength;
+	Ar << Length;
+	if (String != nullptr)
+	{
+		Ar.Serialize(const_cast<char*>(String), Length);
+	}
+}
+
+void WriteSchemaObject(FArchive& Ar, Schema_Object* Object)
+{
+	uint32 Length = Schema_GetWriteBufferLength(Object);
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(Length);
+	Schema_SerializeToBuffer(Object, Buffer.GetData(), Length);
+
+	Ar << Length;
+	Ar.Serialize(Buffer.GetData(), Length);
+}
+
+bool ReadSchemaObject(FArchive& Ar, Schema_Object* Object)
+{
+	const uint32 Length = ReadValue<uint32>(Ar);
+	if (Ar.IsError() || Length > Ar.TotalSize() - Ar.Tell())
+	{
+		return false;
+	}
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(Length);
+	Ar.Serialize(Buffer.GetData(), Length);
+	return !Ar.IsError() && Schema_MergeFromBuffer(Object, Buffer.GetData(), Length) != 0;
+}
+
+void WriteComponentData(FArchive& Ar, const Worker_ComponentData& Data)
+{
+	WriteValue<uint32>(Ar, Data.component_id);
+	WriteSchemaObject(Ar, Schema_GetComponentDataFields(Data.schema_type));
+}
+
+void WriteComponentUpdate(FArchive& Ar, const Worker_ComponentUpdate& Update)
+{
+	WriteValue<uint32>(Ar, Update.component_id);
+	WriteSchemaObject(Ar, Schema_GetComponentUpdateFields(Update.schema_type));
+	WriteSchemaObject(Ar, Schema_GetComponentUpdateEvents(Update.schema_type));
+
+	TArray<Schema_FieldId> ClearedFields;
+	ClearedFields.SetNumUninitialized(Schema_GetComponentUpdateClearedFieldCount(Update.schema_type));
+	Schema_GetComponentUpdateClearedFieldList(Update.schema_type, ClearedFields.GetData());
+	WriteValue<uint32>(Ar, ClearedFields.Num());
+	for (Schema_FieldId FieldId : ClearedFields)
+	{
+		WriteValue<uint32>(Ar, FieldId);
+	}
+}
+
+void WriteMetrics(FArchive& Ar, const Worker_Metrics& Metrics)
+{
+	WriteValue<uint8>(Ar, Metrics.load != nullptr);
+	if (Metrics.load != nullptr)
+	{
+		WriteValue<double>(Ar, *Metrics.load);
+	}
+
+	WriteValue<uint32>(Ar, Metrics.gauge_metric_count);
+	for (uint32 i = 0; i < Metrics.gauge_metric_count; ++i)
+	{
+		WriteString(Ar, Metrics.gauge_metrics[i].key);
+		WriteValue<double>(Ar, Metrics.gauge_metrics[i].value);
+	}
+
+	WriteValue<uint32>(Ar, Metrics.histogram_metric_count);
+	for (uint32 i = 0; i < Metrics.histogram_metric_count; ++i)
+	{
+		const Worker_HistogramMetric& Histogram = Metrics.histogram_metrics[i];
+		WriteString(Ar, Histogram.key);
+		WriteValue<double>(Ar, Histogram.sum);
+		WriteValue<uint32>(Ar, Histogram.bucket_count);
+		for (uint32 j = 0; j < Histogram.bucket_count; ++j)
+		{
+			WriteValue<double>(Ar, Histogram.buckets[j].upper_bound);
+			WriteValue<uint32>(Ar, Histogram.buckets[j].samples);
+		}
+	}
+}
+
+void WriteOp(FArchive& Ar, const Worker_Op& Op)
+{
+	WriteValue<uint8>(Ar, Op.op_type);
+
+	switch (static_cast<Worker_OpType>(Op.op_type))
+	{
+	case WORKER_OP_TYPE_DISCONNECT:
+		WriteValue<uint8>(Ar, Op.op.disconnect.connection_status_code);
+		WriteString(Ar, Op.op.disconnect.reason);
+		break;
+	case WORKER_OP_TYPE_FLAG_UPDATE:
+		WriteString(Ar, Op.op.flag_update.name);
+		WriteString(Ar, Op.op.flag_update.value);
+		break;
+	case WORKER_OP_TYPE_LOG_MESSAGE:
+		WriteValue<uint8>(Ar, Op.op.log_message.level);
+		WriteString(Ar, Op.op.log_message.message);
+		break;
+	case WORKER_OP_TYPE_METRICS:
+		WriteMetrics(Ar, Op.op.metrics.metrics);
+		break;
+	case WORKER_OP_TYPE_CRITICAL_SECTION:
+		WriteValue<uint8>(Ar, Op.op.critical_section.in_critical_section);
+		break;
+	case WORKER_OP_TYPE_ADD_ENTITY:
+		WriteValue<int64>(Ar, Op.op.add_entity.entity_id);
+		break;
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+		WriteValue<int64>(Ar, Op.op.remove_entity.entity_id);
+		break;
+	case WORKER_OP_TYPE_RESERVE_ENTITY_IDS_RESPONSE:
+		WriteValue<int64>(Ar, Op.op.reserve_entity_ids_response.request_id);
+		WriteValue<uint8>(Ar, Op.op.reserve_entity_ids_response.status_code);
+		WriteString(Ar, Op.op.reserve_entity_ids_response.message);
+		WriteValue<int64>(Ar, Op.op.reserve_entity_ids_response.first_entity_id);
+		WriteValue<uint32>(Ar, Op.op.reserve_entity_ids_response.number_of_entity_ids);
+		break;
+	case WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE:
+		WriteValue<int64>(Ar, Op.op.create_entity_response.request_id);
+		WriteValue<uint8>(Ar, Op.op.create_entity_response.status_code);
+		WriteString(Ar, Op.op.create_entity_response.message);
+		WriteValue<int64>(Ar, Op.op.create_entity_response.entity_id);
+		break;
+	case WORKER_OP_TYPE_DELETE_ENTITY_RESPONSE:
+		WriteValue<int64>(Ar, Op.op.delete_entity_response.request_id);
+		WriteValue<int64>(Ar, Op.op.delete_entity_response.entity_id);
+		WriteValue<uint8>(Ar, Op.op.delete_entity_response.status_code);
+		WriteString(Ar, Op.op.delete_entity_response.message);
+		break;
+	case WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE:
+	{
+		const Worker_EntityQueryResponseOp& Response = Op.op.entity_query_response;
+		WriteValue<int64>(Ar, Response.request_id);
+		WriteValue<uint8>(Ar, Response.status_code);
+		WriteString(Ar, Response.message);
+		WriteValue<uint32>(Ar, Response.result_count);
+		// Count queries only fill in result_count.
+		WriteValue<uint8>(Ar, Response.results != nullptr);
+		if (Response.results != nullptr)
+		{
+			for (uint32 i = 0; i < Response.result_count; ++i)
+			{
+				WriteValue<int64>(Ar, Response.results[i].entity_id);
+				WriteValue<uint32>(Ar, Response.results[i].component_count);
+				for (uint32 j = 0; j < Response.results[i].component_count; ++j)
+				{
+					WriteComponentData(Ar, Response.results[i].components[j]);
+				}
+			}
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		WriteValue<int64>(Ar, Op.op.add_component.entity_id);
+		WriteComponentData(Ar, Op.op.add_component.data);
+		break;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		WriteValue<int64>(Ar, Op.op.remove_component.entity_id);
+		WriteValue<uint32>(Ar, Op.op.remove_component.component_id);
+		break;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		WriteValue<int64>(Ar, Op.op.authority_change.entity_id);
+		WriteValue<uint32>(Ar, Op.op.authority_change.component_id);
+		WriteValue<uint8>(Ar, Op.op.authority_change.authority);
+		break;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		WriteValue<int64>(Ar, Op.op.component_update.entity_id);
+		WriteComponentUpdate(Ar, Op.op.component_update.update);
+		break;
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+	{
+		const Worker_CommandRequestOp& Request = Op.op.command_request;
+		WriteValue<int64>(Ar, Request.request_id);
+		WriteValue<int64>(Ar, Request.entity_id);
+		WriteValue<uint32>(Ar, Request.timeout_millis);
+		WriteString(Ar, Request.caller_worker_id);
+		WriteValue<uint32>(Ar, Request.caller_attribute_set.attribute_count);
+		for (uint32 i = 0; i < Request.caller_attribute_set.attribute_count; ++i)
+		{
+			WriteString(Ar, Request.caller_attribute_set.attributes[i]);
+		}
+		WriteValue<uint32>(Ar, Request.request.component_id);
+		WriteValue<uint32>(Ar, Request.request.command_index);
+		WriteSchemaObject(Ar, Schema_GetCommandRequestObject(Request.request.schema_type));
+		break;
+	}
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+	{
+		const Worker_CommandResponseOp& Response = Op.op.command_response;
+		WriteValue<int64>(Ar, Response.request_id);
+		WriteValue<int64>(Ar, Response.entity_id);
+		WriteValue<uint8>(Ar, Response.status_code);
+		WriteString(Ar, Response.message);
+		WriteValue<uint32>(Ar, Response.command_id);
+		WriteValue<uint32>(Ar, Response.response.component_id);
+		WriteValue<uint32>(Ar, Response.response.command_index);
+		// Failed commands have no response payload.
+		WriteValue<uint8>(Ar, Response.response.schema_type != nullptr);
+		if (Response.response.schema_type != nullptr)
+		{
+			WriteSchemaObject(Ar, Schema_GetCommandResponseObject(Response.response.schema_type));
+		}
+		break;
+	}
+	}
+}
+
+} // anonymous namespace
+
+ReplayOpList::~ReplayOpList()
+{
+	for (Schema_ComponentData* Data : OwnedComponentData)
+	{
+		Schema_DestroyComponentData(Data);
+	}
+	for (Schema_ComponentUpdate* Update : OwnedComponentUpdates)
+	{
+		Schema_DestroyComponentUpdate(Update);
+	}
+	for (Schema_CommandRequest* Request : OwnedCommandRequests)
+	{
+		Schema_DestroyCommandRequest(Request);
+	}
+	for (Schema_CommandResponse* Response : OwnedCommandResponses)
+	{
+		Schema_DestroyCommandResponse(Response);
+	}
+	for (void* Memory : Allocations)
+	{
+		FMemory::Free(Memory);
+	}
+}
+
+Worker_OpList* ReplayOpList::GetWorkerOpList()
+{
+	WorkerOpList.ops = Ops.GetData();
+	WorkerOpList.op_count = Ops.Num();
+	return &WorkerOpList;
+}
+
+TUniquePtr<ReplayOpList> ReplayOpList::ReadFromArchive(FArchive& Ar)
+{
+	check(Ar.IsLoading());
+
+	// Every op is at least its one byte op type.
+	uint32 OpCount = 0;
+	if (!ReadCount(Ar, sizeof(uint8), OpCount))
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<ReplayOpList> OpList = MakeUnique<ReplayOpList>();
+	OpList->Ops.SetNumZeroed(OpCount);
+	for (Worker_Op& Op : OpList->Ops)
+	{
+		if (!OpList->ReadOp(Ar, Op))
+		{
+			return nullptr;
+		}
+	}
+
+	return OpList;
+}
+
+void ReplayOpList::WriteToArchive(FArchive& Ar, const AbstractOpList& OpList)
+{
+	check(Ar.IsSaving());
+
+	WriteValue<uint32>(Ar, OpList.GetCount());
+	for (uint32 i = 0; i < OpList.GetCount(); ++i)
+	{
+		WriteOp(Ar, OpList[i]);
+	}
+}
+
+void ReplayOpList::WriteToArchive(FArchive& Ar, const Worker_OpList& OpList)
+{
+	check(Ar.IsSaving());
+
+	WriteValue<uint32>(Ar, OpList.op_count);
+	for (uint32 i = 0; i < OpList.op_count; ++i)
+	{
+		WriteOp(Ar, OpList.ops[i]);
+	}
+}
+
+const char* ReplayOpList::ReadString(FArchive& Ar)
+{
+	const uint32 Length = ReadValue<uint32>(Ar);
+	if (Length == NullStringLength || Ar.IsError())
+	{
+		return nullptr;
+	}
+
+	if (Length > Ar.TotalSize() - Ar.Tell())
+	{
+		Ar.SetError();
+		return nullptr;
+	}
+
+	char* String = AllocateArray<char>(Length + 1);
+	Ar.Serialize(String, Length);
+	return String;
+}
+
+bool ReplayOpList::ReadComponentData(FArchive& Ar, Worker_ComponentData& OutData)
+{
+	OutData.component_id = ReadValue<uint32>(Ar);
+	OutData.schema_type = Schema_CreateComponentData();
+	OwnedComponentData.Add(OutData.schema_type);
+	return ReadSchemaObject(Ar, Schema_GetComponentDataFields(OutData.schema_type));
+}
+
+bool ReplayOpList::ReadComponentUpdate(FArchive& Ar, Worker_ComponentUpdate& OutUpdate)
+{
+	OutUpdate.component_id = ReadValue<uint32>(Ar);
+	OutUpdate.schema_type = Schema_CreateComponentUpdate();
+	OwnedComponentUpdates.Add(OutUpdate.schema_type);
+	if (!ReadSchemaObject(Ar, Schema_GetComponentUpdateFields(OutUpdate.schema_type)) ||
+		!ReadSchemaObject(Ar, Schema_GetComponentUpdateEvents(OutUpdate.schema_type)))
+	{
+		return false;
+	}
+
+	uint32 ClearedFieldCount = 0;
+	if (!ReadCount(Ar, sizeof(uint32), ClearedFieldCount))
+	{
+		return false;
+	}
+	for (uint32 i = 0; i < ClearedFieldCount; ++i)
+	{
+		Schema_AddComponentUpdateClearedField(OutUpdate.schema_type, ReadValue<uint32>(Ar));
+	}
+	return !Ar.IsError();
+}
+
+bool ReplayOpList::ReadOp(FArchive& Ar, Worker_Op& OutOp)
+{
+	OutOp.op_type = ReadValue<uint8>(Ar);
+	if (Ar.IsError())
+	{
+		return false;
+	}
+
+	switch (static_cast<Worker_OpType>(OutOp.op_type))
+	{
+	case WORKER_OP_TYPE_DISCONNECT:
+		OutOp.op.disconnect.connection_status_code = ReadValue<uint8>(Ar);
+		OutOp.op.disconnect.reason = ReadString(Ar);
+		break;
+	case WORKER_OP_TYPE_FLAG_UPDATE:
+		OutOp.op.flag_update.name = ReadString(Ar);
+		OutOp.op.flag_update.value = ReadString(Ar);
+		break;
+	case WORKER_OP_TYPE_LOG_MESSAGE:
+		OutOp.op.log_message.level = ReadValue<uint8>(Ar);
+		OutOp.op.log_message.message = ReadString(Ar);
+		break;
+	case WORKER_OP_TYPE_METRICS:
+	{
+		Worker_Metrics& Metrics = OutOp.op.metrics.metrics;
+		if (ReadValue<uint8>(Ar) != 0)
+		{
+			double* Load = AllocateArray<double>(1);
+			*Load = ReadValue<double>(Ar);
+			Metrics.load = Load;
+		}
+
+		// A gauge is at least a string length and a value.
+		if (!ReadCount(Ar, sizeof(uint32) + sizeof(double), Metrics.gauge_metric_count))
+		{
+			return false;
+		}
+		Worker_GaugeMetric* Gauges = AllocateArray<Worker_GaugeMetric>(Metrics.gauge_metric_count);
+		for (uint32 i = 0; i < Metrics.gauge_metric_count && !Ar.IsError(); ++i)
+		{
+			Gauges[i].key = ReadString(Ar);
+			Gauges[i].value = ReadValue<double>(Ar);
+		}
+		Metrics.gauge_metrics = Gauges;
+
+		// A histogram is at least a string length, a sum and a bucket count.
+		if (!ReadCount(Ar, sizeof(uint32) + sizeof(double) + sizeof(uint32), Metrics.histogram_metric_count))
+		{
+			return false;
+		}
+		Worker_HistogramMetric* Histograms = AllocateArray<Worker_HistogramMetric>(Metrics.histogram_metric_count);
+		for (uint32 i = 0; i < Metrics.histogram_metric_count && !Ar.IsError(); ++i)
+		{
+			Histograms[i].key = ReadString(Ar);
+			Histograms[i].sum = ReadValue<double>(Ar);
+			if (!ReadCount(Ar, sizeof(double) + sizeof(uint32), Histograms[i].bucket_count))
+			{
+				return false;
+			}
+			Worker_HistogramMetricBucket* Buckets = AllocateArray<Worker_HistogramMetricBucket>(Histograms[i].bucket_count);
+			for (uint32 j = 0; j < Histograms[i].bucket_count && !Ar.IsError(); ++j)
+			{
+				Buckets[j].upper_bound = ReadValue<double>(Ar);
+				Buckets[j].samples = ReadValue<uint32>(Ar);
+			}
+			Histograms[i].buckets = Buckets;
+		}
+		Metrics.histogram_metrics = Histograms;
+		break;
+	}
+	case WORKER_OP_TYPE_CRITICAL_SECTION:
+		OutOp.op.critical_section.in_critical_section = ReadValue<uint8>(Ar);
+		break;
+	case WORKER_OP_TYPE_ADD_ENTITY:
+		OutOp.op.add_entity.entity_id = ReadValue<int64>(Ar);
+		break;
+	case WORKER_OP_TYPE_REMOVE_ENTITY:
+		OutOp.op.remove_entity.entity_id = ReadValue<int64>(Ar);
+		break;
+	case WORKER_OP_TYPE_RESERVE_ENTITY_IDS_RESPONSE:
+		OutOp.op.reserve_entity_ids_response.request_id = ReadValue<int64>(Ar);
+		OutOp.op.reserve_entity_ids_response.status_code = ReadValue<uint8>(Ar);
+		OutOp.op.reserve_entity_ids_response.message = ReadString(Ar);
+		OutOp.op.reserve_entity_ids_response.first_entity_id = ReadValue<int64>(Ar);
+		OutOp.op.reserve_entity_ids_response.number_of_entity_ids = ReadValue<uint32>(Ar);
+		break;
+	case WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE:
+		OutOp.op.create_entity_response.request_id = ReadValue<int64>(Ar);
+		OutOp.op.create_entity_response.status_code = ReadValue<uint8>(Ar);
+		OutOp.op.create_entity_response.message = ReadString(Ar);
+		OutOp.op.create_entity_response.entity_id = ReadValue<int64>(Ar);
+		break;
+	case WORKER_OP_TYPE_DELETE_ENTITY_RESPONSE:
+		OutOp.op.delete_entity_response.request_id = ReadValue<int64>(Ar);
+		OutOp.op.delete_entity_response.entity_id = ReadValue<int64>(Ar);
+		OutOp.op.delete_entity_response.status_code = ReadValue<uint8>(Ar);
+		OutOp.op.delete_entity_response.message = ReadString(Ar);
+		break;
+	case WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE:
+	{
+		Worker_EntityQueryResponseOp& Response = OutOp.op.entity_query_response;
+		Response.request_id = ReadValue<int64>(Ar);
+		Response.status_code = ReadValue<uint8>(Ar);
+		Response.message = ReadString(Ar);
+		Response.result_count = ReadValue<uint32>(Ar);
+		if (ReadValue<uint8>(Ar) != 0)
+		{
+			// An entity is at least its id and component count.
+			if (static_cast<int64>(Response.result_count) * (sizeof(int64) + sizeof(uint32)) > Ar.TotalSize() - Ar.Tell())
+			{
+				return false;
+			}
+			Worker_Entity* Results = AllocateArray<Worker_Entity>(Response.result_count);
+			for (uint32 i = 0; i < Response.result_count && !Ar.IsError(); ++i)
+			{
+				Results[i].entity_id = ReadValue<int64>(Ar);
+				// A component is at least its id and schema data length.
+				if (!ReadCount(Ar, sizeof(uint32) + sizeof(uint32), Results[i].component_count))
+				{
+					return false;
+				}
+				Worker_ComponentData* Components = AllocateArray<Worker_ComponentData>(Results[i].component_count);
+				for (uint32 j = 0; j < Results[i].component_count; ++j)
+				{
+					if (!ReadComponentData(Ar, Components[j]))
+					{
+						return false;
+					}
+				}
+				Results[i].components = Components;
+			}
+			Response.results = Results;
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_ADD_COMPONENT:
+		OutOp.op.add_component.entity_id = ReadValue<int64>(Ar);
+		if (!ReadComponentData(Ar, OutOp.op.add_component.data))
+		{
+			return false;
+		}
+		break;
+	case WORKER_OP_TYPE_REMOVE_COMPONENT:
+		OutOp.op.remove_component.entity_id = ReadValue<int64>(Ar);
+		OutOp.op.remove_component.component_id = ReadValue<uint32>(Ar);
+		break;
+	case WORKER_OP_TYPE_AUTHORITY_CHANGE:
+		OutOp.op.authority_change.entity_id = ReadValue<int64>(Ar);
+		OutOp.op.authority_change.component_id = ReadValue<uint32>(Ar);
+		OutOp.op.authority_change.authority = ReadValue<uint8>(Ar);
+		break;
+	case WORKER_OP_TYPE_COMPONENT_UPDATE:
+		OutOp.op.component_update.entity_id = ReadValue<int64>(Ar);
+		if (!ReadComponentUpdate(Ar, OutOp.op.component_update.update))
+		{
+			return false;
+		}
+		break;
+	case WORKER_OP_TYPE_COMMAND_REQUEST:
+	{
+		Worker_CommandRequestOp& Request = OutOp.op.command_request;
+		Request.request_id = ReadValue<int64>(Ar);
+		Request.entity_id = ReadValue<int64>(Ar);
+		Request.timeout_millis = ReadValue<uint32>(Ar);
+		Request.caller_worker_id = ReadString(Ar);
+		if (!ReadCount(Ar, sizeof(uint32), Request.caller_attribute_set.attribute_count))
+		{
+			return false;
+		}
+		const char** Attributes = AllocateArray<const char*>(Request.caller_attribute_set.attribute_count);
+		for (uint32 i = 0; i < Request.caller_attribute_set.attribute_count && !Ar.IsError(); ++i)
+		{
+			Attributes[i] = ReadString(Ar);
+		}
+		Request.caller_attribute_set.attributes = Attributes;
+		Request.request.component_id = ReadValue<uint32>(Ar);
+		Request.request.command_index = ReadValue<uint32>(Ar);
+		Request.request.schema_type = Schema_CreateCommandRequest();
+		OwnedCommandRequests.Add(Request.request.schema_type);
+		if (!ReadSchemaObject(Ar, Schema_GetCommandRequestObject(Request.request.schema_type)))
+		{
+			return false;
+		}
+		break;
+	}
+	case WORKER_OP_TYPE_COMMAND_RESPONSE:
+	{
+		Worker_CommandResponseOp& Response = OutOp.op.command_response;
+		Response.request_id = ReadValue<int64>(Ar);
+		Response.entity_id = ReadValue<int64>(Ar);
+		Response.status_code = ReadValue<uint8>(Ar);
+		Response.message = ReadString(Ar);
+		Response.command_id = ReadValue<uint32>(Ar);
+		Response.response.component_id = ReadValue<uint32>(Ar);
+		Response.response.command_index = ReadValue<uint32>(Ar);
+		if (ReadValue<uint8>(Ar) != 0)
+		{
+			Response.response.schema_type = Schema_CreateCommandResponse();
+			OwnedCommandResponses.Add(Response.response.schema_type);
+			if (!ReadSchemaObject(Ar, Schema_GetCommandResponseObject(Response.response.schema_type)))
+			{
+				return false;
+			}
+		}
+		break;
+	}
+	default:
+		// Unknown op type, the recording was made with an incompatible Worker SDK.
+		return false;
+	}
+
+	return !Ar.IsError();
+}
+
+}  // namespace SpatialGDK
@@ -0,0 +1,220 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialView/ConnectionHandlers/ReplayConnectionHandler.h"
+#include "SpatialView/OpList/ViewDeltaLegacyOpList.h"
+#include "SpatialView/OpListRecorder.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+#define REPLAYCONNECTIONHANDLER_TEST(TestName) \
+	GDK_TEST(Core, ReplayConnectionHandler, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const Worker_EntityId TestEntityId = 42;
+	const Worker_ComponentId TestComponentId = 1000;
+	const Schema_FieldId TestFieldId = 1;
+	const uint32 TestFieldValue = 7;
+
+	Worker_Op CreateAuthorityChangeOp()
+	{
+		Worker_Op Op{};
+		Op.op_type = WORKER_OP_TYPE_AUTHORITY_CHANGE;
+		Op.op.authority_change.entity_id = TestEntityId;
+		Op.op.authority_change.component_id = TestComponentId;
+		Op.op.authority_change.authority = WORKER_AUTHORITY_AUTHORITATIVE;
+		return Op;
+	}
+
+	Worker_Op CreateCreateEntityResponseOp(const char* Message)
+	{
+		Worker_Op Op{};
+		Op.op_type = WORKER_OP_TYPE_CREATE_ENTITY_RESPONSE;
+		Op.op.create_entity_response.request_id = 3;
+		Op.op.create_entity_response.status_code = WORKER_STATUS_CODE_SUCCESS;
+		Op.op.create_entity_response.message = Message;
+		Op.op.create_entity_response.entity_id = TestEntityId;
+		return Op;
+	}
+
+	Worker_Op CreateAddComponentOp(Schema_ComponentData* Data)
+	{
+		Worker_Op Op{};
+		Op.op_type = WORKER_OP_TYPE_ADD_COMPONENT;
+		Op.op.add_component.entity_id = TestEntityId;
+		Op.op.add_component.data.component_id = TestComponentId;
+		Op.op.add_component.data.schema_type = Data;
+		return Op;
+	}
+
+	void RecordOpLists(TArray<uint8>& OutBuffer, const TArray<TArray<Worker_Op>>& OpLists)
+	{
+		OpListRecorder Recorder(MakeUnique<FMemoryWriter>(OutBuffer));
+		for (const TArray<Worker_Op>& Ops : OpLists)
+		{
+			Recorder.RecordOpList(ViewDeltaLegacyOpList(Ops));
+		}
+	}
+
+} // anonymous namespace
+
+REPLAYCONNECTIONHANDLER_TEST(GIVEN_recorded_op_lists_WHEN_replayed_with_zero_playback_rate_THEN_one_op_list_released_per_advance)
+{
+	// GIVEN
+	TArray<uint8> Buffer;
+	RecordOpLists(Buffer, { { CreateAuthorityChangeOp() }, { CreateAuthorityChangeOp(), CreateAuthorityChangeOp() } });
+
+	ReplayConnectionHandler Handler(MakeUnique<FMemoryReader>(Buffer), 0.f);
+	TestTrue("Recording is valid", Handler.IsValid());
+
+	// WHEN
+	Handler.Advance();
+
+	// THEN
+	TestTrue("One op list is available after the first advance", Handler.GetOpListCount() == 1);
+	TestTrue("First op list has one op", Handler.GetNextOpList()->GetCount() == 1);
+
+	Handler.Advance();
+	TestTrue("One op list is available after the second advance", Handler.GetOpListCount() == 1);
+	TestTrue("Second op list has two ops", Handler.GetNextOpList()->GetCount() == 2);
+	TestTrue("Replay is finished", Handler.IsFinished());
+
+	return true;
+}
+
+REPLAYCONNECTIONHANDLER_TEST(GIVEN_recorded_ops_with_strings_and_schema_data_WHEN_replayed_THEN_ops_are_reproduced)
+{
+	// GIVEN
+	Schema_ComponentData* Data = Schema_CreateComponentData();
+	Schema_AddUint32(Schema_GetComponentDataFields(Data), TestFieldId, TestFieldValue);
+
+	TArray<uint8> Buffer;
+	RecordOpLists(Buffer, { { CreateCreateEntityResponseOp("Created"), CreateAddComponentOp(Data) } });
+	Schema_DestroyComponentData(Data);
+
+	ReplayConnectionHandler Handler(MakeUnique<FMemoryReader>(Buffer), 0.f);
+
+	// WHEN
+	Handler.Advance();
+	TUniquePtr<AbstractOpList> OpList = Handler.GetNextOpList();
+
+	// THEN
+	TestTrue("Op list has two ops", OpList->GetCount() == 2);
+
+	const Worker_CreateEntityResponseOp& Response = (*OpList)[0].op.create_entity_response;
+	TestTrue("Create entity response entity ID is preserved", Response.entity_id == TestEntityId);
+	TestTrue("Create entity response message is preserved", FCStringAnsi::Strcmp(Response.message, "Created") == 0);
+
+	const Worker_AddComponentOp& AddComponent = (*OpList)[1].op.add_component;
+	TestTrue("Add component ID is preserved", AddComponent.data.component_id == TestComponentId);
+	TestTrue("Add component data is preserved",
+		Schema_GetUint32(Schema_GetComponentDataFields(AddComponent.data.schema_type), TestFieldId) == TestFieldValue);
+
+	return true;
+}
+
+REPLAYCONNECTIONHANDLER_TEST(GIVEN_archive_without_recording_header_WHEN_replay_created_THEN_it_is_invalid)
+{
+	// GIVEN
+	TArray<uint8> Buffer = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+	// WHEN
+	ReplayConnectionHandler Handler(MakeUnique<FMemoryReader>(Buffer), 1.f);
+
+	// THEN
+	TestFalse("Replay is invalid", Handler.IsValid());
+	TestTrue("Replay has nothing to release", Handler.IsFinished());
+
+	return true;
+}
+
+REPLAYCONNECTIONHANDLER_TEST(GIVEN_recorded_component_update_with_cleared_field_WHEN_replayed_THEN_cleared_field_is_preserved)
+{
+	// GIVEN
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate();
+	Schema_AddComponentUpdateClearedField(Update, TestFieldId);
+
+	Worker_Op Op{};
+	Op.op_type = WORKER_OP_TYPE_COMPONENT_UPDATE;
+	Op.op.component_update.entity_id = TestEntityId;
+	Op.op.component_update.update.component_id = TestComponentId;
+	Op.op.component_update.update.schema_type = Update;
+
+	TArray<uint8> Buffer;
+	RecordOpLists(Buffer, { { Op } });
+	Schema_DestroyComponentUpdate(Update);
+
+	ReplayConnectionHandler Handler(MakeUnique<FMemoryReader>(Buffer), 0.f);
+
+	// WHEN
+	Handler.Advance();
+	TUniquePtr<AbstractOpList> OpList = Handler.GetNextOpList();
+
+	// THEN
+	TestTrue("Op list has one op", OpList->GetCount() == 1);
+
+	Schema_ComponentUpdate* ReplayedUpdate = (*OpList)[0].op.component_update.update.schema_type;
+	TestTrue("Cleared field count is preserved", Schema_GetComponentUpdateClearedFieldCount(ReplayedUpdate) == 1);
+	Schema_FieldId ClearedFieldId = 0;
+	Schema_GetComponentUpdateClearedFieldList(ReplayedUpdate, &ClearedFieldId);
+	TestTrue("Cleared field ID is preserved", ClearedFieldId == TestFieldId);
+
+	return true;
+}
+
+REPLAYCONNECTIONHANDLER_TEST(GIVEN_recording_with_op_count_larger_than_the_file_WHEN_replay_created_THEN_no_op_list_is_read)
+{
+	// GIVEN
+	TArray<uint8> Buffer;
+	{
+		FMemoryWriter Writer(Buffer);
+		uint32 Magic = OpListRecording::FileMagic;
+		uint32 Version = OpListRecording::FileVersion;
+		double Timestamp = 0.0;
+		uint32 OpCount = MAX_uint32;
+		Writer << Magic << Version << Timestamp << OpCount;
+	}
+
+	// WHEN
+	ReplayConnectionHandler Handler(MakeUnique<FMemoryReader>(Buffer), 0.f);
+	Handler.Advance();
+
+	// THEN
+	TestTrue("Recording header is valid", Handler.IsValid());
+	TestTrue("Corrupt op list is not released", Handler.GetOpListCount() == 0);
+	TestTrue("Replay is finished", Handler.IsFinished());
+
+	return true;
+}
+
+REPLAYCONNECTIONHANDLER_TEST(GIVEN_recording_with_string_longer_than_the_file_WHEN_replay_created_THEN_no_op_list_is_read)
+{
+	// GIVEN
+	TArray<uint8> Buffer;
+	{
+		FMemoryWriter Writer(Buffer);
+		uint32 Magic = OpListRecording::FileMagic;
+		uint32 Version = OpListRecording::FileVersion;
+		double Timestamp = 0.0;
+		uint32 OpCount = 1;
+		uint8 OpType = WORKER_OP_TYPE_LOG_MESSAGE;
+		uint8 LogLevel = WORKER_LOG_LEVEL_INFO;
+		uint32 MessageLength = 1000;
+		Writer << Magic << Version << Timestamp << OpCount << OpType << LogLevel << MessageLength;
+	}
+
+	// WHEN
+	ReplayConnectionHandler Handler(MakeUnique<FMemoryReader>(Buffer), 0.f);
+	Handler.Advance();
+
+	// THEN
+	TestTrue("Recording header is valid", Handler.IsValid());
+	TestTrue("Op list with a truncated string is not released", Handler.GetOpListCount() == 0);
+	TestTrue("Replay is finished", Handler.IsFinished());
+
+	return true;
+}
@@ -11,6 +11,7 @@
 #include "EngineClasses/SpatialNetBitWriter.h"
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
+#include "Interop/SpatialSender.h"
 #include "Net/NetworkProfiler.h"
 #include "Schema/Interest.h"
 #include "SpatialConstants.h"
@@ -434,7 +435,19 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 	// Only support Interest for Actors for now.
 	if (Object->IsA<AActor>() && bInterestHasChanged)
 	{
-		ComponentUpdates.Add(NetDriver->InterestFactory->CreateInterestUpdate((AActor*)Object, Info, EntityId));
+		if (NetDriver->Sender != nullptr && NetDriver->Sender->ShouldQueueInterestUpdates())
+		{
+			// Sent on its own once debounced, rather than with the Actor's other component updates.
+			NetDriver->Sender->QueueInterestUpdate((AActor*)Object);
+		}
+		else
+		{
+			FWorkerComponentUpdate InterestUpdate = {};
+			if (NetDriver->InterestFactory->CreateInterestUpdate((AActor*)Object, Info, EntityId, InterestUpdate))
+			{
+				ComponentUpdates.Add(InterestUpdate);
+			}
+		}
 	}
 
 	return ComponentUpdates;
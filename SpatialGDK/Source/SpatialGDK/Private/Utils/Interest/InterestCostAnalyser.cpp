@@ -0,0 +1,213 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/Interest/InterestCostAnalyser.h"
+
+#include "Utils/Interest/QueryConstraintEvaluator.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+DEFINE_LOG_CATEGORY(LogInterestCostAnalyser);
+
+namespace SpatialGDK
+{
+
+FInterestCostReport InterestCostAnalyser::Analyse(const Interest& InInterest, const Coordinates& QueryOrigin, const TArray<FInterestCostEntity>& Entities)
+{
+	FInterestCostReport Report;
+
+	// The frequency each entity, and each of its components, is received at.
+	TArray<TOptional<float>> EntityFrequencies;
+	TArray<TMap<Worker_ComponentId, float>> ComponentFrequencies;
+	EntityFrequencies.SetNum(Entities.Num());
+	ComponentFrequencies.SetNum(Entities.Num());
+
+	for (const auto& ComponentInterestPair : InInterest.ComponentInterestMap)
+	{
+		for (const Query& InterestQuery : ComponentInterestPair.Value.Queries)
+		{
+			FInterestCostQueryReport& QueryReport = Report.Queries.AddDefaulted_GetRef();
+			QueryReport.ComponentId = ComponentInterestPair.Key;
+			QueryReport.Frequency = GetQueryFrequency(InterestQuery);
+			GetConstraintComplexity(InterestQuery.Constraint, QueryReport.NumConstraints, QueryReport.ConstraintDepth);
+
+			const bool bFullSnapshot = InterestQuery.FullSnapshotResult.IsSet() && InterestQuery.FullSnapshotResult.GetValue();
+
+			for (int32 EntityIndex = 0; EntityIndex < Entities.Num(); EntityIndex++)
+			{
+				const FInterestCostEntity& Entity = Entities[EntityIndex];
+				const bool bMatches = QueryConstraintEvaluator::IsEntityInConstraint(InterestQuery.Constraint, Entity.EntityId, Entity.Position,
+					[&Entity](Worker_ComponentId ComponentId) { return Entity.ComponentSizes.Contains(ComponentId); }, QueryOrigin);
+				if (!bMatches)
+				{
+					continue;
+				}
+
+				QueryReport.NumMatchingEntities++;
+
+				TOptional<float>& EntityFrequency = EntityFrequencies[EntityIndex];
+				if (!EntityFrequency.IsSet() || IsHigherFrequency(QueryReport.Frequency, EntityFrequency.GetValue()))
+				{
+					EntityFrequency = QueryReport.Frequency;
+				}
+
+				for (const auto& ComponentSizePair : Entity.ComponentSizes)
+				{
+					if (!bFullSnapshot && !InterestQuery.ResultComponentIds.Contains(ComponentSizePair.Key))
+					{
+						continue;
+					}
+
+					QueryReport.ResultBytes += ComponentSizePair.Value;
+
+					float* ComponentFrequency = ComponentFrequencies[EntityIndex].Find(ComponentSizePair.Key);
+					if (ComponentFrequency == nullptr)
+					{
+						ComponentFrequencies[EntityIndex].Add(ComponentSizePair.Key, QueryReport.Frequency);
+					}
+					else if (IsHigherFrequency(QueryReport.Frequency, *ComponentFrequency))
+					{
+						*ComponentFrequency = QueryReport.Frequency;
+					}
+				}
+			}
+
+			FInterestCostTierReport* Tier = Report.Tiers.FindByPredicate([&QueryReport](const FInterestCostTierReport& Other) { return Other.Frequency == QueryReport.Frequency; });
+			if (Tier == nullptr)
+			{
+				Tier = &Report.Tiers.AddDefaulted_GetRef();
+				Tier->Frequency = QueryReport.Frequency;
+			}
+			Tier->NumQueries++;
+		}
+	}
+
+	for (int32 EntityIndex = 0; EntityIndex < Entities.Num(); EntityIndex++)
+	{
+		if (!EntityFrequencies[EntityIndex].IsSet())
+		{
+			continue;
+		}
+
+		Report.NumCheckedOutEntities++;
+		const float EntityFrequency = EntityFrequencies[EntityIndex].GetValue();
+		Report.Tiers.FindByPredicate([EntityFrequency](const FInterestCostTierReport& Tier) { return Tier.Frequency == EntityFrequency; })->NumEntities++;
+
+		for (const auto& ComponentFrequencyPair : ComponentFrequencies[EntityIndex])
+		{
+			const uint32 Size = Entities[EntityIndex].ComponentSizes.FindChecked(ComponentFrequencyPair.Key);
+			const float ComponentFrequency = ComponentFrequencyPair.Value;
+			Report.Tiers.FindByPredicate([ComponentFrequency](const FInterestCostTierReport& Tier) { return Tier.Frequency == ComponentFrequency; })->Bytes += Size;
+			Report.TotalBytes += Size;
+		}
+	}
+
+	Report.Tiers.Sort([](const FInterestCostTierReport& Lhs, const FInterestCostTierReport& Rhs)
+	{
+		return IsHigherFrequency(Lhs.Frequency, Rhs.Frequency);
+	});
+
+	return Report;
+}
+
+void InterestCostAnalyser::GetConstraintComplexity(const QueryConstraint& Constraint, int32& OutNumConstraints, int32& OutDepth)
+{
+	OutNumConstraints = 1;
+	OutDepth = 1;
+
+	int32 ChildDepth = 0;
+	for (const TArray<QueryConstraint>* Children : { &Constraint.AndConstraint, &Constraint.OrConstraint })
+	{
+		for (const QueryConstraint& Child : *Children)
+		{
+			int32 NumChildConstraints = 0;
+			int32 Depth = 0;
+			GetConstraintComplexity(Child, NumChildConstraints, Depth);
+			OutNumConstraints += NumChildConstraints;
+			ChildDepth = FMath::Max(ChildDepth, Depth);
+		}
+	}
+
+	OutDepth += ChildDepth;
+}
+
+bool InterestCostAnalyser::ReadSnapshot(const FString& SnapshotPath, TArray<FInterestCostEntity>& OutEntities)
+{
+	Worker_ComponentVtable DefaultVtable{};
+	Worker_SnapshotParameters Parameters{};
+	Parameters.default_component_vtable = &DefaultVtable;
+
+	Worker_SnapshotInputStream* InputStream = Worker_SnapshotInputStream_Create(TCHAR_TO_UTF8(*SnapshotPath), &Parameters);
+	if (const char* SchemaError = Worker_SnapshotInputStream_GetState(InputStream).error_message)
+	{
+		UE_LOG(LogInterestCostAnalyser, Error, TEXT("Error opening snapshot %s: %s"), *SnapshotPath, UTF8_TO_TCHAR(SchemaError));
+		Worker_SnapshotInputStream_Destroy(InputStream);
+		return false;
+	}
+
+	bool bSuccess = true;
+	while (Worker_SnapshotInputStream_HasNext(InputStream))
+	{
+		const Worker_Entity* Entity = Worker_SnapshotInputStream_ReadEntity(InputStream);
+		if (Worker_SnapshotInputStream_GetState(InputStream).stream_state != WORKER_STREAM_STATE_GOOD)
+		{
+			UE_LOG(LogInterestCostAnalyser, Error, TEXT("Error reading snapshot %s: %s"), *SnapshotPath, UTF8_TO_TCHAR(Worker_SnapshotInputStream_GetState(InputStream).error_message));
+			bSuccess = false;
+			break;
+		}
+
+		FInterestCostEntity& CostEntity = OutEntities.AddDefaulted_GetRef();
+		CostEntity.EntityId = Entity->entity_id;
+		CostEntity.Position = DeploymentOrigin;
+
+		for (uint32 i = 0; i < Entity->component_count; i++)
+		{
+			const Worker_ComponentData& Data = Entity->components[i];
+			CostEntity.ComponentSizes.Add(Data.component_id, Schema_GetWriteBufferLength(Schema_GetComponentDataFields(Data.schema_type)));
+
+			if (Data.component_id == SpatialConstants::POSITION_COMPONENT_ID)
+			{
+				CostEntity.Position = Position(Data).Coords;
+			}
+		}
+	}
+
+	Worker_SnapshotInputStream_Destroy(InputStream);
+	return bSuccess;
+}
+
+float InterestCostAnalyser::GetQueryFrequency(const Query& InQuery)
+{
+	// An unset frequency means updates are not rate limited.
+	return InQuery.Frequency.IsSet() ? InQuery.Frequency.GetValue() : 0.f;
+}
+
+bool InterestCostAnalyser::IsHigherFrequency(float Frequency, float OtherFrequency)
+{
+	if (Frequency == 0.f || OtherFrequency == 0.f)
+	{
+		return Frequency == 0.f && OtherFrequency != 0.f;
+	}
+	return Frequency > OtherFrequency;
+}
+
+FString FInterestCostReport::ToString() const
+{
+	FString Result = FString::Printf(TEXT("%d queries, %d checked out entities, %llu bytes checked out\n"), Queries.Num(), NumCheckedOutEntities, TotalBytes);
+
+	for (const FInterestCostTierReport& Tier : Tiers)
+	{
+		const FString FrequencyName = Tier.Frequency == 0.f ? FString(TEXT("full")) : FString::Printf(TEXT("%.2f Hz"), Tier.Frequency);
+		Result += FString::Printf(TEXT("  Tier %s: %d queries, %d entities, %llu bytes\n"), *FrequencyName, Tier.NumQueries, Tier.NumEntities, Tier.Bytes);
+	}
+
+	for (const FInterestCostQueryReport& QueryReport : Queries)
+	{
+		const FString FrequencyName = QueryReport.Frequency == 0.f ? FString(TEXT("full")) : FString::Printf(TEXT("%.2f Hz"), QueryReport.Frequency);
+		Result += FString::Printf(TEXT("  Query on component %u at %s: %d constraints, depth %d, %d matching entities, %llu bytes\n"),
+			QueryReport.ComponentId, *FrequencyName, QueryReport.NumConstraints, QueryReport.ConstraintDepth, QueryReport.NumMatchingEntities, QueryReport.ResultBytes);
+	}
+
+	return Result;
+}
+
+} // namespace SpatialGDK
@@ -18,7 +18,7 @@ namespace SpatialGDK
 // And this the empty optional type it will be translated to.
 const TSchemaOption<float> FullFrequencyOptional = TSchemaOption<float>();
 
-FrequencyConstraints NetCullDistanceInterest::CreateCheckoutRadiusConstraints(USpatialClassInfoManager* InClassInfoManager)
+FrequencyConstraints NetCullDistanceInterest::CreateCheckoutRadiusConstraints(USpatialClassInfoManager* InClassInfoManager, float FrequencyDistanceScale)
 {
 	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
 
@@ -32,7 +32,75 @@ FrequencyConstraints NetCullDistanceInterest::CreateCheckoutRadiusConstraints(US
 		return NetCullDistanceInterest::CreateNetCullDistanceConstraint(InClassInfoManager);
 	}
 
-	return NetCullDistanceInterest::CreateNetCullDistanceConstraintWithFrequency(InClassInfoManager);
+	return NetCullDistanceInterest::CreateNetCullDistanceConstraintWithFrequency(InClassInfoManager, FrequencyDistanceScale);
+}
+
+float NetCullDistanceInterest::GetFrequencyAtDistanceRatio(float DistanceRatio, float FrequencyDistanceScale)
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	const float OuterDistanceRatio = GetOuterDistanceRatio();
+
+	if (DistanceRatio <= ScaleDistanceRatio(SpatialGDKSettings->FullFrequencyNetCullDistanceRatio, OuterDistanceRatio, FrequencyDistanceScale))
+	{
+		return TNumericLimits<float>::Max();
+	}
+
+	// Buckets overlap, so an entity is received at the highest frequency of all the buckets it is in.
+	float Frequency = 0.f;
+	for (const auto& DistanceFrequencyPair : SpatialGDKSettings->InterestRangeFrequencyPairs)
+	{
+		if (DistanceRatio <= ScaleDistanceRatio(DistanceFrequencyPair.DistanceRatio, OuterDistanceRatio, FrequencyDistanceScale))
+		{
+			Frequency = FMath::Max(Frequency, DistanceFrequencyPair.Frequency);
+		}
+	}
+
+	return Frequency;
+}
+
+float NetCullDistanceInterest::ComputeFrequencyDistanceScale(float CurrentScale, float Pressure, float MinimumScale, float Hysteresis)
+{
+	if (FMath::Abs(Pressure - 1.f) <= Hysteresis)
+	{
+		return CurrentScale;
+	}
+
+	if (Pressure <= KINDA_SMALL_NUMBER)
+	{
+		return 1.f;
+	}
+
+	// The number of entities inside a bucket grows with its area, so the radii are scaled by the square root of the pressure.
+	return FMath::Clamp(CurrentScale / FMath::Sqrt(Pressure), FMath::Min(MinimumScale, 1.f), 1.f);
+}
+
+float NetCullDistanceInterest::ComputeServerLoadPressure(float FrameTime, float IdleTime, uint32 NumFrames, float MaxTickRate, float LoadBudget)
+{
+	if (NumFrames == 0 || MaxTickRate <= 0.f || LoadBudget <= 0.f)
+	{
+		return 0.f;
+	}
+
+	const float AverageBusyTime = FMath::Max(FrameTime - IdleTime, 0.f) / NumFrames;
+	return AverageBusyTime * MaxTickRate / LoadBudget;
+}
+
+float NetCullDistanceInterest::GetOuterDistanceRatio()
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	float OuterDistanceRatio = SpatialGDKSettings->FullFrequencyNetCullDistanceRatio;
+	for (const auto& DistanceFrequencyPair : SpatialGDKSettings->InterestRangeFrequencyPairs)
+	{
+		OuterDistanceRatio = FMath::Max(OuterDistanceRatio, DistanceFrequencyPair.DistanceRatio);
+	}
+	return OuterDistanceRatio;
+}
+
+float NetCullDistanceInterest::ScaleDistanceRatio(float DistanceRatio, float OuterDistanceRatio, float FrequencyDistanceScale)
+{
+	// The outermost bucket defines how far clients can see, so only the buckets inside it are scaled.
+	return DistanceRatio < OuterDistanceRatio ? DistanceRatio * FrequencyDistanceScale : DistanceRatio;
 }
 
 FrequencyConstraints NetCullDistanceInterest::CreateLegacyNetCullDistanceConstraint(USpatialClassInfoManager* InClassInfoManager)
@@ -98,10 +166,11 @@ FrequencyConstraints NetCullDistanceInterest::CreateNetCullDistanceConstraint(US
 	return { { FullFrequencyOptional, CheckoutRadiusConstraintRoot } };
 }
 
-FrequencyConstraints NetCullDistanceInterest::CreateNetCullDistanceConstraintWithFrequency(USpatialClassInfoManager* InClassInfoManager)
+FrequencyConstraints NetCullDistanceInterest::CreateNetCullDistanceConstraintWithFrequency(USpatialClassInfoManager* InClassInfoManager, float FrequencyDistanceScale)
 {
 	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
 	const TMap<float, Worker_ComponentId>& NetCullDistancesToComponentIds = InClassInfoManager->GetNetCullDistanceToComponentIds();
+	const float OuterDistanceRatio = GetOuterDistanceRatio();
 
 	FrequencyToConstraintsMap FrequencyToConstraints;
 
@@ -112,7 +181,7 @@ FrequencyConstraints NetCullDistanceInterest::CreateNetCullDistanceConstraintWit
 		QueryConstraint ComponentConstraint;
 		ComponentConstraint.ComponentConstraint = DistanceComponentPair.Value;
 
-		float FullFrequencyCheckoutRadius = MaxCheckoutRadiusMeters * SpatialGDKSettings->FullFrequencyNetCullDistanceRatio;
+		float FullFrequencyCheckoutRadius = MaxCheckoutRadiusMeters * ScaleDistanceRatio(SpatialGDKSettings->FullFrequencyNetCullDistanceRatio, OuterDistanceRatio, FrequencyDistanceScale);
 
 		QueryConstraint RadiusConstraint;
 		RadiusConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ FullFrequencyCheckoutRadius };
@@ -126,7 +195,7 @@ FrequencyConstraints NetCullDistanceInterest::CreateNetCullDistanceConstraintWit
 		// Add interest query for specified distance/frequency pairs
 		for (const auto& DistanceFrequencyPair : SpatialGDKSettings->InterestRangeFrequencyPairs)
 		{
-			float CheckoutRadius = MaxCheckoutRadiusMeters * DistanceFrequencyPair.DistanceRatio;
+			float CheckoutRadius = MaxCheckoutRadiusMeters * ScaleDistanceRatio(DistanceFrequencyPair.DistanceRatio, OuterDistanceRatio, FrequencyDistanceScale);
 
 			QueryConstraint FrequencyRadiusConstraint;
 			FrequencyRadiusConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ CheckoutRadius };
@@ -0,0 +1,116 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/Interest/QueryConstraintEvaluator.h"
+
+namespace SpatialGDK
+{
+
+bool QueryConstraintEvaluator::IsEntityInConstraint(const QueryConstraint& Constraint, Worker_EntityId EntityId, const Coordinates& EntityPosition,
+	FHasComponent HasComponent, const Coordinates& QueryOrigin)
+{
+	// A valid constraint sets exactly one of its options.
+	if (Constraint.SphereConstraint.IsSet())
+	{
+		return IsInSphere(Constraint.SphereConstraint->Center, Constraint.SphereConstraint->Radius, EntityPosition);
+	}
+
+	if (Constraint.CylinderConstraint.IsSet())
+	{
+		return IsInCylinder(Constraint.CylinderConstraint->Center, Constraint.CylinderConstraint->Radius, EntityPosition);
+	}
+
+	if (Constraint.BoxConstraint.IsSet())
+	{
+		return IsInBox(Constraint.BoxConstraint->Center, Constraint.BoxConstraint->EdgeLength, EntityPosition);
+	}
+
+	if (Constraint.RelativeSphereConstraint.IsSet())
+	{
+		return IsInSphere(QueryOrigin, Constraint.RelativeSphereConstraint->Radius, EntityPosition);
+	}
+
+	if (Constraint.RelativeCylinderConstraint.IsSet())
+	{
+		return IsInCylinder(QueryOrigin, Constraint.RelativeCylinderConstraint->Radius, EntityPosition);
+	}
+
+	if (Constraint.RelativeBoxConstraint.IsSet())
+	{
+		return IsInBox(QueryOrigin, Constraint.RelativeBoxConstraint->EdgeLength, EntityPosition);
+	}
+
+	if (Constraint.EntityIdConstraint.IsSet())
+	{
+		return Constraint.EntityIdConstraint.GetValue() == EntityId;
+	}
+
+	if (Constraint.ComponentConstraint.IsSet())
+	{
+		return HasComponent(Constraint.ComponentConstraint.GetValue());
+	}
+
+	if (Constraint.AndConstraint.Num() > 0)
+	{
+		for (const QueryConstraint& Conjunct : Constraint.AndConstraint)
+		{
+			if (!IsEntityInConstraint(Conjunct, EntityId, EntityPosition, HasComponent, QueryOrigin))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	for (const QueryConstraint& Disjunct : Constraint.OrConstraint)
+	{
+		if (IsEntityInConstraint(Disjunct, EntityId, EntityPosition, HasComponent, QueryOrigin))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool QueryConstraintEvaluator::IsEntityInInterest(const Interest& Interest, Worker_ComponentId ComponentId, Worker_EntityId EntityId, const Coordinates& EntityPosition,
+	FHasComponent HasComponent, const Coordinates& QueryOrigin)
+{
+	const ComponentInterest* Queries = Interest.ComponentInterestMap.Find(ComponentId);
+	if (Queries == nullptr)
+	{
+		return false;
+	}
+
+	for (const Query& InterestQuery : Queries->Queries)
+	{
+		if (IsEntityInConstraint(InterestQuery.Constraint, EntityId, EntityPosition, HasComponent, QueryOrigin))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool QueryConstraintEvaluator::IsInSphere(const Coordinates& Center, double Radius, const Coordinates& Position)
+{
+	const double DX = Position.X - Center.X;
+	const double DY = Position.Y - Center.Y;
+	const double DZ = Position.Z - Center.Z;
+	return DX * DX + DY * DY + DZ * DZ <= Radius * Radius;
+}
+
+bool QueryConstraintEvaluator::IsInCylinder(const Coordinates& Center, double Radius, const Coordinates& Position)
+{
+	// Y is up in SpatialOS coordinates.
+	const double DX = Position.X - Center.X;
+	const double DZ = Position.Z - Center.Z;
+	return DX * DX + DZ * DZ <= Radius * Radius;
+}
+
+bool QueryConstraintEvaluator::IsInBox(const Coordinates& Center, const EdgeLength& Edges, const Coordinates& Position)
+{
+	return FMath::Abs(Position.X - Center.X) <= Edges.X / 2.0
+		&& FMath::Abs(Position.Y - Center.Y) <= Edges.Y / 2.0
+		&& FMath::Abs(Position.Z - Center.Z) <= Edges.Z / 2.0;
+}
+
+} // namespace SpatialGDK
@@ -10,9 +10,11 @@
 #include "SpatialGDKSettings.h"
 #include "SpatialConstants.h"
 #include "Utils/Interest/NetCullDistanceInterest.h"
+#include "Utils/SchemaDatabase.h"
 
 #include "Engine/World.h"
 #include "Engine/Classes/GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
 #include "UObject/UObjectIterator.h"
 
@@ -33,11 +35,145 @@ InterestFactory::InterestFactory(USpatialClassInfoManager* InClassInfoManager, U
 
 void InterestFactory::CreateAndCacheInterestState()
 {
-	ClientCheckoutRadiusConstraint = NetCullDistanceInterest::CreateCheckoutRadiusConstraints(ClassInfoManager);
 	ClientNonAuthInterestResultType = CreateClientNonAuthInterestResultType();
 	ClientAuthInterestResultType = CreateClientAuthInterestResultType();
 	ServerNonAuthInterestResultType = CreateServerNonAuthInterestResultType();
 	ServerAuthInterestResultType = CreateServerAuthInterestResultType();
+	AlwaysRelevantConstraint = CreateAlwaysRelevantConstraint();
+	CreateNetCullDistanceQueries();
+}
+
+void InterestFactory::CreateNetCullDistanceQueries()
+{
+	ClientNetCullDistanceQueries.Reset();
+	ServerNetCullDistanceQueries.Reset();
+
+	// Actor classes loaded since the queries were last built are picked up whenever they are rebuilt.
+	CreateNetCullDistanceActorComponentIds();
+
+	// The CheckoutConstraints list contains items with a constraint and a frequency.
+	// They are converted to queries by adding a result type to them. Client queries are conjoined with the level constraint later.
+	for (const FrequencyConstraint& CheckoutRadiusConstraintFrequencyPair : NetCullDistanceInterest::CreateCheckoutRadiusConstraints(ClassInfoManager, NetCullDistanceFrequencyScale))
+	{
+		if (!CheckoutRadiusConstraintFrequencyPair.Constraint.IsValid())
+		{
+			continue;
+		}
+
+		Query& ClientQuery = ClientNetCullDistanceQueries.AddDefaulted_GetRef();
+		ClientQuery.Constraint.AndConstraint.Add(CheckoutRadiusConstraintFrequencyPair.Constraint);
+		ClientQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
+		if (ShouldUseLowDetailResultType(ClientQuery.Frequency))
+		{
+			ClientQuery.ResultComponentIds = CreateClientLowDetailInterestResultType(CheckoutRadiusConstraintFrequencyPair.Constraint);
+		}
+		else
+		{
+			SetResultType(ClientQuery, ClientNonAuthInterestResultType);
+		}
+
+		Query& ServerQuery = ServerNetCullDistanceQueries.AddDefaulted_GetRef();
+		ServerQuery.Constraint = CheckoutRadiusConstraintFrequencyPair.Constraint;
+		ServerQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
+		SetResultType(ServerQuery, ServerNonAuthInterestResultType);
+	}
+}
+
+void InterestFactory::CreateNetCullDistanceActorComponentIds()
+{
+	NetCullDistanceComponentToActorComponentIds.Reset();
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (!SpatialGDKSettings->bEnableLowDetailDistantInterest || !SpatialGDKSettings->bEnableResultTypes)
+	{
+		return;
+	}
+
+	// Net cull distance marker components are assigned from NetCullDistanceSquared, so group the Actor classes clients can see by their default.
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		if (!It->IsChildOf<AActor>() || It->HasAnyClassFlags(CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+		if (!It->HasAnySpatialClassFlags(SPATIALCLASS_SpatialType) || It->HasAnySpatialClassFlags(SPATIALCLASS_ServerOnly))
+		{
+			continue;
+		}
+
+		const AActor* DefaultActor = GetDefault<AActor>(*It);
+		const Worker_ComponentId NetCullDistanceComponentId = ClassInfoManager->GetComponentIdForNetCullDistance(DefaultActor->NetCullDistanceSquared);
+		const Worker_ComponentId ActorComponentId = ClassInfoManager->GetComponentIdForClass(**It);
+		if (NetCullDistanceComponentId == SpatialConstants::INVALID_COMPONENT_ID || ActorComponentId == SpatialConstants::INVALID_COMPONENT_ID)
+		{
+			continue;
+		}
+
+		NetCullDistanceComponentToActorComponentIds.FindOrAdd(NetCullDistanceComponentId).AddUnique(ActorComponentId);
+	}
+}
+
+bool InterestFactory::ShouldUseLowDetailResultType(const TSchemaOption<float>& Frequency) const
+{
+	// An unset frequency is the full frequency bucket, which always receives everything.
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	return SpatialGDKSettings->bEnableLowDetailDistantInterest && SpatialGDKSettings->bEnableResultTypes
+		&& Frequency.IsSet() && Frequency.GetValue() <= SpatialGDKSettings->LowDetailInterestFrequency;
+}
+
+ResultType InterestFactory::CreateClientLowDetailInterestResultType(const QueryConstraint& Constraint) const
+{
+	ResultType LowDetailResultType;
+
+	// Add the required unreal components
+	LowDetailResultType.Append(SpatialConstants::REQUIRED_COMPONENTS_FOR_NON_AUTH_CLIENT_INTEREST);
+
+	// Add the data components of the Actor classes the constraint can match, found through its net cull distance marker components.
+	TArray<const QueryConstraint*> ConstraintsToVisit = { &Constraint };
+	while (ConstraintsToVisit.Num() > 0)
+	{
+		const QueryConstraint* Current = ConstraintsToVisit.Pop(/* bAllowShrinking */ false);
+		if (Current->ComponentConstraint.IsSet())
+		{
+			const TArray<Worker_ComponentId>* ActorComponentIds = NetCullDistanceComponentToActorComponentIds.Find(Current->ComponentConstraint.GetValue());
+			if (ActorComponentIds == nullptr)
+			{
+				// No loaded Actor class has this net cull distance, so the data components its entities need are unknown.
+				UE_LOG(LogInterestFactory, Verbose, TEXT("No Actor classes found for component %u, using the full client result type."), Current->ComponentConstraint.GetValue());
+				return ClientNonAuthInterestResultType;
+			}
+
+			for (const Worker_ComponentId ActorComponentId : *ActorComponentIds)
+			{
+				LowDetailResultType.AddUnique(ActorComponentId);
+			}
+		}
+		for (const QueryConstraint& Child : Current->AndConstraint)
+		{
+			ConstraintsToVisit.Add(&Child);
+		}
+		for (const QueryConstraint& Child : Current->OrConstraint)
+		{
+			ConstraintsToVisit.Add(&Child);
+		}
+	}
+
+	return LowDetailResultType;
+}
+
+bool InterestFactory::SetNetCullDistanceFrequencyScale(float InScale)
+{
+	if (InScale == NetCullDistanceFrequencyScale)
+	{
+		return false;
+	}
+
+	NetCullDistanceFrequencyScale = InScale;
+
+	const TArray<Query> PreviousClientQueries = MoveTemp(ClientNetCullDistanceQueries);
+	CreateNetCullDistanceQueries();
+
+	return ClientNetCullDistanceQueries != PreviousClientQueries;
 }
 
 ResultType InterestFactory::CreateClientNonAuthInterestResultType()
@@ -83,20 +219,66 @@ ResultType InterestFactory::CreateServerNonAuthInterestResultType()
 	return ServerNonAuthResultType;
 }
 
+ResultType InterestFactory::CreateServerRegionInterestResultType(const TArray<ESchemaComponentType>& SchemaComponentTypes) const
+{
+	ResultType RegionResultType;
+
+	// Add the required unreal components
+	RegionResultType.Append(SpatialConstants::REQUIRED_COMPONENTS_FOR_NON_AUTH_SERVER_INTEREST);
+
+	// Add the generated components of the requested types only
+	for (const ESchemaComponentType Type : SchemaComponentTypes)
+	{
+		RegionResultType.Append(ClassInfoManager->GetComponentIdsForComponentType(Type));
+	}
+
+	return RegionResultType;
+}
+
 ResultType InterestFactory::CreateServerAuthInterestResultType()
 {
 	// Just the components that we won't have already checked out through authority
 	return SpatialConstants::REQUIRED_COMPONENTS_FOR_AUTH_SERVER_INTEREST;
 }
 
-Worker_ComponentData InterestFactory::CreateInterestData(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const
+Worker_ComponentData InterestFactory::CreateInterestData(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId)
 {
-	return CreateInterest(InActor, InInfo, InEntityId).CreateInterestData();
+	Interest NewInterest = CreateInterest(InActor, InInfo, InEntityId);
+	Worker_ComponentData Data = NewInterest.CreateInterestData();
+
+	if (InActor->IsA<APlayerController>())
+	{
+		SentPlayerControllerInterest.Add(InEntityId, MoveTemp(NewInterest));
+	}
+
+	return Data;
 }
 
-Worker_ComponentUpdate InterestFactory::CreateInterestUpdate(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const
+bool InterestFactory::CreateInterestUpdate(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId, Worker_ComponentUpdate& OutUpdate)
 {
-	return CreateInterest(InActor, InInfo, InEntityId).CreateInterestUpdate();
+	Interest NewInterest = CreateInterest(InActor, InInfo, InEntityId);
+
+	// Interest is a single map field, and updates to it replace the whole map, so an update can only be skipped, not trimmed.
+	if (InActor->IsA<APlayerController>())
+	{
+		Interest* SentInterest = SentPlayerControllerInterest.Find(InEntityId);
+		if (SentInterest != nullptr && *SentInterest == NewInterest)
+		{
+			return false;
+		}
+
+		OutUpdate = NewInterest.CreateInterestUpdate();
+		SentPlayerControllerInterest.Add(InEntityId, MoveTemp(NewInterest));
+		return true;
+	}
+
+	OutUpdate = NewInterest.CreateInterestUpdate();
+	return true;
+}
+
+void InterestFactory::ForgetSentInterest(const Worker_EntityId InEntityId)
+{
+	SentPlayerControllerInterest.Remove(InEntityId);
 }
 
 Interest InterestFactory::CreateServerWorkerInterest(const UAbstractLBStrategy* LBStrategy)
@@ -133,8 +315,6 @@ Interest InterestFactory::CreateServerWorkerInterest(const UAbstractLBStrategy*
 	// If we aren't offloading, the server gets more granular interest.
 
 	// Ensure server worker receives always relevant entities
-	QueryConstraint AlwaysRelevantConstraint = CreateAlwaysRelevantConstraint();
-
 	Constraint = AlwaysRelevantConstraint;
 
 	// If we are using the unreal load balancer, we also add the server worker interest defined by the load balancing strategy.
@@ -147,12 +327,37 @@ Interest InterestFactory::CreateServerWorkerInterest(const UAbstractLBStrategy*
 		// This function will be called again when that is the case in order to update the interest on the server entity.
 		if (LBStrategy->IsReady())
 		{
-			QueryConstraint LoadBalancerConstraint = LBStrategy->GetWorkerInterestQueryConstraint();
-
-			// Rather than adding the load balancer constraint at the end, reorder the constraints to have the large spatial
-			// constraint at the front. This is more likely to be efficient.
+			// Rather than adding the load balancer constraints at the end, reorder the constraints to have the large spatial
+			// constraints at the front. This is more likely to be efficient.
 			QueryConstraint NewConstraint;
-			NewConstraint.OrConstraint.Add(LoadBalancerConstraint);
+
+			// Regions checked out in full share the main query. The others, typically strips along the worker's borders,
+			// each get a query with their own frequency and components.
+			for (const FWorkerInterestRegion& Region : LBStrategy->GetWorkerInterestRegions())
+			{
+				if (Region.IsFullInterest())
+				{
+					NewConstraint.OrConstraint.Add(Region.Constraint);
+					continue;
+				}
+
+				Query RegionQuery;
+				RegionQuery.Constraint = Region.Constraint;
+				if (SpatialGDKSettings->bEnableResultTypes)
+				{
+					RegionQuery.ResultComponentIds = CreateServerRegionInterestResultType(Region.SchemaComponentTypes);
+				}
+				else
+				{
+					RegionQuery.FullSnapshotResult = true;
+				}
+				if (Region.Frequency > 0.f)
+				{
+					RegionQuery.Frequency = Region.Frequency;
+				}
+				AddComponentQueryPairToInterestComponent(ServerInterest, SpatialConstants::POSITION_COMPONENT_ID, RegionQuery);
+			}
+
 			NewConstraint.OrConstraint.Add(AlwaysRelevantConstraint);
 			Constraint = NewConstraint;
 		}
@@ -173,7 +378,7 @@ Interest InterestFactory::CreateServerWorkerInterest(const UAbstractLBStrategy*
 	return ServerInterest;
 }
 
-Interest InterestFactory::CreateInterest(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const
+Interest InterestFactory::CreateInterest(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId, const bool bAllLevelsLoaded)
 {
 	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
 
@@ -183,7 +388,7 @@ Interest InterestFactory::CreateInterest(AActor* InActor, const FClassInfo& InIn
 	if (InActor->IsA(APlayerController::StaticClass()))
 	{
 		// Put the "main" interest queries on the player controller
-		AddPlayerControllerActorInterest(ResultInterest, InActor, InInfo);
+		AddPlayerControllerActorInterest(ResultInterest, InActor, InInfo, bAllLevelsLoaded);
 	}
 
 	if (Settings->bEnableResultTypes)
@@ -201,9 +406,9 @@ Interest InterestFactory::CreateInterest(AActor* InActor, const FClassInfo& InIn
 	return ResultInterest;
 }
 
-void InterestFactory::AddPlayerControllerActorInterest(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo) const
+void InterestFactory::AddPlayerControllerActorInterest(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo, const bool bAllLevelsLoaded)
 {
-	QueryConstraint LevelConstraint = CreateLevelConstraints(InActor);
+	QueryConstraint LevelConstraint = bAllLevelsLoaded ? CreateAllLevelsConstraint() : CreateLevelConstraints(InActor);
 
 	AddAlwaysRelevantAndInterestedQuery(OutInterest, InActor, InInfo, LevelConstraint);
 
@@ -247,7 +452,6 @@ void InterestFactory::AddAlwaysRelevantAndInterestedQuery(Interest& OutInterest,
 	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
 
 	QueryConstraint AlwaysInterestedConstraint = CreateAlwaysInterestedConstraint(InActor, InInfo);
-	QueryConstraint AlwaysRelevantConstraint = CreateAlwaysRelevantConstraint();
 
 	QueryConstraint SystemDefinedConstraints;
 
@@ -289,12 +493,12 @@ void InterestFactory::AddAlwaysRelevantAndInterestedQuery(Interest& OutInterest,
 	}
 }
 
-void InterestFactory::AddUserDefinedQueries(Interest& OutInterest, const AActor* InActor, const QueryConstraint& LevelConstraint) const
+void InterestFactory::AddUserDefinedQueries(Interest& OutInterest, const AActor* InActor, const QueryConstraint& LevelConstraint)
 {
 	SCOPE_CYCLE_COUNTER(STAT_InterestFactoryAddUserDefinedQueries);
 	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
 
-	FrequencyToConstraintsMap FrequencyConstraintsMap = GetUserDefinedFrequencyToConstraintsMap(InActor);
+	const FrequencyToConstraintsMap& FrequencyConstraintsMap = GetUserDefinedFrequencyToConstraintsMap(InActor);
 
 	for (const auto& FrequencyToConstraints : FrequencyConstraintsMap)
 	{
@@ -345,30 +549,41 @@ void InterestFactory::AddUserDefinedQueries(Interest& OutInterest, const AActor*
 	}
 }
 
-FrequencyToConstraintsMap InterestFactory::GetUserDefinedFrequencyToConstraintsMap(const AActor* InActor) const
+const FrequencyToConstraintsMap& InterestFactory::GetUserDefinedFrequencyToConstraintsMap(const AActor* InActor)
 {
+	const APlayerController* PlayerController = Cast<APlayerController>(InActor);
+	const APawn* Pawn = PlayerController != nullptr ? PlayerController->GetPawn() : nullptr;
+
+	FCachedUserDefinedConstraints& CachedConstraints = CachedUserDefinedConstraints.FindOrAdd(InActor);
+	if (CachedConstraints.HierarchyActors.Num() > 0 && CachedConstraints.Pawn.Get() == Pawn)
+	{
+		return CachedConstraints.FrequencyToConstraints;
+	}
+
 	// This function builds a frequency to constraint map rather than queries. It does this for two reasons:
 	// - We need to set the result type later
 	// - The map implicitly removes duplicates queries that have the same constraint. Result types are set for each query and these are large,
 	//   so worth simplifying as much as possible.
-	FrequencyToConstraintsMap FrequencyToConstraints;
+	CachedConstraints.Pawn = Pawn;
+	CachedConstraints.HierarchyActors.Reset();
+	CachedConstraints.FrequencyToConstraints.Reset();
 
-	if (const APlayerController* PlayerController = Cast<APlayerController>(InActor))
+	if (PlayerController != nullptr)
 	{
 		// If this is for a player controller, loop through the pawns of the controller as well, because we only add interest to
 		// the player controller entity but interest can be specified on the pawn of the controller as well.
-		GetActorUserDefinedQueryConstraints(InActor, FrequencyToConstraints, true);
-		GetActorUserDefinedQueryConstraints(PlayerController->GetPawn(), FrequencyToConstraints, true);
+		GetActorUserDefinedQueryConstraints(InActor, CachedConstraints.FrequencyToConstraints, CachedConstraints.HierarchyActors, true);
+		GetActorUserDefinedQueryConstraints(Pawn, CachedConstraints.FrequencyToConstraints, CachedConstraints.HierarchyActors, true);
 	}
 	else
 	{
-		GetActorUserDefinedQueryConstraints(InActor, FrequencyToConstraints, false);
+		GetActorUserDefinedQueryConstraints(InActor, CachedConstraints.FrequencyToConstraints, CachedConstraints.HierarchyActors, false);
 	}
 
-	return FrequencyToConstraints;
+	return CachedConstraints.FrequencyToConstraints;
 }
 
-void InterestFactory::GetActorUserDefinedQueryConstraints(const AActor* InActor, FrequencyToConstraintsMap& OutFrequencyToConstraints, bool bRecurseChildren) const
+void InterestFactory::GetActorUserDefinedQueryConstraints(const AActor* InActor, FrequencyToConstraintsMap& OutFrequencyToConstraints, TSet<const AActor*>& OutHierarchyActors, bool bRecurseChildren) const
 {
 	check(ClassInfoManager);
 
@@ -377,6 +592,8 @@ void InterestFactory::GetActorUserDefinedQueryConstraints(const AActor* InActor,
 		return;
 	}
 
+	OutHierarchyActors.Add(InActor);
+
 	// The defined actor interest component populates the frequency to constraints map with the user defined queries.
 	TArray<UActorInterestComponent*> ActorInterestComponents;
 	InActor->GetComponents<UActorInterestComponent>(ActorInterestComponents);
@@ -394,48 +611,57 @@ void InterestFactory::GetActorUserDefinedQueryConstraints(const AActor* InActor,
 	{
 		for (const auto& Child : InActor->Children)
 		{
-			GetActorUserDefinedQueryConstraints(Child, OutFrequencyToConstraints, true);
+			GetActorUserDefinedQueryConstraints(Child, OutFrequencyToConstraints, OutHierarchyActors, true);
 		}
 	}
 }
 
-void InterestFactory::AddNetCullDistanceQueries(Interest& OutInterest, const QueryConstraint& LevelConstraint) const
+void InterestFactory::OnActorOwnerChanged(const AActor* InActor)
 {
-	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
+	const AActor* NewOwner = InActor->GetOwner();
 
-	// The CheckoutConstraints list contains items with a constraint and a frequency.
-	// They are then converted to queries by adding a result type to them, and the constraints are conjoined with the level constraint.
-	for (const auto& CheckoutRadiusConstraintFrequencyPair : ClientCheckoutRadiusConstraint)
+	// The Actor either left a cached hierarchy, or joined the hierarchy of its new owner.
+	for (auto It = CachedUserDefinedConstraints.CreateIterator(); It; ++It)
 	{
-		if (!CheckoutRadiusConstraintFrequencyPair.Constraint.IsValid())
+		if (!It.Key().IsValid() || It.Value().HierarchyActors.Contains(InActor) || (NewOwner != nullptr && It.Value().HierarchyActors.Contains(NewOwner)))
 		{
-			continue;
+			It.RemoveCurrent();
 		}
+	}
+}
 
-		Query NewQuery;
+void InterestFactory::OnUserDefinedInterestChanged(const AActor* InActor)
+{
+	for (auto It = CachedUserDefinedConstraints.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid() || It.Value().HierarchyActors.Contains(InActor))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void InterestFactory::AddNetCullDistanceQueries(Interest& OutInterest, const QueryConstraint& LevelConstraint) const
+{
+	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
 
-		NewQuery.Constraint.AndConstraint.Add(CheckoutRadiusConstraintFrequencyPair.Constraint);
+	for (const Query& ClientQuery : ClientNetCullDistanceQueries)
+	{
+		Query NewQuery = ClientQuery;
 
 		if (LevelConstraint.IsValid())
 		{
 			NewQuery.Constraint.AndConstraint.Add(LevelConstraint);
 		}
 
-		NewQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
-
-		SetResultType(NewQuery, ClientNonAuthInterestResultType);
-
 		AddComponentQueryPairToInterestComponent(OutInterest, SpatialConstants::GetClientAuthorityComponent(Settings->UseRPCRingBuffer()), NewQuery);
+	}
 
-		// Add the queries to the server as well to ensure that all entities checked out on the client will be present on the server.
-		if (Settings->bEnableClientQueriesOnServer)
+	// Add the queries to the server as well to ensure that all entities checked out on the client will be present on the server.
+	if (Settings->bEnableClientQueriesOnServer)
+	{
+		for (const Query& ServerQuery : ServerNetCullDistanceQueries)
 		{
-			Query ServerQuery;
-			ServerQuery.Constraint = CheckoutRadiusConstraintFrequencyPair.Constraint;
-			ServerQuery.Frequency = CheckoutRadiusConstraintFrequencyPair.Frequency;
-
-			SetResultType(ServerQuery, ServerNonAuthInterestResultType);
-
 			AddComponentQueryPairToInterestComponent(OutInterest, SpatialConstants::POSITION_COMPONENT_ID, ServerQuery);
 		}
 	}
@@ -443,12 +669,7 @@ void InterestFactory::AddNetCullDistanceQueries(Interest& OutInterest, const Que
 
 void InterestFactory::AddComponentQueryPairToInterestComponent(Interest& OutInterest, const Worker_ComponentId ComponentId, const Query& QueryToAdd) const
 {
-	if (!OutInterest.ComponentInterestMap.Contains(ComponentId))
-	{
-		ComponentInterest NewComponentInterest;
-		OutInterest.ComponentInterestMap.Add(ComponentId, NewComponentInterest);
-	}
-	OutInterest.ComponentInterestMap[ComponentId].Queries.Add(QueryToAdd);
+	OutInterest.ComponentInterestMap.FindOrAdd(ComponentId).Queries.Add(QueryToAdd);
 }
 
 bool InterestFactory::ShouldAddNetCullDistanceInterest(const AActor* InActor) const
@@ -523,23 +744,43 @@ QueryConstraint InterestFactory::CreateAlwaysRelevantConstraint() const
 
 QueryConstraint InterestFactory::CreateLevelConstraints(const AActor* InActor) const
 {
-	QueryConstraint LevelConstraint;
-
-	QueryConstraint DefaultConstraint;
-	DefaultConstraint.ComponentConstraint = SpatialConstants::NOT_STREAMED_COMPONENT_ID;
-	LevelConstraint.OrConstraint.Add(DefaultConstraint);
-
 	UNetConnection* Connection = InActor->GetNetConnection();
 	check(Connection);
 	APlayerController* PlayerController = Connection->GetPlayerController(nullptr);
 	check(PlayerController);
 
-	const TSet<FName>& LoadedLevels = PlayerController->NetConnection->ClientVisibleLevelNames;
+	// The constraint only changes when the client's level visibility does, so it is cached on the connection until then.
+	if (USpatialNetConnection* SpatialConnection = Cast<USpatialNetConnection>(PlayerController->NetConnection))
+	{
+		return GetCachedLevelConstraint(*SpatialConnection);
+	}
+
+	return CreateLevelConstraint(PlayerController->NetConnection->ClientVisibleLevelNames);
+}
+
+QueryConstraint InterestFactory::GetCachedLevelConstraint(USpatialNetConnection& Connection) const
+{
+	if (!Connection.CachedLevelConstraint.IsSet())
+	{
+		Connection.CachedLevelConstraint = CreateLevelConstraint(Connection.ClientVisibleLevelNames);
+	}
+
+	return Connection.CachedLevelConstraint.GetValue();
+}
+
+QueryConstraint InterestFactory::CreateLevelConstraint(const TSet<FName>& LoadedLevels) const
+{
+	QueryConstraint LevelConstraint;
+	LevelConstraint.OrConstraint.Reserve(LoadedLevels.Num() + 1);
+
+	QueryConstraint DefaultConstraint;
+	DefaultConstraint.ComponentConstraint = SpatialConstants::NOT_STREAMED_COMPONENT_ID;
+	LevelConstraint.OrConstraint.Add(DefaultConstraint);
 
 	// Create component constraints for every loaded sub-level
-	for (const auto& LevelPath : LoadedLevels)
+	for (const FName& LevelPath : LoadedLevels)
 	{
-		const Worker_ComponentId ComponentId = ClassInfoManager->GetComponentIdFromLevelPath(LevelPath.ToString());
+		const Worker_ComponentId ComponentId = ClassInfoManager->GetComponentIdFromLevelName(LevelPath);
 		if (ComponentId != SpatialConstants::INVALID_COMPONENT_ID)
 		{
 			QueryConstraint SpecificLevelConstraint;
@@ -548,19 +789,37 @@ QueryConstraint InterestFactory::CreateLevelConstraints(const AActor* InActor) c
 		}
 		else
 		{
-			UE_LOG(LogInterestFactory, Error, TEXT("Error creating query constraints for Actor %s. "
-				"Could not find Streaming Level Component for Level %s. Have you generated schema?"), *InActor->GetName(), *LevelPath.ToString());
+			UE_LOG(LogInterestFactory, Error, TEXT("Error creating level query constraints. "
+				"Could not find Streaming Level Component for Level %s. Have you generated schema?"), *LevelPath.ToString());
 		}
 	}
 
 	return LevelConstraint;
 }
 
+QueryConstraint InterestFactory::CreateAllLevelsConstraint() const
+{
+	QueryConstraint LevelConstraint;
+
+	QueryConstraint DefaultConstraint;
+	DefaultConstraint.ComponentConstraint = SpatialConstants::NOT_STREAMED_COMPONENT_ID;
+	LevelConstraint.OrConstraint.Add(DefaultConstraint);
+
+	for (const auto& LevelPathAndComponentId : ClassInfoManager->SchemaDatabase->LevelPathToComponentId)
+	{
+		QueryConstraint SpecificLevelConstraint;
+		SpecificLevelConstraint.ComponentConstraint = LevelPathAndComponentId.Value;
+		LevelConstraint.OrConstraint.Add(SpecificLevelConstraint);
+	}
+
+	return LevelConstraint;
+}
+
 void InterestFactory::AddObjectToConstraint(UObjectPropertyBase* Property, uint8* Data, QueryConstraint& OutConstraint) const
 {
 	UObject* ObjectOfInterest = Property->GetObjectPropertyValue(Data);
 
-	if (ObjectOfInterest == nullptr)
+	if (ObjectOfInterest == nullptr || PackageMap == nullptr)
 	{
 		return;
 	}
@@ -0,0 +1,107 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/LatencyTraceExporter.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	FString EscapeJsonString(const FString& String)
+	{
+		return String.Replace(TEXT("\\"), TEXT("\\\\")).Replace(TEXT("\""), TEXT("\\\""));
+	}
+} // anonymous namespace
+
+FLocalFileLatencyTraceExporter::FLocalFileLatencyTraceExporter(TUniquePtr<FArchive> InWriter, const FString& WorkerId, float InSampleRate, int32 InMaxBufferedSpans)
+	: Writer(MoveTemp(InWriter))
+	, SampleRate(FMath::Clamp(InSampleRate, 0.f, 1.f))
+	, MaxBufferedSpans(FMath::Max(InMaxBufferedSpans, 1))
+{
+	check(Writer.IsValid());
+
+	BufferedSpans.Reserve(MaxBufferedSpans);
+
+	// The trailing "]" is optional in the trace event format, which lets us append events until the file is closed.
+	WriteString(FString::Printf(TEXT("[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"%s\"}}"), *EscapeJsonString(WorkerId)));
+}
+
+FLocalFileLatencyTraceExporter::~FLocalFileLatencyTraceExporter()
+{
+	Flush();
+	WriteString(TEXT("\n]\n"));
+	Writer->Close();
+}
+
+TUniquePtr<FLocalFileLatencyTraceExporter> FLocalFileLatencyTraceExporter::CreateForFile(const FString& FilePath, const FString& WorkerId, float SampleRate, int32 MaxBufferedSpans)
+{
+	FArchive* FileWriter = IFileManager::Get().CreateFileWriter(*FilePath);
+	if (FileWriter == nullptr)
+	{
+		return nullptr;
+	}
+
+	return MakeUnique<FLocalFileLatencyTraceExporter>(TUniquePtr<FArchive>(FileWriter), WorkerId, SampleRate, MaxBufferedSpans);
+}
+
+bool FLocalFileLatencyTraceExporter::IsTraceSampled(const TArray<uint8>& TraceId, float SampleRate)
+{
+	if (SampleRate >= 1.f)
+	{
+		return true;
+	}
+
+	// Trace IDs are random, so their leading bytes give every worker the same uniform sampling decision.
+	uint32 Value = 0;
+	FMemory::Memcpy(&Value, TraceId.GetData(), FMath::Min<int32>(sizeof(Value), TraceId.Num()));
+	return static_cast<double>(Value) < static_cast<double>(SampleRate) * MAX_uint32;
+}
+
+void FLocalFileLatencyTraceExporter::ExportSpan(const FLatencyTraceSpan& Span)
+{
+	if (!IsTraceSampled(Span.TraceId, SampleRate))
+	{
+		return;
+	}
+
+	BufferedSpans.Add(Span);
+	if (BufferedSpans.Num() >= MaxBufferedSpans)
+	{
+		Flush();
+	}
+}
+
+void FLocalFileLatencyTraceExporter::Flush()
+{
+	for (const FLatencyTraceSpan& Span : BufferedSpans)
+	{
+		const FString TraceIdString = BytesToHex(Span.TraceId.GetData(), Span.TraceId.Num());
+		const FString Name = EscapeJsonString(Span.Name);
+
+		if (Span.bIsKeyFrame)
+		{
+			WriteString(FString::Printf(TEXT(",\n{\"name\":\"%s\",\"cat\":\"latency\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%lld,\"pid\":1,\"tid\":%d,\"args\":{\"trace_id\":\"%s\"}}"),
+				*Name, Span.StartTimeMicros, Span.Key, *TraceIdString));
+		}
+		else
+		{
+			WriteString(FString::Printf(TEXT(",\n{\"name\":\"%s\",\"cat\":\"latency\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%d,\"args\":{\"trace_id\":\"%s\"}}"),
+				*Name, Span.StartTimeMicros, Span.DurationMicros, Span.Key, *TraceIdString));
+		}
+	}
+
+	NumSpansWritten += BufferedSpans.Num();
+	BufferedSpans.Reset();
+	Writer->Flush();
+}
+
+void FLocalFileLatencyTraceExporter::WriteString(const FString& String)
+{
+	FTCHARToUTF8 Converted(*String);
+	Writer->Serialize(const_cast<ANSICHAR*>(Converted.Get()), Converted.Length());
+}
+
+} // namespace SpatialGDK
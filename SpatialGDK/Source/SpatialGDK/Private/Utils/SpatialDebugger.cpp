@@ -6,11 +6,13 @@
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialSender.h"
 #include "Interop/SpatialStaticComponentView.h"
+#include "LoadBalancing/AdaptiveLBStrategy.h"
 #include "LoadBalancing/WorkerRegion.h"
 #include "Schema/AuthorityIntent.h"
 #include "Schema/SpatialDebugging.h"
 #include "SpatialCommonTypes.h"
 #include "Utils/InspectionColors.h"
+#include "Utils/SpatialDebuggerWorkerRegions.h"
 
 #include "Debug/DebugDrawService.h"
 #include "Engine/Engine.h"
@@ -28,6 +30,8 @@ DEFINE_LOG_CATEGORY(LogSpatialDebugger);
 namespace
 {
 	const FString DEFAULT_WORKER_REGION_MATERIAL = TEXT("/SpatialGDK/SpatialDebugger/Materials/TranslucentWorkerRegion.TranslucentWorkerRegion");
+	const float WORKER_REGION_LABEL_HEIGHT = 200.0f;
+	const float WORKER_REGION_EDGE_LABEL_OFFSET = 300.0f;
 }
 
 ASpatialDebugger::ASpatialDebugger(const FObjectInitializer& ObjectInitializer)
@@ -59,6 +63,7 @@ void ASpatialDebugger::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME_CONDITION(ASpatialDebugger, WorkerRegions, COND_SimulatedOnly);
+	DOREPLIFETIME_CONDITION(ASpatialDebugger, WorkerRegionMigrations, COND_SimulatedOnly);
 }
 
 void ASpatialDebugger::Tick(float DeltaSeconds)
@@ -67,7 +72,15 @@ void ASpatialDebugger::Tick(float DeltaSeconds)
 
 	check(NetDriver != nullptr);
 
-	if (!NetDriver->IsServer())
+	if (NetDriver->IsServer())
+	{
+		// Loads are collected every few seconds, so refreshing at the debugger's tick rate is enough to pick them up.
+		if (HasAuthority())
+		{
+			RefreshWorkerRegions();
+		}
+	}
+	else
 	{
 		for (TMap<Worker_EntityId_Key, TWeakObjectPtr<AActor>>::TIterator It = EntityActorMapping.CreateIterator(); It; ++It)
 		{
@@ -141,23 +154,53 @@ void ASpatialDebugger::BeginPlay()
 
 void ASpatialDebugger::OnAuthorityGained()
 {
-	if (NetDriver->LoadBalanceStrategy)
+	RefreshWorkerRegions();
+}
+
+void ASpatialDebugger::RefreshWorkerRegions()
+{
+	const UAbstractLBStrategy* LoadBalanceStrategy = NetDriver->LoadBalanceStrategy;
+	if (LoadBalanceStrategy == nullptr || NetDriver->VirtualWorkerTranslator == nullptr)
 	{
-		if (const UGridBasedLBStrategy* GridBasedLBStrategy = Cast<UGridBasedLBStrategy>(NetDriver->LoadBalanceStrategy))
+		return;
+	}
+
+	TArray<TPair<VirtualWorkerId, FBox2D>> LBStrategyRegions;
+	if (const UGridBasedLBStrategy* GridBasedLBStrategy = Cast<UGridBasedLBStrategy>(LoadBalanceStrategy))
+	{
+		LBStrategyRegions = GridBasedLBStrategy->GetLBStrategyRegions();
+	}
+	else if (const UAdaptiveLBStrategy* AdaptiveLBStrategy = Cast<UAdaptiveLBStrategy>(LoadBalanceStrategy))
+	{
+		LBStrategyRegions = AdaptiveLBStrategy->GetLBStrategyRegions();
+	}
+	else
+	{
+		return;
+	}
+
+	TArray<FWorkerRegionInfo> NewWorkerRegions;
+	NewWorkerRegions.SetNum(LBStrategyRegions.Num());
+	TArray<FWorkerRegionMigrationInfo> NewWorkerRegionMigrations;
+
+	for (int i = 0; i < LBStrategyRegions.Num(); i++)
+	{
+		const TPair<VirtualWorkerId, FBox2D>& LBStrategyRegion = LBStrategyRegions[i];
+		const PhysicalWorkerName* WorkerName = NetDriver->VirtualWorkerTranslator->GetPhysicalWorkerForVirtualWorker(LBStrategyRegion.Key);
+		FWorkerRegionInfo& WorkerRegionInfo = NewWorkerRegions[i];
+		WorkerRegionInfo.Color = (WorkerName == nullptr) ? InvalidServerTintColor : SpatialGDK::GetColorForWorkerName(*WorkerName);
+		WorkerRegionInfo.Extents = LBStrategyRegion.Value;
+		WorkerRegionInfo.VirtualWorkerId = LBStrategyRegion.Key;
+
+		// Loads reach every server worker through the virtual worker translation, so there is nothing extra to collect.
+		if (const FVirtualWorkerLoad* Load = LoadBalanceStrategy->GetVirtualWorkerLoad(LBStrategyRegion.Key))
 		{
-			const UGridBasedLBStrategy::LBStrategyRegions LBStrategyRegions = GridBasedLBStrategy->GetLBStrategyRegions();
-			WorkerRegions.SetNum(LBStrategyRegions.Num());
-			for (int i = 0; i < LBStrategyRegions.Num(); i++)
-			{
-				const TPair<VirtualWorkerId, FBox2D>& LBStrategyRegion = LBStrategyRegions[i];
-				const PhysicalWorkerName* WorkerName = NetDriver->VirtualWorkerTranslator->GetPhysicalWorkerForVirtualWorker(LBStrategyRegion.Key);
-				FWorkerRegionInfo WorkerRegionInfo;
-				WorkerRegionInfo.Color = (WorkerName == nullptr) ? InvalidServerTintColor : SpatialGDK::GetColorForWorkerName(*WorkerName);
-				WorkerRegionInfo.Extents = LBStrategyRegion.Value;
-				WorkerRegions[i] = WorkerRegionInfo;
-			}
+			SpatialDebuggerWorkerRegions::ApplyWorkerLoad(*Load, WorkerRegionInfo, NewWorkerRegionMigrations);
 		}
 	}
+
+	WorkerRegions = MoveTemp(NewWorkerRegions);
+	WorkerRegionMigrations = MoveTemp(NewWorkerRegionMigrations);
 }
 
 void ASpatialDebugger::CreateWorkerRegions()
@@ -174,30 +217,60 @@ void ASpatialDebugger::CreateWorkerRegions()
 	FActorSpawnParameters SpawnParams;
 	SpawnParams.bNoFail = true;
 	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	const int32 HotActorCount = SpatialDebuggerWorkerRegions::GetHeatActorCount(WorkerRegions, WorkerRegionHeatActorCount);
 	for (const FWorkerRegionInfo& WorkerRegionData : WorkerRegions)
 	{
 		AWorkerRegion* WorkerRegion = GetWorld()->SpawnActor<AWorkerRegion>(SpawnParams);
-		WorkerRegion->Init(WorkerRegionMaterial, WorkerRegionData.Color, WorkerRegionData.Extents, WorkerRegionVerticalScale);
+		WorkerRegion->Init(WorkerRegionMaterial, SpatialDebuggerWorkerRegions::GetRegionColor(WorkerRegionData, HotActorCount, bShowWorkerRegionLoad), WorkerRegionData.Extents, WorkerRegionVerticalScale);
 		WorkerRegion->SetActorEnableCollision(false);
+		WorkerRegionActors.Add(WorkerRegion);
+	}
+}
+
+void ASpatialDebugger::UpdateWorkerRegions()
+{
+	if (WorkerRegionActors.Num() != WorkerRegions.Num())
+	{
+		return;
+	}
+
+	const int32 HotActorCount = SpatialDebuggerWorkerRegions::GetHeatActorCount(WorkerRegions, WorkerRegionHeatActorCount);
+	for (int32 i = 0; i < WorkerRegions.Num(); i++)
+	{
+		if (AWorkerRegion* WorkerRegion = WorkerRegionActors[i].Get())
+		{
+			WorkerRegion->SetColor(SpatialDebuggerWorkerRegions::GetRegionColor(WorkerRegions[i], HotActorCount, bShowWorkerRegionLoad));
+			WorkerRegion->SetPositionAndScale(WorkerRegions[i].Extents, WorkerRegionVerticalScale);
+		}
 	}
 }
 
 void ASpatialDebugger::DestroyWorkerRegions()
 {
-	TArray<AActor*> WorkerRegionsToRemove;
-	UGameplayStatics::GetAllActorsOfClass(this, AWorkerRegion::StaticClass(), WorkerRegionsToRemove);
-	for (AActor* WorkerRegion : WorkerRegionsToRemove)
+	for (const TWeakObjectPtr<AWorkerRegion>& WorkerRegion : WorkerRegionActors)
 	{
-		WorkerRegion->Destroy();
+		if (WorkerRegion.IsValid())
+		{
+			WorkerRegion->Destroy();
+		}
 	}
+	WorkerRegionActors.Reset();
 }
 
 void ASpatialDebugger::OnRep_SetWorkerRegions()
 {
 	if (NetDriver != nullptr && !NetDriver->IsServer() && DrawDebugDelegateHandle.IsValid() && bShowWorkerRegions)
 	{
-		DestroyWorkerRegions();
-		CreateWorkerRegions();
+		// Loads change every few seconds, so only respawn the region Actors when the number of regions changes.
+		if (WorkerRegionActors.Num() == WorkerRegions.Num())
+		{
+			UpdateWorkerRegions();
+		}
+		else
+		{
+			DestroyWorkerRegions();
+			CreateWorkerRegions();
+		}
 	}
 }
 
@@ -423,6 +496,11 @@ void ASpatialDebugger::DrawDebug(UCanvas* Canvas, APlayerController* /* Controll
 	}
 #endif
 
+	if (bShowWorkerRegions && bShowWorkerRegionLoad)
+	{
+		DrawWorkerRegionLoads(Canvas);
+	}
+
 	DrawDebugLocalPlayer(Canvas);
 
 	FVector PlayerLocation = FVector::ZeroVector;
@@ -468,6 +546,46 @@ void ASpatialDebugger::DrawDebug(UCanvas* Canvas, APlayerController* /* Controll
 	}
 }
 
+void ASpatialDebugger::DrawWorkerRegionLoads(UCanvas* Canvas)
+{
+	SCOPE_CYCLE_COUNTER(STAT_DrawWorkerRegionLoads);
+
+	if (!LocalPlayerController.IsValid())
+	{
+		return;
+	}
+
+	for (const FWorkerRegionInfo& WorkerRegionInfo : WorkerRegions)
+	{
+		DrawWorkerRegionLabel(Canvas, WorkerRegionInfo.Extents.GetCenter(), SpatialDebuggerWorkerRegions::GetRegionLabel(WorkerRegionInfo), FColor::White);
+	}
+
+	for (const FWorkerRegionMigrationInfo& MigrationInfo : WorkerRegionMigrations)
+	{
+		FVector2D Location;
+		if (SpatialDebuggerWorkerRegions::GetMigrationLabelLocation(WorkerRegions, MigrationInfo, WORKER_REGION_EDGE_LABEL_OFFSET, Location))
+		{
+			DrawWorkerRegionLabel(Canvas, Location, SpatialDebuggerWorkerRegions::GetMigrationLabel(MigrationInfo), FColor::Yellow);
+		}
+	}
+}
+
+void ASpatialDebugger::DrawWorkerRegionLabel(UCanvas* Canvas, const FVector2D& Location, const FString& Label, const FColor& Color)
+{
+	FVector2D ScreenLocation = FVector2D::ZeroVector;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Projection);
+		if (!UGameplayStatics::ProjectWorldToScreen(LocalPlayerController.Get(), FVector(Location, WORKER_REGION_LABEL_HEIGHT), ScreenLocation, false))
+		{
+			return;
+		}
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_DrawText);
+	Canvas->SetDrawColor(Color);
+	Canvas->DrawText(RenderFont, Label, ScreenLocation.X, ScreenLocation.Y, 1.0f, 1.0f, FontRenderInfo);
+}
+
 void ASpatialDebugger::DrawDebugLocalPlayer(UCanvas* Canvas)
 {
 	if (LocalPawn == nullptr || LocalPlayerController == nullptr || LocalPlayerState == nullptr)
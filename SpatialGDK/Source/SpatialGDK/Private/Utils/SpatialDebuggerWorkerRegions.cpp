@@ -0,0 +1,89 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialDebuggerWorkerRegions.h"
+
+namespace SpatialGDK
+{
+
+void SpatialDebuggerWorkerRegions::ApplyWorkerLoad(const FVirtualWorkerLoad& Load, FWorkerRegionInfo& OutWorkerRegionInfo, TArray<FWorkerRegionMigrationInfo>& OutWorkerRegionMigrations)
+{
+	OutWorkerRegionInfo.AuthoritativeActorCount = Load.AuthoritativeActorCount;
+	OutWorkerRegionInfo.AverageFrameTime = Load.AverageFrameTime;
+
+	for (const auto& Migration : Load.MigrationsPerSecond)
+	{
+		FWorkerRegionMigrationInfo& MigrationInfo = OutWorkerRegionMigrations.AddDefaulted_GetRef();
+		MigrationInfo.FromVirtualWorkerId = OutWorkerRegionInfo.VirtualWorkerId;
+		MigrationInfo.ToVirtualWorkerId = Migration.Key;
+		MigrationInfo.MigrationsPerSecond = Migration.Value;
+	}
+}
+
+int32 SpatialDebuggerWorkerRegions::GetHeatActorCount(const TArray<FWorkerRegionInfo>& WorkerRegions, int32 ConfiguredHeatActorCount)
+{
+	if (ConfiguredHeatActorCount > 0)
+	{
+		return ConfiguredHeatActorCount;
+	}
+
+	int32 MaxActorCount = 0;
+	for (const FWorkerRegionInfo& WorkerRegionInfo : WorkerRegions)
+	{
+		MaxActorCount = FMath::Max(MaxActorCount, WorkerRegionInfo.AuthoritativeActorCount);
+	}
+	return MaxActorCount;
+}
+
+FColor SpatialDebuggerWorkerRegions::GetRegionColor(const FWorkerRegionInfo& WorkerRegionInfo, int32 HeatActorCount, bool bShowLoad)
+{
+	if (!bShowLoad || WorkerRegionInfo.AuthoritativeActorCount == INDEX_NONE || HeatActorCount <= 0)
+	{
+		return WorkerRegionInfo.Color;
+	}
+
+	const float Heat = FMath::Clamp(static_cast<float>(WorkerRegionInfo.AuthoritativeActorCount) / HeatActorCount, 0.0f, 1.0f);
+	return FLinearColor::LerpUsingHSV(FLinearColor::Green, FLinearColor::Red, Heat).ToFColor(true);
+}
+
+FString SpatialDebuggerWorkerRegions::GetRegionLabel(const FWorkerRegionInfo& WorkerRegionInfo)
+{
+	if (WorkerRegionInfo.AuthoritativeActorCount == INDEX_NONE)
+	{
+		return FString::Printf(TEXT("%u: no load reported"), WorkerRegionInfo.VirtualWorkerId);
+	}
+
+	return FString::Printf(TEXT("%u: %d actors, %.1f ms"), WorkerRegionInfo.VirtualWorkerId, WorkerRegionInfo.AuthoritativeActorCount, WorkerRegionInfo.AverageFrameTime * 1000.0f);
+}
+
+FString SpatialDebuggerWorkerRegions::GetMigrationLabel(const FWorkerRegionMigrationInfo& MigrationInfo)
+{
+	return FString::Printf(TEXT("%u > %u: %.1f/s"), MigrationInfo.FromVirtualWorkerId, MigrationInfo.ToVirtualWorkerId, MigrationInfo.MigrationsPerSecond);
+}
+
+bool SpatialDebuggerWorkerRegions::GetMigrationLabelLocation(const TArray<FWorkerRegionInfo>& WorkerRegions, const FWorkerRegionMigrationInfo& MigrationInfo, float Offset, FVector2D& OutLocation)
+{
+	const FWorkerRegionInfo* From = WorkerRegions.FindByPredicate([&MigrationInfo](const FWorkerRegionInfo& Info) { return Info.VirtualWorkerId == MigrationInfo.FromVirtualWorkerId; });
+	const FWorkerRegionInfo* To = WorkerRegions.FindByPredicate([&MigrationInfo](const FWorkerRegionInfo& Info) { return Info.VirtualWorkerId == MigrationInfo.ToVirtualWorkerId; });
+	if (From == nullptr || To == nullptr)
+	{
+		return false;
+	}
+
+	const FVector2D Direction = (To->Extents.GetCenter() - From->Extents.GetCenter()).GetSafeNormal();
+	OutLocation = GetSharedEdgeCenter(From->Extents, To->Extents) + Direction * Offset;
+	return true;
+}
+
+FVector2D SpatialDebuggerWorkerRegions::GetSharedEdgeCenter(const FBox2D& A, const FBox2D& B)
+{
+	const FVector2D OverlapMin(FMath::Max(A.Min.X, B.Min.X), FMath::Max(A.Min.Y, B.Min.Y));
+	const FVector2D OverlapMax(FMath::Min(A.Max.X, B.Max.X), FMath::Min(A.Max.Y, B.Max.Y));
+	if (OverlapMin.X <= OverlapMax.X && OverlapMin.Y <= OverlapMax.Y)
+	{
+		return (OverlapMin + OverlapMax) / 2.0f;
+	}
+
+	return (A.GetCenter() + B.GetCenter()) / 2.0f;
+}
+
+} // namespace SpatialGDK
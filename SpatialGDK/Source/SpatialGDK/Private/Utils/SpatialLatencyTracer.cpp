@@ -7,6 +7,8 @@
 #include "EngineClasses/SpatialGameInstance.h"
 #include "GeneralProjectSettings.h"
 #include "Interop/Connection/OutgoingMessages.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
 #include "Utils/SchemaUtils.h"
 
 #include <sstream>
@@ -48,6 +50,16 @@ namespace
 
 		return improbable::trace::SpanContext(_TraceId, _SpanId);
 	}
+
+	TArray<uint8> GetTraceIdBytes(const improbable::trace::Span& Span)
+	{
+		return TArray<uint8>((const uint8*)&Span.context().trace_id()[0], sizeof(improbable::trace::TraceId));
+	}
+
+	int64 GetTimestampMicros()
+	{
+		return (FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTicks() / ETimespan::TicksPerMicrosecond;
+	}
 #endif
 }  // anonymous namespace
 
@@ -73,6 +85,28 @@ void USpatialLatencyTracer::RegisterProject(UObject* WorldContextObject, const F
 #endif // TRACE_LIB_ACTIVE
 }
 
+bool USpatialLatencyTracer::RegisterLocalFileExporter(UObject* WorldContextObject, const FString& FilePath, float SampleRate, int32 MaxBufferedSpans)
+{
+#if TRACE_LIB_ACTIVE
+	if (USpatialLatencyTracer* Tracer = GetTracer(WorldContextObject))
+	{
+		const FString TracePath = FilePath.IsEmpty() ? FPaths::Combine(FPaths::ProjectLogDir(), TEXT("LatencyTraces"), Tracer->WorkerId + TEXT(".json")) : FilePath;
+
+		TUniquePtr<SpatialGDK::FLocalFileLatencyTraceExporter> Exporter = SpatialGDK::FLocalFileLatencyTraceExporter::CreateForFile(TracePath, Tracer->WorkerId, SampleRate, MaxBufferedSpans);
+		if (!Exporter.IsValid())
+		{
+			UE_LOG(LogSpatialLatencyTracing, Error, TEXT("(%s) : Failed to open latency trace file %s"), *Tracer->WorkerId, *TracePath);
+			return false;
+		}
+
+		UE_LOG(LogSpatialLatencyTracing, Log, TEXT("(%s) : Writing latency traces to %s"), *Tracer->WorkerId, *TracePath);
+		Tracer->AddExporter(MoveTemp(Exporter));
+		return true;
+	}
+#endif // TRACE_LIB_ACTIVE
+	return false;
+}
+
 bool USpatialLatencyTracer::SetTraceMetadata(UObject* WorldContextObject, const FString& NewTraceMetadata)
 {
 #if TRACE_LIB_ACTIVE
@@ -211,7 +245,7 @@ void USpatialLatencyTracer::WriteToLatencyTrace(const TraceKey Key, const FStrin
 
 	if (TraceSpan* Trace = TraceMap.Find(Key))
 	{
-		WriteKeyFrameToTrace(Trace, TraceDesc);
+		WriteKeyFrameToTrace(Key, Trace, TraceDesc);
 	}
 }
 
@@ -221,13 +255,14 @@ void USpatialLatencyTracer::WriteAndEndTraceIfRemote(const TraceKey Key, const F
 
 	if (TraceSpan* Trace = TraceMap.Find(Key))
 	{
-		WriteKeyFrameToTrace(Trace, TraceDesc);
+		WriteKeyFrameToTrace(Key, Trace, TraceDesc);
 
 		// Check RootTraces to verify if this trace was started locally. If it was, we don't End the trace yet, but
 		// wait for an explicit call to EndLatencyTrace.
 		if (RootTraces.Find(Key) == nullptr)
 		{
 			Trace->End();
+			OnTraceEnded(Key, *Trace);
 			TraceMap.Remove(Key);
 		}
 	}
@@ -281,7 +316,7 @@ TraceKey USpatialLatencyTracer::ReadTraceFromSchemaObject(Schema_Object* Obj, co
 		{
 			TraceSpan* Span = TraceMap.Find(Key);
 
-			WriteKeyFrameToTrace(Span, TEXT("Local Trace - Schema Obj Read"));
+			WriteKeyFrameToTrace(Key, Span, TEXT("Local Trace - Schema Obj Read"));
 		}
 		else
 		{
@@ -290,6 +325,7 @@ TraceKey USpatialLatencyTracer::ReadTraceFromSchemaObject(Schema_Object* Obj, co
 
 			Key = GenerateNewTraceKey();
 			TraceMap.Add(Key, MoveTemp(RetrieveTrace));
+			OnTraceStarted(Key, SpanMsg);
 		}
 
 		return Key;
@@ -387,6 +423,7 @@ bool USpatialLatencyTracer::BeginLatencyTrace_Internal(const FString& TraceDesc,
 
 	// Add to internal tracking
 	TraceMap.Add(OutLatencyPayload.Key, MoveTemp(NewTrace));
+	OnTraceStarted(OutLatencyPayload.Key, SpanMsg);
 
 	// Store traces started on this worker, so we can persist them until they've been round trip returned.
 	RootTraces.Add(OutLatencyPayload.Key);
@@ -432,7 +469,7 @@ bool USpatialLatencyTracer::ContinueLatencyTrace_Internal(const AActor* Actor, c
 		}
 	}
 
-	WriteKeyFrameToTrace(ActiveTrace, FString::Printf(TEXT("Continue [%s] %s - %s"), *TraceDesc, *UEnum::GetValueAsString(Type), *Target));
+	WriteKeyFrameToTrace(Key, ActiveTrace, FString::Printf(TEXT("Continue [%s] %s - %s"), *TraceDesc, *UEnum::GetValueAsString(Type), *Target));
 
 	// If we're not doing any further tracking, end the trace
 	if (!bInternalTracking)
@@ -462,9 +499,10 @@ bool USpatialLatencyTracer::EndLatencyTrace_Internal(const FSpatialLatencyPayloa
 		return false;
 	}
 
-	WriteKeyFrameToTrace(ActiveTrace, TEXT("End"));
+	WriteKeyFrameToTrace(Key, ActiveTrace, TEXT("End"));
 
 	ActiveTrace->End();
+	OnTraceEnded(Key, *ActiveTrace);
 
 	TraceMap.Remove(Key);
 	RootTraces.Remove(Key);
@@ -539,7 +577,7 @@ void USpatialLatencyTracer::ResolveKeyInLatencyPayload(FSpatialLatencyPayload& P
 
 		if (memcmp(Span.context().trace_id().data(), Payload.TraceId.GetData(), sizeof(Payload.TraceId)) == 0)
 		{
-			WriteKeyFrameToTrace(&Span, TEXT("Local Trace - Payload Obj Read"));
+			WriteKeyFrameToTrace(Key, &Span, TEXT("Local Trace - Payload Obj Read"));
 			Payload.Key = Key;
 			break;
 		}
@@ -556,15 +594,76 @@ void USpatialLatencyTracer::ResolveKeyInLatencyPayload(FSpatialLatencyPayload& P
 		TraceSpan RetrieveTrace = improbable::trace::Span::StartSpanWithRemoteParent(TCHAR_TO_UTF8(*SpanMsg), DestContext);
 
 		TraceMap.Add(Payload.Key, MoveTemp(RetrieveTrace));
+		OnTraceStarted(Payload.Key, SpanMsg);
 	}
 }
 
-void USpatialLatencyTracer::WriteKeyFrameToTrace(const TraceSpan* Trace, const FString& TraceDesc)
+void USpatialLatencyTracer::WriteKeyFrameToTrace(const TraceKey Key, const TraceSpan* Trace, const FString& TraceDesc)
 {
 	if (Trace != nullptr)
 	{
 		FString TraceMsg = FormatMessage(TraceDesc);
 		improbable::trace::Span::StartSpan(TCHAR_TO_UTF8(*TraceMsg), Trace).End();
+
+		if (Exporters.Num() > 0)
+		{
+			SpatialGDK::FLatencyTraceSpan KeyFrame;
+			KeyFrame.Name = MoveTemp(TraceMsg);
+			KeyFrame.TraceId = GetTraceIdBytes(*Trace);
+			KeyFrame.Key = Key;
+			KeyFrame.StartTimeMicros = GetTimestampMicros();
+			KeyFrame.bIsKeyFrame = true;
+
+			for (const TUniquePtr<SpatialGDK::FLatencyTraceExporter>& Exporter : Exporters)
+			{
+				Exporter->ExportSpan(KeyFrame);
+			}
+		}
+	}
+}
+
+void USpatialLatencyTracer::AddExporter(TUniquePtr<SpatialGDK::FLatencyTraceExporter> Exporter)
+{
+	FScopeLock Lock(&Mutex);
+	Exporters.Add(MoveTemp(Exporter));
+}
+
+void USpatialLatencyTracer::FlushExporters()
+{
+	FScopeLock Lock(&Mutex);
+	for (const TUniquePtr<SpatialGDK::FLatencyTraceExporter>& Exporter : Exporters)
+	{
+		Exporter->Flush();
+	}
+}
+
+void USpatialLatencyTracer::OnTraceStarted(const TraceKey Key, const FString& SpanMsg)
+{
+	if (Exporters.Num() > 0)
+	{
+		ActiveTraceInfo.Add(Key, FActiveTraceInfo{ SpanMsg, GetTimestampMicros() });
+	}
+}
+
+void USpatialLatencyTracer::OnTraceEnded(const TraceKey Key, const TraceSpan& Trace)
+{
+	FActiveTraceInfo Info;
+	if (!ActiveTraceInfo.RemoveAndCopyValue(Key, Info))
+	{
+		// Started before any exporter was registered.
+		return;
+	}
+
+	SpatialGDK::FLatencyTraceSpan Span;
+	Span.Name = MoveTemp(Info.Name);
+	Span.TraceId = GetTraceIdBytes(Trace);
+	Span.Key = Key;
+	Span.StartTimeMicros = Info.StartTimeMicros;
+	Span.DurationMicros = GetTimestampMicros() - Info.StartTimeMicros;
+
+	for (const TUniquePtr<SpatialGDK::FLatencyTraceExporter>& Exporter : Exporters)
+	{
+		Exporter->ExportSpan(Span);
 	}
 }
 
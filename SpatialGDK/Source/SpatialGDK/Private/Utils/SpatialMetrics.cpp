@@ -4,6 +4,9 @@
 
 #include "Engine/Engine.h"
 #include "EngineGlobals.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "SpatialGDKSettings.h"
@@ -23,8 +26,21 @@ void USpatialMetrics::Init(USpatialWorkerConnection* InConnection, float InNetSe
 	FramesSinceLastReport = 0;
 	TimeOfLastReport = 0.0f;
 
+	AuthorityMigrationsSinceLastReport = 0;
+	TotalAuthorityMigrations = 0;
+
+	InterestBucketChangesRequestedSinceLastReport = 0;
+	InterestBucketChangesSentSinceLastReport = 0;
+	InterestBucketChangesDroppedSinceLastReport = 0;
+	TotalInterestBucketChangesSent = 0;
+	TotalInterestBucketChangesCoalesced = 0;
+	TotalInterestBucketChangesDropped = 0;
+
 	bRPCTrackingEnabled = false;
 	RPCTrackingStartTime = 0.0f;
+
+	bBandwidthTrackingEnabled = false;
+	BandwidthTrackingStartTime = 0.0;
 }
 
 void USpatialMetrics::TickMetrics(float NetDriverTime)
@@ -50,8 +66,36 @@ void USpatialMetrics::TickMetrics(float NetDriverTime)
 	DynamicFPSMetrics.GaugeMetrics.Add(DynamicFPSGauge);
 	DynamicFPSMetrics.Load = WorkerLoad;
 
+	if (bIsServer)
+	{
+		SpatialGDK::GaugeMetric AuthorityMigrationsGauge;
+		AuthorityMigrationsGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_AUTHORITY_MIGRATIONS);
+		AuthorityMigrationsGauge.Value = TimeSinceLastReport > 0.f ? AuthorityMigrationsSinceLastReport / TimeSinceLastReport : 0.0;
+		DynamicFPSMetrics.GaugeMetrics.Add(AuthorityMigrationsGauge);
+
+		SpatialGDK::GaugeMetric InterestBucketChangesGauge;
+		InterestBucketChangesGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_INTEREST_BUCKET_CHANGES);
+		InterestBucketChangesGauge.Value = TimeSinceLastReport > 0.f ? InterestBucketChangesSentSinceLastReport / TimeSinceLastReport : 0.0;
+		DynamicFPSMetrics.GaugeMetrics.Add(InterestBucketChangesGauge);
+
+		SpatialGDK::GaugeMetric CoalescedInterestBucketChangesGauge;
+		CoalescedInterestBucketChangesGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_COALESCED_INTEREST_BUCKET_CHANGES);
+		const int32 InterestBucketChangesCoalesced = InterestBucketChangesRequestedSinceLastReport - InterestBucketChangesSentSinceLastReport - InterestBucketChangesDroppedSinceLastReport;
+		CoalescedInterestBucketChangesGauge.Value = TimeSinceLastReport > 0.f ? InterestBucketChangesCoalesced / TimeSinceLastReport : 0.0;
+		DynamicFPSMetrics.GaugeMetrics.Add(CoalescedInterestBucketChangesGauge);
+
+		SpatialGDK::GaugeMetric DroppedInterestBucketChangesGauge;
+		DroppedInterestBucketChangesGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_DROPPED_INTEREST_BUCKET_CHANGES);
+		DroppedInterestBucketChangesGauge.Value = TimeSinceLastReport > 0.f ? InterestBucketChangesDroppedSinceLastReport / TimeSinceLastReport : 0.0;
+		DynamicFPSMetrics.GaugeMetrics.Add(DroppedInterestBucketChangesGauge);
+	}
+
 	TimeOfLastReport = NetDriverTime;
 	FramesSinceLastReport = 0;
+	AuthorityMigrationsSinceLastReport = 0;
+	InterestBucketChangesRequestedSinceLastReport = 0;
+	InterestBucketChangesSentSinceLastReport = 0;
+	InterestBucketChangesDroppedSinceLastReport = 0;
 
 	Connection->SendMetrics(DynamicFPSMetrics);
 }
@@ -71,6 +115,22 @@ double USpatialMetrics::CalculateLoad() const
 	return AverageFrameTime / TargetFrameTime;
 }
 
+void USpatialMetrics::TrackAuthorityMigration()
+{
+	AuthorityMigrationsSinceLastReport++;
+	TotalAuthorityMigrations++;
+}
+
+void USpatialMetrics::TrackInterestBucketChanges(int32 NumRequested, int32 NumSent, int32 NumDropped)
+{
+	InterestBucketChangesRequestedSinceLastReport += NumRequested;
+	InterestBucketChangesSentSinceLastReport += NumSent;
+	InterestBucketChangesDroppedSinceLastReport += NumDropped;
+	TotalInterestBucketChangesSent += NumSent;
+	TotalInterestBucketChangesCoalesced += NumRequested - NumSent - NumDropped;
+	TotalInterestBucketChangesDropped += NumDropped;
+}
+
 void USpatialMetrics::SpatialStartRPCMetrics()
 {
 	if (bRPCTrackingEnabled)
@@ -276,22 +336,234 @@ void USpatialMetrics::TrackSentRPC(UFunction* Function, ERPCType RPCType, int Pa
 		return;
 	}
 
-	FString FunctionName = FString::Printf(TEXT("%s::%s"), *Function->GetOuter()->GetName(), *Function->GetName());
+	// Only format the name the first time a function is seen, rather than building a key string for every call.
+	RPCStat* Stat = RecentRPCs.Find(Function);
+	if (Stat == nullptr)
+	{
+		Stat = &RecentRPCs.Add(Function);
+		Stat->Name = FString::Printf(TEXT("%s::%s"), *Function->GetOuter()->GetName(), *Function->GetName());
+		Stat->Type = RPCType;
+		Stat->Calls = 0;
+		Stat->TotalPayload = 0;
+	}
+
+	Stat->Calls++;
+	Stat->TotalPayload += PayloadSize;
+}
+
+int64 USpatialMetrics::BandwidthStat::GetTotalCount() const
+{
+	int64 Total = 0;
+	for (int64 CategoryCount : Count)
+	{
+		Total += CategoryCount;
+	}
+	return Total;
+}
+
+int64 USpatialMetrics::BandwidthStat::GetTotalBytes() const
+{
+	int64 Total = 0;
+	for (int64 CategoryBytes : Bytes)
+	{
+		Total += CategoryBytes;
+	}
+	return Total;
+}
+
+USpatialMetrics::BandwidthStat USpatialMetrics::CreateBandwidthStat(const FString& Name)
+{
+	BandwidthStat Stat;
+	Stat.Name = Name;
+	FMemory::Memzero(Stat.Count);
+	FMemory::Memzero(Stat.Bytes);
+	return Stat;
+}
+
+void USpatialMetrics::SpatialStartBandwidthMetrics()
+{
+	if (bBandwidthTrackingEnabled)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Already recording bandwidth metrics"));
+		return;
+	}
+
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Recording bandwidth metrics"));
+
+	ClassBandwidth.Empty();
+	ComponentBandwidth.Empty();
+	bBandwidthTrackingEnabled = true;
+	BandwidthTrackingStartTime = FPlatformTime::Seconds();
+}
+
+void USpatialMetrics::SpatialStopBandwidthMetrics()
+{
+	if (!bBandwidthTrackingEnabled)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Could not stop recording bandwidth metrics. Bandwidth metrics not yet started."));
+		return;
+	}
+
+	const double TrackBandwidthInterval = FPlatformTime::Seconds() - BandwidthTrackingStartTime;
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Recorded bandwidth for %d classes and %d components over the last %.3f seconds:"),
+		ClassBandwidth.Num(), ComponentBandwidth.Num(), TrackBandwidthInterval);
+
+	TArray<const BandwidthStat*> ClassStats;
+	for (const auto& Pair : ClassBandwidth)
+	{
+		ClassStats.Add(&Pair.Value);
+	}
+	LogBandwidthStats(TEXT("Class"), ClassStats, TrackBandwidthInterval);
+
+	TArray<const BandwidthStat*> ComponentStats;
+	for (const auto& Pair : ComponentBandwidth)
+	{
+		ComponentStats.Add(&Pair.Value);
+	}
+	LogBandwidthStats(TEXT("Component"), ComponentStats, TrackBandwidthInterval);
+
+	ClassBandwidth.Empty();
+	ComponentBandwidth.Empty();
+	bBandwidthTrackingEnabled = false;
+}
+
+void USpatialMetrics::LogBandwidthStats(const TCHAR* Title, TArray<const BandwidthStat*>& Stats, double Interval) const
+{
+	if (Stats.Num() == 0)
+	{
+		return;
+	}
+
+	// Show the most expensive entries at the top.
+	Stats.Sort([](const BandwidthStat& A, const BandwidthStat& B)
+	{
+		return A.GetTotalBytes() > B.GetTotalBytes();
+	});
+
+	int MaxNameLen = FCString::Strlen(Title);
+	for (const BandwidthStat* Stat : Stats)
+	{
+		MaxNameLen = FMath::Max(MaxNameLen, Stat->Name.Len());
+	}
+
+	const FString SeparatorLine = FString::Printf(TEXT("%s-+------------+------------+------------+------------+------------+-------------+-----------"), *FString::ChrN(MaxNameLen, '-'));
+
+	UE_LOG(LogSpatialMetrics, Log, TEXT("---------------------------"));
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Sent bandwidth by %s - %s:"), Title, bIsServer ? TEXT("Server") : TEXT("Client"));
+	UE_LOG(LogSpatialMetrics, Log, TEXT("%s |    Updates |       RPCs |  Creations |      Bytes |  Bytes/sec | Updates/sec | Avg. bytes"), *FString(Title).RightPad(MaxNameLen));
+	UE_LOG(LogSpatialMetrics, Log, TEXT("%s"), *SeparatorLine);
+
+	for (const BandwidthStat* Stat : Stats)
+	{
+		const int64 TotalCount = Stat->GetTotalCount();
+		const int64 TotalBytes = Stat->GetTotalBytes();
+		UE_LOG(LogSpatialMetrics, Log, TEXT("%s | %10lld | %10lld | %10lld | %10lld | %10.1f | %11.2f | %10.1f"),
+			*Stat->Name.RightPad(MaxNameLen),
+			Stat->Count[static_cast<int32>(EBandwidthCategory::ComponentUpdate)],
+			Stat->Count[static_cast<int32>(EBandwidthCategory::RPC)],
+			Stat->Count[static_cast<int32>(EBandwidthCategory::EntityCreation)],
+			TotalBytes, TotalBytes / Interval, Stat->Count[static_cast<int32>(EBandwidthCategory::ComponentUpdate)] / Interval,
+			TotalCount > 0 ? static_cast<double>(TotalBytes) / TotalCount : 0.0);
+	}
+	UE_LOG(LogSpatialMetrics, Log, TEXT("%s"), *SeparatorLine);
+}
+
+void USpatialMetrics::SpatialDumpBandwidthMetrics(const FString& FilePath)
+{
+	if (!bBandwidthTrackingEnabled)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Could not dump bandwidth metrics. Bandwidth metrics not yet started."));
+		return;
+	}
+
+	const double TrackBandwidthInterval = FPlatformTime::Seconds() - BandwidthTrackingStartTime;
+	const FString OutputPath = FilePath.IsEmpty()
+		? FPaths::Combine(FPaths::ProjectLogDir(), TEXT("BandwidthMetrics"), FString::Printf(TEXT("%s_%s.csv"), bIsServer ? TEXT("Server") : TEXT("Client"), *FDateTime::Now().ToString()))
+		: FilePath;
 
-	if (RecentRPCs.Find(FunctionName) == nullptr)
+	TArray<FString> Lines;
+	Lines.Reserve(ClassBandwidth.Num() + ComponentBandwidth.Num() + 1);
+	Lines.Add(TEXT("Type,Name,UpdateCount,UpdateBytes,RPCCount,RPCBytes,CreationCount,CreationBytes,TotalBytes,BytesPerSecond"));
+
+	auto AddLine = [&Lines, TrackBandwidthInterval](const TCHAR* Type, const BandwidthStat& Stat)
+	{
+		const int64 TotalBytes = Stat.GetTotalBytes();
+		Lines.Add(FString::Printf(TEXT("%s,%s,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%.3f"), Type, *Stat.Name,
+			Stat.Count[static_cast<int32>(EBandwidthCategory::ComponentUpdate)], Stat.Bytes[static_cast<int32>(EBandwidthCategory::ComponentUpdate)],
+			Stat.Count[static_cast<int32>(EBandwidthCategory::RPC)], Stat.Bytes[static_cast<int32>(EBandwidthCategory::RPC)],
+			Stat.Count[static_cast<int32>(EBandwidthCategory::EntityCreation)], Stat.Bytes[static_cast<int32>(EBandwidthCategory::EntityCreation)],
+			TotalBytes, TrackBandwidthInterval > 0.0 ? TotalBytes / TrackBandwidthInterval : 0.0));
+	};
+
+	for (const auto& Pair : ClassBandwidth)
+	{
+		AddLine(TEXT("Class"), Pair.Value);
+	}
+	for (const auto& Pair : ComponentBandwidth)
 	{
-		RPCStat Stat;
-		Stat.Name = FunctionName;
-		Stat.Type = RPCType;
-		Stat.Calls = 0;
-		Stat.TotalPayload = 0;
+		AddLine(TEXT("Component"), Pair.Value);
+	}
 
-		RecentRPCs.Add(FunctionName, Stat);
+	if (FFileHelper::SaveStringArrayToFile(Lines, *OutputPath))
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Wrote bandwidth metrics for %d classes and %d components to %s"), ClassBandwidth.Num(), ComponentBandwidth.Num(), *OutputPath);
 	}
+	else
+	{
+		UE_LOG(LogSpatialMetrics, Warning, TEXT("SpatialDumpBandwidthMetrics: Failed to write bandwidth metrics to %s"), *OutputPath);
+	}
+}
 
-	RPCStat& Stat = RecentRPCs[FunctionName];
-	Stat.Calls++;
-	Stat.TotalPayload += PayloadSize;
+void USpatialMetrics::TrackSentClassBandwidth(const UClass* Class, EBandwidthCategory Category, uint32 Bytes)
+{
+	if (!bBandwidthTrackingEnabled || Class == nullptr)
+	{
+		return;
+	}
+
+	BandwidthStat* Stat = ClassBandwidth.Find(Class);
+	if (Stat == nullptr)
+	{
+		Stat = &ClassBandwidth.Add(Class, CreateBandwidthStat(Class->GetPathName()));
+	}
+
+	Stat->Count[static_cast<int32>(Category)]++;
+	Stat->Bytes[static_cast<int32>(Category)] += Bytes;
+}
+
+void USpatialMetrics::TrackSentComponentBandwidth(Worker_ComponentId ComponentId, EBandwidthCategory Category, uint32 Bytes)
+{
+	if (!bBandwidthTrackingEnabled)
+	{
+		return;
+	}
+
+	BandwidthStat* Stat = ComponentBandwidth.Find(ComponentId);
+	if (Stat == nullptr)
+	{
+		Stat = &ComponentBandwidth.Add(ComponentId, CreateBandwidthStat(FString::Printf(TEXT("%u"), ComponentId)));
+	}
+
+	Stat->Count[static_cast<int32>(Category)]++;
+	Stat->Bytes[static_cast<int32>(Category)] += Bytes;
+}
+
+int64 USpatialMetrics::GetSentClassBandwidthCount(const UClass* Class, EBandwidthCategory Category) const
+{
+	const BandwidthStat* Stat = ClassBandwidth.Find(Class);
+	return Stat != nullptr ? Stat->Count[static_cast<int32>(Category)] : 0;
+}
+
+int64 USpatialMetrics::GetSentComponentBandwidthCount(Worker_ComponentId ComponentId, EBandwidthCategory Category) const
+{
+	const BandwidthStat* Stat = ComponentBandwidth.Find(ComponentId);
+	return Stat != nullptr ? Stat->Count[static_cast<int32>(Category)] : 0;
+}
+
+int64 USpatialMetrics::GetSentComponentBandwidthBytes(Worker_ComponentId ComponentId, EBandwidthCategory Category) const
+{
+	const BandwidthStat* Stat = ComponentBandwidth.Find(ComponentId);
+	return Stat != nullptr ? Stat->Bytes[static_cast<int32>(Category)] : 0;
 }
 
 void USpatialMetrics::HandleWorkerMetrics(Worker_Op* Op)
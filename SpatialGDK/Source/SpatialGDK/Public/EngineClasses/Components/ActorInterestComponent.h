@@ -23,7 +23,14 @@ public:
 	UActorInterestComponent() = default;
 	~UActorInterestComponent() = default;
 
-	void PopulateFrequencyToConstraintsMap(const USpatialClassInfoManager& ClassInfoManager, SpatialGDK::FrequencyToConstraintsMap& OutFrequencyToQueryConstraints) const;
+	// The constraints are created from Queries the first time they are needed and reused afterwards.
+	void PopulateFrequencyToConstraintsMap(const USpatialClassInfoManager& ClassInfoManager, SpatialGDK::FrequencyToConstraintsMap& OutFrequencyToQueryConstraints);
+
+	// Must be called after changing Queries at runtime.
+	void InvalidateCompiledConstraints();
+
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 
 	/**
 	 * Whether to use NetCullDistanceSquared to generate constraints relative to the Actor that this component is attached to.
@@ -37,4 +44,9 @@ public:
 	UPROPERTY(BlueprintReadonly, EditDefaultsOnly, Category = "Interest")
 	TArray<FQueryData> Queries;
 
+private:
+	// Drops the user defined constraints the interest factory collected from this component's Actor.
+	void NotifyInterestFactory() const;
+
+	TOptional<SpatialGDK::FrequencyToConstraintsMap> CompiledFrequencyToConstraints;
 };
@@ -211,10 +211,7 @@ public:
 		}
 	}
 
-	inline void SetServerAuthority(const bool IsAuth)
-	{
-		bIsAuthServer = IsAuth;
-	}
+	void SetServerAuthority(const bool IsAuth);
 
 	inline bool IsAuthoritativeServer() const
 	{
@@ -303,6 +300,8 @@ private:
 
 	void InitializeHandoverShadowData(TArray<uint8>& ShadowData, UObject* Object);
 	FHandoverChangeState GetHandoverChangeList(TArray<uint8>& ShadowData, UObject* Object);
+
+	void PrefetchHandover(const FClassInfo& Info, VirtualWorkerId PredictedVirtualWorkerId);
 	
 public:
 	// If this actor channel is responsible for creating a new entity, this will be set to true once the entity creation request is issued.
@@ -346,6 +345,14 @@ private:
 	FVector LastPositionSinceUpdate;
 	float TimeWhenPositionLastUpdated;
 
+	// Used on the server. Negative until this worker gains authority over an existing entity, which is when the
+	// minimum authority dwell time starts.
+	float TimeWhenAuthorityGained;
+
+	// Used on the server. The virtual worker this worker already sent an authority intent for, ahead of the Actor
+	// leaving its area. Invalid when no handover was prefetched.
+	VirtualWorkerId PrefetchedAuthorityIntent;
+
 	uint8 FramesTillDormancyAllowed = 0;
 
 	// This is incremented in ReplicateActor. It represents how many bytes are sent per call to ReplicateActor.
@@ -35,19 +35,52 @@ public:
 	void OnEntityRemoved(const Worker_RemoveEntityOp& Op);
 	void OnAclAuthorityChanged(const Worker_AuthorityChangeOp& AuthOp);
 
+	// Re-evaluates the ACLs of the entities whose authority intent points at one of the changed virtual workers. Virtual
+	// workers that are not mapped to a physical worker are skipped.
+	void OnVirtualWorkerMappingChanged(const TArray<VirtualWorkerId>& ChangedVirtualWorkerIds);
+
 	void MaybeQueueAclAssignmentRequest(const Worker_EntityId EntityId);
 	// Visible for testing
 	bool AclAssignmentRequestIsQueued(const Worker_EntityId EntityId) const;
 
+	// Returns at most MaxAclAssignmentsPerTick requests, oldest first. The rest stay queued for the next call.
 	TArray<AclWriteAuthorityRequest> ProcessQueuedAclAssignmentRequests();
 
+	// 0 means no limit. Defaults to USpatialGDKSettings::MaxAclAssignmentsPerTick.
+	void SetMaxAclAssignmentsPerTick(int32 InMaxAclAssignmentsPerTick) { MaxAclAssignmentsPerTick = InMaxAclAssignmentsPerTick; }
+	int32 GetNumQueuedAclAssignmentRequests() const { return QueuedAclAssignmentRequests.Num(); }
+
 private:
 	void QueueAclAssignmentRequest(const Worker_EntityId EntityId);
+	void AddAclAssignmentRequestEntry(const Worker_EntityId EntityId);
 	bool CanEnforce(Worker_EntityId EntityId) const;
 
+	void SetEnforcedIntent(const Worker_EntityId EntityId, VirtualWorkerId IntentVirtualWorkerId);
+	void RemoveEnforcedIntent(const Worker_EntityId EntityId);
+
 	const PhysicalWorkerName WorkerId;
 	TWeakObjectPtr<const USpatialStaticComponentView> StaticComponentView;
 	const SpatialVirtualWorkerTranslator* VirtualWorkerTranslator;
 
-	TArray<Worker_EntityId> AclWriteAuthAssignmentRequests;
+	struct QueuedAclAssignmentRequest
+	{
+		Worker_EntityId EntityId;
+		uint64 Sequence;
+	};
+
+	// Requests in the order they were queued, and the sequence number of the live entry of each entity with a queued
+	// request. Dropping a request only removes it from the map; entries of the array that are no longer live, because the
+	// request was dropped or the entity was queued again since, are skipped when processing.
+	TArray<QueuedAclAssignmentRequest> AclWriteAuthAssignmentRequests;
+	TMap<Worker_EntityId_Key, uint64> QueuedAclAssignmentRequests;
+	uint64 NextAclAssignmentRequestSequence;
+
+	int32 MaxAclAssignmentsPerTick;
+
+	// The authority intent of each entity whose ACL this worker enforces, indexed by virtual worker so that a mapping
+	// change only re-evaluates the entities it affects.
+	TMap<Worker_EntityId_Key, VirtualWorkerId> EnforcedEntityIntents;
+	TMap<VirtualWorkerId, TSet<Worker_EntityId_Key>> EnforcedEntitiesByIntent;
+
+	void DropAclAssignmentRequest(const Worker_EntityId EntityId);
 };
@@ -70,4 +70,11 @@ public:
 	// Player lifecycle
 	Worker_EntityId PlayerControllerEntity;
 	FTimerHandle HeartbeatTimer;
+
+	// Called by UpdateLevelVisibility, so the level constraint is rebuilt on the next interest update.
+	void ResetCachedLevelConstraint() { CachedLevelConstraint.Reset(); }
+
+	// Limits the client's interest to the levels it has loaded. Built by the InterestFactory on the first interest update
+	// after the client's level visibility changes, and reused until the next change.
+	TOptional<SpatialGDK::QueryConstraint> CachedLevelConstraint;
 };
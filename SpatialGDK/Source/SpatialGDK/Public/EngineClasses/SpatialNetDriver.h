@@ -49,6 +49,7 @@ DECLARE_LOG_CATEGORY_EXTERN(LogSpatialOSNetDriver, Log, All);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Consider List Size"), STAT_SpatialConsiderList, STATGROUP_SpatialNet,);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Relevant Actors"), STAT_SpatialActorsRelevant, STATGROUP_SpatialNet,);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Changed Relevant Actors"), STAT_SpatialActorsChanged, STATGROUP_SpatialNet,);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Actors Outside Client Interest"), STAT_SpatialActorsOutsideClientInterest, STATGROUP_SpatialNet,);
 
 UCLASS()
 class SPATIALGDK_API USpatialNetDriver : public UIpNetDriver
@@ -126,6 +127,13 @@ public:
 	TWeakObjectPtr<USpatialNetConnection> FindClientConnectionFromWorkerId(const FString& WorkerId);
 	void CleanUpClientConnection(USpatialNetConnection* ClientConnection);
 
+	// Counts an Actor this worker handed over, for the metrics and for the migration rates reported with the worker load.
+	void TrackAuthorityMigration(VirtualWorkerId NewAuthVirtualWorkerId);
+
+	// Gives this worker authority over the replicated Actors the load balancing strategy assigns to it. Authority for all of
+	// them is decided in one batch, since this runs for every Actor in the world at startup and in a level when it is loaded.
+	void BecomeAuthoritativeOverActorsBasedOnLBStrategy(const TArray<AActor*>& Actors);
+
 	UPROPERTY()
 	USpatialWorkerConnection* Connection;
 	UPROPERTY()
@@ -222,6 +230,7 @@ private:
 	void InitializeSpatialOutputDevice();
 	void CreateAndInitializeCoreClasses();
 	void CreateAndInitializeLoadBalancingClasses();
+	void FlushLatencyTraceExporters();
 
 	void CreateServerSpatialOSNetConnection();
 	USpatialActorChannel* CreateSpatialActorChannel(AActor* Actor);
@@ -249,6 +258,8 @@ private:
 	int32 ServerReplicateActors_PrepConnections(const float DeltaSeconds);
 	int32 ServerReplicateActors_PrioritizeActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors);
 	void ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated);
+	// SpatialGDK: Removes Actors which no client is interested in from the consider list, and delays their next update.
+	void ServerReplicateActors_ThrottleActorsOutsideClientInterest(TArray<FNetworkObjectInfo*>& ConsiderList);
 #endif
 
 	void ProcessRPC(AActor* Actor, UObject* SubObject, UFunction* Function, void* Parameters);
@@ -257,6 +268,11 @@ private:
 	void ProcessPendingDormancy();
 	void PollPendingLoads();
 
+	void OnLoadBalancingLayoutChanged();
+	void ReportWorkerLoad(float DeltaTime);
+	void UpdateNetCullDistanceFrequencyScale(float DeltaTime);
+	float EstimateMaxClientInterestBandwidth(float FrequencyDistanceScale) const;
+
 	// This index is incremented and assigned to every new RPC in ProcessRemoteFunction.
 	// The SpatialSender uses these indexes to retry any failed reliable RPCs
 	// in the correct order, if needed.
@@ -264,6 +280,20 @@ private:
 
 	float TimeWhenPositionLastUpdated;
 
+	// Load accumulated since this worker last reported it on its ServerWorker component.
+	float TimeSinceWorkerLoadReported = 0.f;
+	uint32 FramesSinceWorkerLoadReported = 0;
+	double ReplicationTimeSinceWorkerLoadReported = 0.0;
+	uint32 RPCsSinceWorkerLoadReported = 0;
+	TMap<VirtualWorkerId, uint32> MigrationsSinceWorkerLoadReported;
+
+	// Load accumulated since the net cull distance frequency buckets were last evaluated.
+	float TimeSinceNetCullDistanceFrequencyUpdated = 0.f;
+	float IdleTimeSinceNetCullDistanceFrequencyUpdated = 0.f;
+	uint32 FramesSinceNetCullDistanceFrequencyUpdated = 0;
+	int64 ReplicationBitsSinceNetCullDistanceFrequencyUpdated = 0;
+	uint32 ReplicationsSinceNetCullDistanceFrequencyUpdated = 0;
+
 	// Counter for giving each connected client a unique IP address to satisfy Unreal's requirement of
 	// each client having a unique IP address in the UNetDriver::MappedClientConnections map.
 	// The GDK does not use this address for any networked purpose, only bookkeeping.
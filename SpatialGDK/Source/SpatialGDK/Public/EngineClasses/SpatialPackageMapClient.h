@@ -7,6 +7,7 @@
 
 #include "Schema/UnrealMetadata.h"
 #include "Schema/UnrealObjectRef.h"
+#include "Utils/FlatLookupTable.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -108,6 +109,22 @@ private:
 	FNetworkGUID RegisterNetGUIDFromPathForStaticObject(const FString& PathName, const FNetworkGUID& OuterGUID, bool bNoLoadOnClient);
 	FNetworkGUID GenerateNewNetGUID(const int32 IsStatic);
 
+	// Accessors over the lookup tables below. A NetGUID maps to exactly one object ref, which is stored
+	// in the flat tables if it is a plain entity ref and in the TMaps otherwise.
+	static bool IsEntityOffsetRef(const FUnrealObjectRef& ObjectRef);
+	const FNetworkGUID* FindNetGUID(const FUnrealObjectRef& ObjectRef) const;
+	bool FindObjectRef(const FNetworkGUID& NetGUID, FUnrealObjectRef& OutObjectRef) const;
+	void SetNetGUIDForObjectRef(const FUnrealObjectRef& ObjectRef, const FNetworkGUID& NetGUID);
+	void SetObjectRefForNetGUID(const FNetworkGUID& NetGUID, const FUnrealObjectRef& ObjectRef);
+	void RemoveNetGUIDForObjectRef(const FUnrealObjectRef& ObjectRef);
+	void RemoveObjectRefForNetGUID(const FNetworkGUID& NetGUID);
+
+	// Refs of the form (entity ID, offset) are hit on every object property read and write, so they are kept in
+	// open-addressing tables rather than in the TMaps, which hash and compare the optional path and outer fields.
+	SpatialGDK::FNetGUIDToEntityRefTable NetGUIDToEntityRef;
+	SpatialGDK::FEntityOffsetToNetGUIDTable EntityOffsetToNetGUID;
+
+	// Refs that carry a path (stably named objects, singleton class paths).
 	TMap<FNetworkGUID, FUnrealObjectRef> NetGUIDToUnrealObjectRef;
 	TMap<FUnrealObjectRef, FNetworkGUID> UnrealObjectRefToNetGUID;
 };
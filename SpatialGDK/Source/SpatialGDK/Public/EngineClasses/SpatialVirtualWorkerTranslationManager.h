@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Containers/Queue.h"
+#include "LoadBalancing/AbstractLBStrategy.h"
 #include "SpatialCommonTypes.h"
 #include "SpatialConstants.h"
 
@@ -43,6 +44,10 @@ public:
 	// The translation manager only cares about changes to the authority of the translation mapping.
 	void AuthorityChanged(const Worker_AuthorityChangeOp& AuthChangeOp);
 
+	// Periodically collects server worker loads and publishes them to every worker, together with the layout
+	// if the load balancing strategy changed it.
+	void Tick(float DeltaTime);
+
 private:
 	SpatialOSDispatcherInterface* Receiver;
 	SpatialOSWorkerInterface* Connection;
@@ -53,10 +58,21 @@ private:
 	TMap<PhysicalWorkerName, VirtualWorkerId> PhysicalToVirtualWorkerMapping;
 	TQueue<VirtualWorkerId> UnassignedVirtualWorkers;
 
+	// Incremented each time a changed mapping is published. Updates which only change the layout leave the mapping out.
+	uint32 MappingVersion;
+	bool bMappingChangedSinceLastUpdate;
+
+	// The loads collected by the last server worker load query, published with every translation update.
+	TMap<VirtualWorkerId, FVirtualWorkerLoad> VirtualWorkerLoads;
+
 	bool bWorkerEntityQueryInFlight;
 
+	bool bIsAuthoritative;
+	bool bWorkerLoadQueryInFlight;
+	float TimeSinceLoadsCollected;
+
 	// Serialization and deserialization of the mapping.
-	void WriteMappingToSchema(Schema_Object* Object) const;
+	void WriteMappingToSchema(Schema_Object* Object, bool bIncludeMapping) const;
 
 	// The following methods are used to query the Runtime for all worker entities and update the mapping
 	// based on the response.
@@ -65,6 +81,10 @@ private:
 	void ConstructVirtualWorkerMappingFromQueryResponse(const Worker_EntityQueryResponseOp& Op);
 	void SendVirtualWorkerMappingUpdate();
 
+	// The following methods collect the load reported by each server worker and pass it to the load balancing strategy.
+	void QueryForServerWorkerLoads();
+	void ServerWorkerLoadQueryDelegate(const Worker_EntityQueryResponseOp& Op);
+
 	void AssignWorker(const PhysicalWorkerName& WorkerId, const Worker_EntityId& ServerWorkerEntityId);
 };
 
@@ -39,10 +39,22 @@ public:
 	// On receiving a version of the translation state, apply that to the internal mapping.
 	void ApplyVirtualWorkerManagerData(Schema_Object* ComponentObject);
 
+	UAbstractLBStrategy* GetLoadBalanceStrategy() const { return LoadBalanceStrategy.Get(); }
+
+	// The version of the last mapping received, or 0 if none has been received.
+	uint32 GetMappingVersion() const { return MappingVersion; }
+
+	// Broadcast after applying a mapping, with the virtual workers whose entry was added or changed. Removed entries are not
+	// reported, since there is no worker to assign their entities to until the virtual worker is mapped again. Not broadcast
+	// if no entry was added or changed.
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnMappingChanged, const TArray<VirtualWorkerId>& /* ChangedVirtualWorkerIds */);
+	FOnMappingChanged OnMappingChanged;
+
 private:
 	TWeakObjectPtr<UAbstractLBStrategy> LoadBalanceStrategy;
 
 	TMap<VirtualWorkerId, TPair<PhysicalWorkerName, Worker_EntityId>> VirtualToPhysicalWorkerMapping;
+	uint32 MappingVersion;
 
 	bool bIsReady;
 
@@ -53,6 +65,9 @@ private:
 	// Serialization and deserialization of the mapping.
 	void ApplyMappingFromSchema(Schema_Object* Object);
 	bool IsValidMapping(Schema_Object* Object) const;
+	void ApplyLayoutFromSchema(Schema_Object* Object);
+	void ApplyLoadsFromSchema(Schema_Object* Object);
 
-	void UpdateMapping(VirtualWorkerId Id, PhysicalWorkerName Name, Worker_EntityId ServerWorkerEntityId);
+	// Returns true if the entry for Id was added or changed.
+	bool UpdateMapping(VirtualWorkerId Id, PhysicalWorkerName Name, Worker_EntityId ServerWorkerEntityId);
 };
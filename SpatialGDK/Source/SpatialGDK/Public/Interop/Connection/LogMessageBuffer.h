@@ -0,0 +1,81 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Function.h"
+
+namespace SpatialGDK
+{
+
+// Buffers log messages destined for the SpatialOS Runtime so that logging does not cost a queued outgoing message per line.
+// Messages can be added from any thread. Identical messages that are still waiting to be sent are merged and counted
+// instead of being queued again. Flush is called from the thread that owns the worker connection and sends messages
+// in order, within a bytes-per-second budget. Messages added while the buffer is full are dropped and reported once
+// space is available again.
+class SPATIALGDK_API FLogMessageBuffer
+{
+public:
+	// A BytesPerSecond of 0 disables the budget.
+	FLogMessageBuffer(uint32 InBytesPerSecond, int32 InMaxBufferedMessages);
+
+	void Add(uint8 Level, const FName& LoggerName, const TCHAR* Message);
+
+	using FSendLogMessageFunction = TFunctionRef<void(uint8 Level, const FName& LoggerName, const FString& Message)>;
+
+	// Sends as many buffered messages as the budget allows. CurrentTime is in seconds.
+	void Flush(double CurrentTime, FSendLogMessageFunction SendLogMessage);
+
+	int32 GetNumBufferedMessages() const;
+	int64 GetNumDroppedMessages() const;
+
+private:
+	struct FBufferedLogMessage
+	{
+		uint8 Level;
+		FName LoggerName;
+		FString Message;
+		uint32 Repeats;
+	};
+
+	// Pending messages are only merged with messages of the same level and logger name.
+	struct FLogMessageKey
+	{
+		uint8 Level;
+		FName LoggerName;
+		FString Message;
+
+		bool operator==(const FLogMessageKey& Other) const
+		{
+			return Level == Other.Level && LoggerName == Other.LoggerName && Message.Equals(Other.Message, ESearchCase::CaseSensitive);
+		}
+
+		friend uint32 GetTypeHash(const FLogMessageKey& Key)
+		{
+			return HashCombine(HashCombine(::GetTypeHash(Key.Level), GetTypeHash(Key.LoggerName)), GetTypeHash(Key.Message));
+		}
+	};
+
+	static FString FormatMessage(const FBufferedLogMessage& BufferedMessage);
+
+	const uint32 BytesPerSecond;
+	const int32 MaxBufferedMessages;
+
+	mutable FCriticalSection Mutex;
+
+	// Pending messages in the order they were first added. Messages are removed from the front as they are sent,
+	// so PendingIndexOffset is added to every index stored in PendingIndexByMessage.
+	TArray<FBufferedLogMessage> PendingMessages;
+	TMap<FLogMessageKey, int64> PendingIndexByMessage;
+	int64 PendingIndexOffset = 0;
+
+	int64 TotalDroppedMessages = 0;
+	int64 DroppedMessagesToReport = 0;
+
+	// Only accessed from Flush.
+	double AvailableBytes;
+	double LastFlushTime = -1.0;
+};
+
+} // namespace SpatialGDK
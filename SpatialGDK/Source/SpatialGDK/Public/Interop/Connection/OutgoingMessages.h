@@ -184,7 +184,8 @@ struct FEntityQueryRequest : FOutgoingMessage
 		if (EntityQuery.snapshot_result_type_component_ids != nullptr)
 		{
 			ComponentIdStorage.SetNum(EntityQuery.snapshot_result_type_component_id_count);
-			FMemory::Memcpy(static_cast<void*>(ComponentIdStorage.GetData()), static_cast<const void*>(EntityQuery.snapshot_result_type_component_ids), ComponentIdStorage.Num());
+			FMemory::Memcpy(static_cast<void*>(ComponentIdStorage.GetData()), static_cast<const void*>(EntityQuery.snapshot_result_type_component_ids), ComponentIdStorage.Num() * sizeof(Worker_ComponentId));
+			EntityQuery.snapshot_result_type_component_ids = ComponentIdStorage.GetData();
 		}
 
 		TraverseConstraint(&EntityQuery.constraint);
@@ -6,9 +6,11 @@
 #include "HAL/Runnable.h"
 #include "HAL/ThreadSafeBool.h"
 
+#include "Interop/Connection/LogMessageBuffer.h"
 #include "Interop/Connection/SpatialOSWorkerInterface.h"
 #include "Interop/Connection/OutgoingMessages.h"
 #include "SpatialCommonTypes.h"
+#include "SpatialView/OpListRecorder.h"
 #include "UObject/WeakObjectPtr.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
@@ -66,6 +68,8 @@ private:
 	// End FRunnable Interface
 
 	void InitializeOpsProcessingThread();
+	void InitializeOpListRecording();
+	void FlushLogMessages();
 
 	template <typename T, typename... ArgsType>
 	void QueueOutgoingMessage(ArgsType&&... Args);
@@ -82,6 +86,12 @@ private:
 	TQueue<Worker_OpList*> OpListQueue;
 	TQueue<TUniquePtr<SpatialGDK::FOutgoingMessage>> OutgoingMessagesQueue;
 
+	// Log messages can be sent from any thread, so they are buffered separately and flushed with the outgoing messages.
+	TUniquePtr<SpatialGDK::FLogMessageBuffer> LogMessageBuffer;
+
+	// Set when the worker is started with -RecordOpLists=<directory>. Only used from the thread calling QueueLatestOpList.
+	TUniquePtr<SpatialGDK::OpListRecorder> OpListRecorder;
+
 	// RequestIds per worker connection start at 0 and incrementally go up each command sent.
 	Worker_RequestId NextRequestId = 0;
 };
@@ -114,6 +114,8 @@ public:
 	const FRPCInfo& GetRPCInfo(UObject* Object, UFunction* Function);
 
 	Worker_ComponentId GetComponentIdFromLevelPath(const FString& LevelPath) const;
+	// Same as GetComponentIdFromLevelPath, for the level package names in UNetConnection::ClientVisibleLevelNames, without string operations.
+	Worker_ComponentId GetComponentIdFromLevelName(const FName& LevelName);
 	bool IsSublevelComponent(Worker_ComponentId ComponentId) const;
 
 	const TMap<float, Worker_ComponentId>& GetNetCullDistanceToComponentIds() const;
@@ -153,4 +155,7 @@ private:
 	TMap<Worker_ComponentId, TSharedRef<FClassInfo>> ComponentToClassInfoMap;
 	TMap<Worker_ComponentId, uint32> ComponentToOffsetMap;
 	TMap<Worker_ComponentId, ESchemaComponentType> ComponentToCategoryMap;
+
+	// Built from the schema database's level paths at initialization. Names with a PIE prefix are resolved and added on first use.
+	TMap<FName, Worker_ComponentId> LevelNameToComponentId;
 };
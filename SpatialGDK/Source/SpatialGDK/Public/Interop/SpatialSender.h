@@ -59,9 +59,34 @@ struct FPendingRPC
 // care for actor getting deleted before actor channel
 using FChannelObjectPair = TPair<TWeakObjectPtr<USpatialActorChannel>, TWeakObjectPtr<UObject>>;
 using FRPCsOnEntityCreationMap = TMap<TWeakObjectPtr<const UObject>, SpatialGDK::RPCsOnEntityCreation>;
-using FUpdatesQueuedUntilAuthority = TMap<Worker_EntityId_Key, TArray<FWorkerComponentUpdate>>;
+
+struct FUpdateQueuedUntilAuthority
+{
+	FWorkerComponentUpdate Update;
+	// Class of the object the update was created for, which the bytes are attributed to once it is sent.
+	TWeakObjectPtr<const UClass> ObjectClass;
+};
+using FUpdatesQueuedUntilAuthority = TMap<Worker_EntityId_Key, TArray<FUpdateQueuedUntilAuthority>>;
 using FChannelsToUpdatePosition = TSet<TWeakObjectPtr<USpatialActorChannel>>;
 
+struct FInterestBucketChange
+{
+	// The interest bucket component the entity had before the first queued change, and the one it should end up with.
+	Worker_ComponentId OldComponent;
+	Worker_ComponentId NewComponent;
+	// Number of changes coalesced into this one.
+	int32 NumRequested;
+};
+using FPendingInterestBucketChanges = TMap<Worker_EntityId_Key, FInterestBucketChange>;
+
+struct FPendingInterestUpdate
+{
+	TWeakObjectPtr<AActor> Actor;
+	// Time of the first request since the last update was sent for this entity. Updates are sent oldest first.
+	float FirstRequestTime;
+};
+using FPendingInterestUpdates = TMap<Worker_EntityId_Key, FPendingInterestUpdate>;
+
 UCLASS()
 class SPATIALGDK_API USpatialSender : public UObject
 {
@@ -72,6 +97,8 @@ public:
 
 	// Actor Updates
 	void SendComponentUpdates(UObject* Object, const FClassInfo& Info, USpatialActorChannel* Channel, const FRepChangeState* RepChanges, const FHandoverChangeState* HandoverChanges, uint32& OutBytesWritten);
+	// Sends an update for a component of Object's entity, or queues it until this worker gains authority over the component.
+	void SendOrQueueComponentUpdate(UObject* Object, Worker_EntityId EntityId, const FWorkerComponentUpdate& Update);
 	void SendComponentInterestForActor(USpatialActorChannel* Channel, Worker_EntityId EntityId, bool bNetOwned);
 	void SendComponentInterestForSubobject(const FClassInfo& Info, Worker_EntityId EntityId, bool bNetOwned);
 	void SendPositionUpdate(Worker_EntityId EntityId, const FVector& Location);
@@ -88,6 +115,11 @@ public:
 	void SendRemoveComponents(Worker_EntityId EntityId, TArray<Worker_ComponentId> ComponentIds);
 	void SendInterestBucketComponentChange(const Worker_EntityId EntityId, const Worker_ComponentId OldComponent, const Worker_ComponentId NewComponent);
 
+	// Ownership changes can move many Actors between interest buckets in the same frame, often more than once. Changes are queued and
+	// sent once per frame, with at most one remove and one add component per entity.
+	void QueueInterestBucketComponentChange(const Worker_EntityId EntityId, const Worker_ComponentId OldComponent, const Worker_ComponentId NewComponent);
+	void ProcessInterestBucketComponentChanges();
+
 	void SendCreateEntityRequest(USpatialActorChannel* Channel, uint32& OutBytesWritten);
 	void RetireEntity(const Worker_EntityId EntityId);
 
@@ -110,6 +142,17 @@ public:
 	void UpdateClientAuthoritativeComponentAclEntries(Worker_EntityId EntityId, const FString& OwnerWorkerAttribute);
 	void UpdateInterestComponent(AActor* Actor);
 
+	// Interest updates can be requested many times in quick succession, for example on map transitions. With InterestUpdateDebounceTime
+	// or MaxInterestUpdatesPerTick set, requests are queued per entity and sent once they are old enough, oldest first and within the
+	// per tick budget. Otherwise the update is sent immediately.
+	bool ShouldQueueInterestUpdates() const;
+	void QueueInterestUpdate(AActor* Actor);
+	void ProcessPendingInterestUpdates();
+
+	// Removes the updates first requested at least DebounceTime before CurrentTime from PendingUpdates, oldest first and at most
+	// MaxUpdates of them if MaxUpdates > 0, and returns the Actors among them this worker is still authoritative over. Visible for testing.
+	static TArray<AActor*> TakeInterestUpdatesToSend(FPendingInterestUpdates& PendingUpdates, float CurrentTime, float DebounceTime, int32 MaxUpdates);
+
 	void ProcessOrQueueOutgoingRPC(const FUnrealObjectRef& InTargetObjectRef, SpatialGDK::RPCPayload&& InPayload);
 	void ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 
@@ -150,9 +193,11 @@ private:
 
 	TArray<Worker_InterestOverride> CreateComponentInterestForActor(USpatialActorChannel* Channel, bool bIsNetOwned);
 
-	// RPC Tracking
+	// RPC and bandwidth tracking
 #if !UE_BUILD_SHIPPING
 	void TrackRPC(AActor* Actor, UFunction* Function, const SpatialGDK::RPCPayload& Payload, const ERPCType RPCType);
+	void TrackComponentUpdate(const UClass* ObjectClass, const Worker_ComponentUpdate& Update);
+	void TrackEntityCreation(AActor* Actor, const TArray<FWorkerComponentData>& ComponentDatas);
 #endif
 
 	bool WillHaveAuthorityOverActor(AActor* TargetActor, Worker_EntityId TargetEntity);
@@ -190,4 +235,8 @@ private:
 	FUpdatesQueuedUntilAuthority UpdatesQueuedUntilAuthorityMap;
 
 	FChannelsToUpdatePosition ChannelsToUpdatePosition;
+
+	FPendingInterestBucketChanges PendingInterestBucketChanges;
+
+	FPendingInterestUpdates PendingInterestUpdates;
 };
@@ -39,6 +39,24 @@ public:
 
 	bool HasComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId) const;
 
+	// Direct access to an entity's components and authority, for callers that read several components of the same
+	// entity and want to look the entity up only once. Returns nullptr if the entity is not in view.
+	using ComponentStorage = TMap<Worker_ComponentId, TUniquePtr<SpatialGDK::Component>>;
+	using ComponentAuthority = TMap<Worker_ComponentId, Worker_Authority>;
+	const ComponentStorage* GetEntityComponents(Worker_EntityId EntityId) const { return EntityComponentMap.Find(EntityId); }
+	const ComponentAuthority* GetEntityAuthority(Worker_EntityId EntityId) const { return EntityComponentAuthorityMap.Find(EntityId); }
+
+	template <typename T>
+	static T* FindComponentData(const ComponentStorage& Components)
+	{
+		if (const TUniquePtr<SpatialGDK::Component>* Component = Components.Find(T::ComponentId))
+		{
+			return static_cast<T*>(Component->Get());
+		}
+
+		return nullptr;
+	}
+
 	void OnAddComponent(const Worker_AddComponentOp& Op);
 	void OnRemoveComponent(const Worker_RemoveComponentOp& Op);
 	void OnRemoveEntity(Worker_EntityId EntityId);
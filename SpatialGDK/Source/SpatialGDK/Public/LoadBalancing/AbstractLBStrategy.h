@@ -11,6 +11,33 @@
 
 #include "AbstractLBStrategy.generated.h"
 
+// The load a server worker last reported on its ServerWorker component.
+struct FVirtualWorkerLoad
+{
+	uint32 AuthoritativeActorCount = 0;
+	float AverageFrameTime = 0.f;
+	// Average time per frame spent replicating Actors, in seconds.
+	float AverageReplicationTime = 0.f;
+	float RPCsPerSecond = 0.f;
+	// Authority handed over to each other virtual worker per second, keyed by the virtual worker it was handed to.
+	TMap<VirtualWorkerId, float> MigrationsPerSecond;
+};
+
+// A region a server worker is interested in. Each region that limits its frequency or components becomes its own query.
+struct FWorkerInterestRegion
+{
+	SpatialGDK::QueryConstraint Constraint;
+
+	// Maximum frequency, in Hz, of updates for entities in this region. 0 means updates are not rate limited.
+	float Frequency = 0.f;
+
+	// Generated component types checked out in this region, on top of the components every server worker requires.
+	// Ignored when result types are disabled.
+	TArray<ESchemaComponentType> SchemaComponentTypes = { SCHEMA_Data, SCHEMA_OwnerOnly, SCHEMA_Handover };
+
+	bool IsFullInterest() const { return Frequency <= 0.f && SchemaComponentTypes.Num() == SCHEMA_Count; }
+};
+
 /**
  * This class can be used to define a load balancing strategy.
  * At runtime, all unreal workers will:
@@ -41,19 +68,105 @@ public:
 	virtual TSet<VirtualWorkerId> GetVirtualWorkerIds() const PURE_VIRTUAL(UAbstractLBStrategy::GetVirtualWorkerIds, return {};)
 
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const { return false; }
+
+	/**
+	* Whether this worker should hand over an Actor it is authoritative over. By default this is the opposite of
+	* ShouldHaveAuthority. Strategies can override it to keep authority until the Actor is clearly outside this worker's
+	* area, so that an Actor moving along a boundary doesn't migrate back and forth.
+	*/
+	virtual bool ShouldRelinquishAuthority(const AActor& Actor) const { return !ShouldHaveAuthority(Actor); }
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const PURE_VIRTUAL(UAbstractLBStrategy::WhoShouldHaveAuthority, return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;)
 
+	/**
+	* Batched version of WhoShouldHaveAuthority, for deciding authority for many Actors at once. OutVirtualWorkerIds is
+	* filled with one entry per Actor, in the same order. Strategies with a spatial index should override this to avoid
+	* per-Actor overhead.
+	*/
+	virtual void WhoShouldHaveAuthorityForActors(TArrayView<const AActor* const> Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const;
+
+	/**
+	* Authority decisions for a position rather than an Actor. Strategies whose decisions depend only on an Actor's position
+	* return true from SupportsLocationQueries and implement these, which lets authority be evaluated without Actors,
+	* for example by offline load balancing simulations.
+	*/
+	virtual bool SupportsLocationQueries() const { return false; }
+	virtual bool ShouldRelinquishAuthorityAtLocation(const FVector& Location) const { return false; }
+	virtual VirtualWorkerId WhoShouldHaveAuthorityAtLocation(const FVector& Location) const { return SpatialConstants::INVALID_VIRTUAL_WORKER_ID; }
+
+	/**
+	* The virtual worker expected to be authoritative over an Actor LookaheadTime seconds from now, extrapolating from its
+	* velocity. Returns the local virtual worker if the Actor is expected to stay, and INVALID_VIRTUAL_WORKER_ID if the
+	* strategy can't make predictions.
+	*/
+	virtual VirtualWorkerId PredictAuthority(const AActor& Actor, float LookaheadTime) const;
+
 	/**
 	* Get the query constraints required by this worker based on the load balancing strategy used.
 	*/
 	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const PURE_VIRTUAL(UAbstractLBStrategy::GetWorkerInterestQueryConstraint, return {};)
 
+	/**
+	* The interest of this worker as a union of regions, each with its own frequency and components. Strategies override this
+	* to check out less near their borders. By default this is a single full region for GetWorkerInterestQueryConstraint.
+	*/
+	virtual TArray<FWorkerInterestRegion> GetWorkerInterestRegions() const;
+
 	/**
 	* Get a logical worker entity position for this strategy. For example, the centre of a grid square in a grid-based strategy. Optional- otherwise returns the origin.
 	*/
 	virtual FVector GetWorkerEntityPosition() const { return FVector::ZeroVector; }
 
+	/**
+	* Strategies whose layout changes at runtime return the interval, in seconds, at which the worker authoritative over
+	* the virtual worker translation should collect worker loads and call UpdateLayout. Static strategies return 0.
+	*/
+	virtual float GetLayoutUpdateInterval() const { return 0.f; }
+
+	/**
+	* The interval, in seconds, at which server workers report their load and the loads are collected. This is the layout
+	* update interval for strategies with a runtime layout, and USpatialGDKSettings::WorkerLoadReportInterval otherwise.
+	*/
+	float GetLoadReportInterval() const;
+
+	/**
+	* The load last reported by the server worker assigned to a virtual worker, or nullptr if none has been received yet.
+	* Loads are published to every worker through the virtual worker translation.
+	*/
+	const FVirtualWorkerLoad* GetVirtualWorkerLoad(VirtualWorkerId Id) const { return VirtualWorkerLoads.Find(Id); }
+	void SetVirtualWorkerLoads(TMap<VirtualWorkerId, FVirtualWorkerLoad>&& InVirtualWorkerLoads) { VirtualWorkerLoads = MoveTemp(InVirtualWorkerLoads); }
+
+	/**
+	* Called on the worker authoritative over the virtual worker translation with the latest load of each virtual worker.
+	* Returns true if the layout changed, in which case it is broadcast to all workers through the translation component.
+	*/
+	virtual bool UpdateLayout(const TMap<VirtualWorkerId, FVirtualWorkerLoad>& VirtualWorkerLoads) { return false; }
+
+	/**
+	* Serialization of a runtime layout, so that every worker agrees on it. ApplyLayout should ignore layouts that are not
+	* newer than the current one, and return true if the layout changed.
+	*/
+	virtual void WriteLayout(TArray<uint8>& OutLayout) const {}
+	virtual bool ApplyLayout(const TArray<uint8>& Layout) { return false; }
+
+	// Broadcast whenever the layout changes, so that the worker can update its interest and worker entity position.
+	DECLARE_MULTICAST_DELEGATE(FOnLayoutChanged);
+	FOnLayoutChanged OnLayoutChanged;
+
 protected:
 
+	// Box constraint for a 2D area, unbounded in height.
+	static SpatialGDK::QueryConstraint CreateBoxConstraint(const FBox2D& Area);
+
+	/**
+	* Interest regions for a worker authoritative over Area. Everything up to AuthorityBorder away is checked out in full. The
+	* rest of the InterestBorder is split into strips that are rate limited to BorderFrequency and, if bBorderDataOnly is set,
+	* only check out replicated data.
+	*/
+	static TArray<FWorkerInterestRegion> CreateBorderedInterestRegions(const FBox2D& Area, float AuthorityBorder, float InterestBorder, float BorderFrequency, bool bBorderDataOnly);
+
 	VirtualWorkerId LocalVirtualWorkerId;
+
+private:
+
+	TMap<VirtualWorkerId, FVirtualWorkerLoad> VirtualWorkerLoads;
 };
@@ -0,0 +1,162 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "LoadBalancing/AbstractLBStrategy.h"
+
+#include "CoreMinimal.h"
+#include "Math/Box2D.h"
+#include "Math/Vector2D.h"
+
+#include "AdaptiveLBStrategy.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAdaptiveLBStrategy, Log, All)
+
+UENUM()
+enum class EAdaptiveLBLoadMetric : uint8
+{
+	AuthoritativeActorCount,
+	AverageFrameTime
+};
+
+/**
+ * A load balancing strategy that divides the world into a k-d tree with one leaf region per worker.
+ * Starts from an even split of the WorldWidth x WorldHeight area into NumWorkers regions, then adapts the layout to the
+ * load reported by each worker:
+ * - The region of the most loaded worker is split in half along its longer axis when its load exceeds
+ *   SplitLoadRatio times the average load.
+ * - To free a virtual worker for the new half, the two sibling regions with the lowest combined load are merged,
+ *   provided their combined load is below MergeLoadRatio times the average load.
+ * At most one split and merge is performed every LayoutUpdateInterval seconds.
+ *
+ * The layout is decided on the worker authoritative over the virtual worker translation and published with the
+ * translation mapping, so all workers agree on it.
+ *
+ * Given a Point, for each split:
+ * Point is on the upper side iff Point[Axis] >= SplitPosition
+ * Points outside the world bounds belong to the nearest region.
+ *
+ * As with the grid strategy, authority is only relinquished once an Actor is more than AuthorityHysteresisBand outside
+ * the worker's region.
+ *
+ * Intended Usage: Create a data-only blueprint subclass and change the properties.
+ */
+UCLASS(Blueprintable)
+class SPATIALGDK_API UAdaptiveLBStrategy : public UAbstractLBStrategy
+{
+	GENERATED_BODY()
+
+public:
+	UAdaptiveLBStrategy();
+
+	using LBStrategyRegions = TArray<TPair<VirtualWorkerId, FBox2D>>;
+
+/* UAbstractLBStrategy Interface */
+	virtual void Init() override;
+
+	virtual TSet<VirtualWorkerId> GetVirtualWorkerIds() const override;
+
+	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
+	virtual bool ShouldRelinquishAuthority(const AActor& Actor) const override;
+	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
+	virtual void WhoShouldHaveAuthorityForActors(TArrayView<const AActor* const> Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const override;
+
+	virtual bool SupportsLocationQueries() const override { return true; }
+	virtual bool ShouldRelinquishAuthorityAtLocation(const FVector& Location) const override;
+	virtual VirtualWorkerId WhoShouldHaveAuthorityAtLocation(const FVector& Location) const override;
+
+	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
+	virtual TArray<FWorkerInterestRegion> GetWorkerInterestRegions() const override;
+
+	virtual FVector GetWorkerEntityPosition() const override;
+
+	virtual float GetLayoutUpdateInterval() const override { return LayoutUpdateInterval; }
+	virtual bool UpdateLayout(const TMap<VirtualWorkerId, FVirtualWorkerLoad>& VirtualWorkerLoads) override;
+	virtual void WriteLayout(TArray<uint8>& OutLayout) const override;
+	virtual bool ApplyLayout(const TArray<uint8>& Layout) override;
+/* End UAbstractLBStrategy Interface */
+
+	VirtualWorkerId GetVirtualWorkerForLocation(const FVector2D& Location) const;
+
+	LBStrategyRegions GetLBStrategyRegions() const;
+
+	uint32 GetLayoutVersion() const { return LayoutVersion; }
+
+protected:
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Adaptive Load Balancing")
+	uint32 NumWorkers;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Adaptive Load Balancing")
+	float WorldWidth;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Adaptive Load Balancing")
+	float WorldHeight;
+
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Adaptive Load Balancing")
+	float InterestBorder;
+
+	/** Distance, in cm, that an Actor must move past the edge of a region before the worker relinquishes authority over it. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Adaptive Load Balancing")
+	float AuthorityHysteresisBand;
+
+	/** Maximum frequency, in Hz, of updates for Actors in the part of the InterestBorder beyond the AuthorityHysteresisBand. 0 means no rate limiting. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Adaptive Load Balancing")
+	float BorderInterestFrequency;
+
+	/** Only check out replicated data, not owner only or handover data, for Actors in the part of the InterestBorder beyond the AuthorityHysteresisBand. */
+	UPROPERTY(EditDefaultsOnly, Category = "Adaptive Load Balancing")
+	bool bBorderInterestDataOnly;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Adaptive Load Balancing")
+	EAdaptiveLBLoadMetric LoadMetric;
+
+	/** Seconds between layout updates. 0 disables adaptation, leaving the initial even layout. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Adaptive Load Balancing")
+	float LayoutUpdateInterval;
+
+	/** A region is split when its load exceeds this multiple of the average load. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Adaptive Load Balancing")
+	float SplitLoadRatio;
+
+	/** Two sibling regions are merged only if their combined load is below this multiple of the average load. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Adaptive Load Balancing")
+	float MergeLoadRatio;
+
+	/** Regions are never split into halves smaller than this, in cm. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "1"), Category = "Adaptive Load Balancing")
+	float MinRegionSize;
+
+private:
+	struct FNode
+	{
+		// Index of the child below and above the split. INDEX_NONE for leaves.
+		int32 Children[2] = { INDEX_NONE, INDEX_NONE };
+		int32 Parent = INDEX_NONE;
+
+		uint8 SplitAxis = 0;
+		float SplitPosition = 0.f;
+
+		VirtualWorkerId WorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+		FBox2D Bounds;
+
+		bool IsLeaf() const { return Children[0] == INDEX_NONE; }
+	};
+
+	// Nodes in pre-order, so the root is at index 0.
+	TArray<FNode> Nodes;
+
+	// Leaf region of each virtual worker, indexed by VirtualWorkerId - 1.
+	TArray<FBox2D> WorkerRegions;
+
+	uint32 LayoutVersion;
+
+	FBox2D GetWorldBounds() const;
+	int32 BuildEvenLayout(const FBox2D& Bounds, VirtualWorkerId FirstWorkerId, uint32 NumLeaves, int32 Parent, TArray<FNode>& OutNodes) const;
+	float GetLoadValue(const FVirtualWorkerLoad& Load) const;
+
+	// Recomputes node bounds and worker regions from the split planes, compacting the node array into pre-order.
+	void RebuildLayout(const TArray<FNode>& SourceNodes);
+	int32 CopySubtree(const TArray<FNode>& SourceNodes, int32 SourceIndex, int32 Parent, const FBox2D& Bounds);
+	int32 ReadNode(FArchive& Ar, int32 Parent, int32 Depth, TArray<FNode>& OutNodes) const;
+	bool IsValidLayout(const TArray<FNode>& SourceNodes) const;
+};
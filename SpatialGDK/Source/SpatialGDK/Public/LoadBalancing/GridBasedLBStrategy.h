@@ -21,6 +21,10 @@ DECLARE_LOG_CATEGORY_EXTERN(LogGridBasedLBStrategy, Log, All)
  *
  * Given a Point, for each Cell:
  * Point is inside Cell iff Min(Cell) <= Point < Max(Cell)
+ * The cell containing a Point is found directly from its coordinates, so authority lookups are constant time.
+ *
+ * A worker only relinquishes authority over an Actor once the Actor is more than AuthorityHysteresisBand
+ * outside its cell, so Actors moving along a cell edge don't migrate back and forth.
  *
  * Intended Usage: Create a data-only blueprint subclass and change
  * the Cols, Rows, WorldWidth, WorldHeight.
@@ -41,13 +45,23 @@ public:
 	virtual TSet<VirtualWorkerId> GetVirtualWorkerIds() const override;
 
 	virtual bool ShouldHaveAuthority(const AActor& Actor) const override;
+	virtual bool ShouldRelinquishAuthority(const AActor& Actor) const override;
 	virtual VirtualWorkerId WhoShouldHaveAuthority(const AActor& Actor) const override;
+	virtual void WhoShouldHaveAuthorityForActors(TArrayView<const AActor* const> Actors, TArray<VirtualWorkerId>& OutVirtualWorkerIds) const override;
+
+	virtual bool SupportsLocationQueries() const override { return true; }
+	virtual bool ShouldRelinquishAuthorityAtLocation(const FVector& Location) const override;
+	virtual VirtualWorkerId WhoShouldHaveAuthorityAtLocation(const FVector& Location) const override;
 
 	virtual SpatialGDK::QueryConstraint GetWorkerInterestQueryConstraint() const override;
+	virtual TArray<FWorkerInterestRegion> GetWorkerInterestRegions() const override;
 
 	virtual FVector GetWorkerEntityPosition() const override;
 /* End UAbstractLBStrategy Interface */
 
+	// Returns INVALID_VIRTUAL_WORKER_ID for locations outside the grid.
+	VirtualWorkerId GetVirtualWorkerForLocation(const FVector2D& Location) const;
+
 	LBStrategyRegions GetLBStrategyRegions() const;
 
 protected:
@@ -66,11 +80,28 @@ protected:
 	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Grid Based Load Balancing")
 	float InterestBorder;
 
+	/** Distance, in cm, that an Actor must move past the edge of a cell before the worker relinquishes authority over it. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Grid Based Load Balancing")
+	float AuthorityHysteresisBand;
+
+	/** Maximum frequency, in Hz, of updates for Actors in the part of the InterestBorder beyond the AuthorityHysteresisBand. 0 means no rate limiting. */
+	UPROPERTY(EditDefaultsOnly, meta = (ClampMin = "0"), Category = "Grid Based Load Balancing")
+	float BorderInterestFrequency;
+
+	/** Only check out replicated data, not owner only or handover data, for Actors in the part of the InterestBorder beyond the AuthorityHysteresisBand. */
+	UPROPERTY(EditDefaultsOnly, Category = "Grid Based Load Balancing")
+	bool bBorderInterestDataOnly;
+
 private:
 
 	TArray<VirtualWorkerId> VirtualWorkerIds;
 
+	// Cells are stored column by column, so the cell at (Row, Col) is at index Col * Rows + Row.
 	TArray<FBox2D> WorkerCells;
 
+	FVector2D GridMin;
+	float RowHeight;
+	float ColumnWidth;
+
 	static bool IsInside(const FBox2D& Box, const FVector2D& Location);
 };
@@ -28,11 +28,13 @@ public:
 
 	virtual void OnOwnerUpdated(const AActor* Actor, const AActor* OldOwner) override;
 
+	// Visible for testing
+	bool IsInCachedHierarchy(const AActor* Actor) const;
+
 private:
 	struct MigrationLockElement
 	{
 		int32 LockCount;
-		AActor* HierarchyRoot;
 	};
 
 	struct LockNameAndActor
@@ -41,28 +43,47 @@ private:
 		AActor* Actor;
 	};
 
+	// An Actor in the cached ownership hierarchy. Actors are added when they gain an owner, own another Actor or are
+	// locked, and removed once they have none of these, or when they are destroyed or leave the world. Actors that
+	// aren't in the hierarchy are their own hierarchy root.
+	struct OwnershipHierarchyNode
+	{
+		const AActor* Owner = nullptr;
+		const AActor* HierarchyRoot = nullptr;
+		TArray<const AActor*> OwnedActors;
+	};
+
 	bool CanAcquireLock(const AActor* Actor) const;
 	bool IsExplicitlyLocked(const AActor* Actor) const;
-	bool IsLockedHierarchyRoot(const AActor* Actor) const;
 
 	UFUNCTION()
-	void OnExplicitlyLockedActorDeleted(AActor* DestroyedActor);
+	void OnHierarchyActorDestroyed(AActor* DestroyedActor);
 
 	UFUNCTION()
-	void OnHierarchyRootActorDeleted(AActor* DestroyedActorRoot);
+	void OnHierarchyActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	void OnHierarchyActorRemoved(AActor* RemovedActor);
 
 	virtual bool AcquireLockFromDelegate(AActor* ActorToLock,    const FString& DelegateLockIdentifier) override;
 	virtual bool ReleaseLockFromDelegate(AActor* ActorToRelease, const FString& DelegateLockIdentifier) override;
 
-	void RecalculateAllExplicitlyLockedActorsInThisHierarchy(const AActor* HierarchyRoot);
-	void RecalculateLockedActorOwnershipHierarchyInformation(const AActor* ExplicitlyLockedActor);
-	void AddOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor);
-	void RemoveOwnershipHierarchyRootInformation(AActor* HierarchyRoot, const AActor* ExplicitlyLockedActor);
+	const AActor* GetCachedHierarchyRoot(const AActor* Actor) const;
+	OwnershipHierarchyNode& FindOrAddHierarchyNode(const AActor* Actor);
+	void RemoveHierarchyNode(const AActor* Actor);
+	void RemoveHierarchyNodeIfUnused(const AActor* Actor);
+	void SetHierarchyRoot(const AActor* SubtreeRoot, const AActor* NewHierarchyRoot);
+	void AddLockedActorToHierarchy(const AActor* HierarchyRoot);
+	void RemoveLockedActorFromHierarchy(const AActor* HierarchyRoot);
 
 	TMap<const AActor*, MigrationLockElement> ActorToLockingState;
 	TMap<ActorLockToken, LockNameAndActor> TokenToNameAndActor;
 	TMap<FString, ActorLockToken> DelegateLockingIdentifierToActorLockToken;
-	TMap<const AActor*, TArray<const AActor*>> LockedOwnershipRootActorToExplicitlyLockedActors;
+
+	// Owner tree of all owned and locked Actors, with the hierarchy root of every Actor cached, and the number of explicitly
+	// locked Actors in each hierarchy. Both are updated incrementally as owners change, so IsLocked doesn't have to walk
+	// the ownership chain.
+	TMap<const AActor*, OwnershipHierarchyNode> OwnershipHierarchy;
+	TMap<const AActor*, int32> HierarchyRootToLockedActorCount;
 
 	ActorLockToken NextToken = 1;
 };
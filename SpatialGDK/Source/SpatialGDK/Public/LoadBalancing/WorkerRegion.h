@@ -19,6 +19,9 @@ public:
 
 	void Init(UMaterial* Material, const FColor& Color, const FBox2D& Extents, const float VerticalScale);
 
+	void SetPositionAndScale(const FBox2D& Extents, const float VerticalScale);
+	void SetColor(const FColor& Color);
+
 	UPROPERTY()
 	UStaticMeshComponent *Mesh;
 
@@ -28,6 +31,4 @@ public:
 private:
 	void SetOpacity(const float Opacity);
 	void SetHeight(const float Height);
-	void SetPositionAndScale(const FBox2D& Extents, const float VerticalScale);
-	void SetColor(const FColor& Color);
 };
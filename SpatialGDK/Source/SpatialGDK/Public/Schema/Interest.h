@@ -13,33 +13,45 @@ struct SphereConstraint
 {
 	Coordinates Center;
 	double Radius;
+
+	bool operator==(const SphereConstraint& Other) const { return Center == Other.Center && Radius == Other.Radius; }
 };
 
 struct CylinderConstraint
 {
 	Coordinates Center;
 	double Radius;
+
+	bool operator==(const CylinderConstraint& Other) const { return Center == Other.Center && Radius == Other.Radius; }
 };
 
 struct BoxConstraint
 {
 	Coordinates Center;
 	EdgeLength EdgeLength;
+
+	bool operator==(const BoxConstraint& Other) const { return Center == Other.Center && EdgeLength == Other.EdgeLength; }
 };
 
 struct RelativeSphereConstraint
 {
 	double Radius;
+
+	bool operator==(const RelativeSphereConstraint& Other) const { return Radius == Other.Radius; }
 };
 
 struct RelativeCylinderConstraint
 {
 	double Radius;
+
+	bool operator==(const RelativeCylinderConstraint& Other) const { return Radius == Other.Radius; }
 };
 
 struct RelativeBoxConstraint
 {
 	EdgeLength EdgeLength;
+
+	bool operator==(const RelativeBoxConstraint& Other) const { return EdgeLength == Other.EdgeLength; }
 };
 
 struct QueryConstraint
@@ -104,6 +116,22 @@ struct QueryConstraint
 
 		return false;
 	}
+
+	bool operator==(const QueryConstraint& Other) const
+	{
+		return SphereConstraint == Other.SphereConstraint
+			&& CylinderConstraint == Other.CylinderConstraint
+			&& BoxConstraint == Other.BoxConstraint
+			&& RelativeSphereConstraint == Other.RelativeSphereConstraint
+			&& RelativeCylinderConstraint == Other.RelativeCylinderConstraint
+			&& RelativeBoxConstraint == Other.RelativeBoxConstraint
+			&& EntityIdConstraint == Other.EntityIdConstraint
+			&& ComponentConstraint == Other.ComponentConstraint
+			&& AndConstraint == Other.AndConstraint
+			&& OrConstraint == Other.OrConstraint;
+	}
+
+	bool operator!=(const QueryConstraint& Other) const { return !(*this == Other); }
 };
 
 struct Query
@@ -130,6 +158,16 @@ struct Query
 	// If multiple queries match the same Entity-Component then the highest of all frequencies is
 	// used.
 	TSchemaOption<float> Frequency;
+
+	bool operator==(const Query& Other) const
+	{
+		return Frequency == Other.Frequency
+			&& FullSnapshotResult == Other.FullSnapshotResult
+			&& ResultComponentIds == Other.ResultComponentIds
+			&& Constraint == Other.Constraint;
+	}
+
+	bool operator!=(const Query& Other) const { return !(*this == Other); }
 };
 
 // Constraints are typically linked to a corresponding frequency in the GDK use case, but without the result set yet.
@@ -148,6 +186,8 @@ using FrequencyConstraints = TArray<FrequencyConstraint>;
 struct ComponentInterest
 {
 	TArray<Query> Queries;
+
+	bool operator==(const ComponentInterest& Other) const { return Queries == Other.Queries; }
 };
 
 inline void AddQueryConstraintToQuerySchema(Schema_Object* QueryObject, Schema_FieldId Id, const QueryConstraint& Constraint)
@@ -436,6 +476,13 @@ struct Interest : Component
 		return ComponentInterestMap.Num() == 0;
 	}
 
+	bool operator==(const Interest& Other) const
+	{
+		return ComponentInterestMap.OrderIndependentCompareEqual(Other.ComponentInterestMap);
+	}
+
+	bool operator!=(const Interest& Other) const { return !(*this == Other); }
+
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& Update)
 	{
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
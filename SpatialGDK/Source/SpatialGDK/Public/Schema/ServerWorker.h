@@ -26,9 +26,17 @@ struct ServerWorker : Component
 	ServerWorker()
 		: WorkerName(SpatialConstants::INVALID_WORKER_NAME)
 		, bReadyToBeginPlay(false)
+		, AuthoritativeActorCount(0)
+		, AverageFrameTime(0.f)
+		, AverageReplicationTime(0.f)
+		, RPCsPerSecond(0.f)
 	{}
 
 	ServerWorker(const PhysicalWorkerName& InWorkerName, const bool bInReadyToBeginPlay)
+		: AuthoritativeActorCount(0)
+		, AverageFrameTime(0.f)
+		, AverageReplicationTime(0.f)
+		, RPCsPerSecond(0.f)
 	{
 		WorkerName = InWorkerName;
 		bReadyToBeginPlay = bInReadyToBeginPlay;
@@ -40,6 +48,11 @@ struct ServerWorker : Component
 
 		WorkerName = GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID);
 		bReadyToBeginPlay = GetBoolFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID);
+		AuthoritativeActorCount = Schema_GetUint32(ComponentObject, SpatialConstants::SERVER_WORKER_AUTHORITATIVE_ACTOR_COUNT_ID);
+		AverageFrameTime = Schema_GetFloat(ComponentObject, SpatialConstants::SERVER_WORKER_AVERAGE_FRAME_TIME_ID);
+		AverageReplicationTime = Schema_GetFloat(ComponentObject, SpatialConstants::SERVER_WORKER_AVERAGE_REPLICATION_TIME_ID);
+		RPCsPerSecond = Schema_GetFloat(ComponentObject, SpatialConstants::SERVER_WORKER_RPCS_PER_SECOND_ID);
+		MigrationsPerSecond = GetUint32ToFloatMapFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_MIGRATIONS_PER_SECOND_ID);
 	}
 
 	Worker_ComponentData CreateServerWorkerData()
@@ -51,6 +64,11 @@ struct ServerWorker : Component
 
 		AddStringToSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID, WorkerName);
 		Schema_AddBool(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID, bReadyToBeginPlay);
+		Schema_AddUint32(ComponentObject, SpatialConstants::SERVER_WORKER_AUTHORITATIVE_ACTOR_COUNT_ID, AuthoritativeActorCount);
+		Schema_AddFloat(ComponentObject, SpatialConstants::SERVER_WORKER_AVERAGE_FRAME_TIME_ID, AverageFrameTime);
+		Schema_AddFloat(ComponentObject, SpatialConstants::SERVER_WORKER_AVERAGE_REPLICATION_TIME_ID, AverageReplicationTime);
+		Schema_AddFloat(ComponentObject, SpatialConstants::SERVER_WORKER_RPCS_PER_SECOND_ID, RPCsPerSecond);
+		AddUint32ToFloatMapToSchema(ComponentObject, SpatialConstants::SERVER_WORKER_MIGRATIONS_PER_SECOND_ID, MigrationsPerSecond);
 
 		return Data;
 	}
@@ -74,6 +92,66 @@ struct ServerWorker : Component
 
 		WorkerName = GetStringFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_NAME_ID);
 		bReadyToBeginPlay = GetBoolFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_READY_TO_BEGIN_PLAY_ID);
+
+		if (Schema_GetUint32Count(ComponentObject, SpatialConstants::SERVER_WORKER_AUTHORITATIVE_ACTOR_COUNT_ID) > 0)
+		{
+			AuthoritativeActorCount = Schema_GetUint32(ComponentObject, SpatialConstants::SERVER_WORKER_AUTHORITATIVE_ACTOR_COUNT_ID);
+		}
+		if (Schema_GetFloatCount(ComponentObject, SpatialConstants::SERVER_WORKER_AVERAGE_FRAME_TIME_ID) > 0)
+		{
+			AverageFrameTime = Schema_GetFloat(ComponentObject, SpatialConstants::SERVER_WORKER_AVERAGE_FRAME_TIME_ID);
+		}
+		if (Schema_GetFloatCount(ComponentObject, SpatialConstants::SERVER_WORKER_AVERAGE_REPLICATION_TIME_ID) > 0)
+		{
+			AverageReplicationTime = Schema_GetFloat(ComponentObject, SpatialConstants::SERVER_WORKER_AVERAGE_REPLICATION_TIME_ID);
+		}
+		if (Schema_GetFloatCount(ComponentObject, SpatialConstants::SERVER_WORKER_RPCS_PER_SECOND_ID) > 0)
+		{
+			RPCsPerSecond = Schema_GetFloat(ComponentObject, SpatialConstants::SERVER_WORKER_RPCS_PER_SECOND_ID);
+		}
+
+		if (Schema_GetObjectCount(ComponentObject, SpatialConstants::SERVER_WORKER_MIGRATIONS_PER_SECOND_ID) > 0)
+		{
+			MigrationsPerSecond = GetUint32ToFloatMapFromSchema(ComponentObject, SpatialConstants::SERVER_WORKER_MIGRATIONS_PER_SECOND_ID);
+		}
+		else
+		{
+			uint32 ClearedFieldCount = Schema_GetComponentUpdateClearedFieldCount(Update.schema_type);
+			TArray<Schema_FieldId> ClearedFields;
+			ClearedFields.SetNumUninitialized(ClearedFieldCount);
+			Schema_GetComponentUpdateClearedFieldList(Update.schema_type, ClearedFields.GetData());
+			if (ClearedFields.Contains(SpatialConstants::SERVER_WORKER_MIGRATIONS_PER_SECOND_ID))
+			{
+				MigrationsPerSecond.Empty();
+			}
+		}
+	}
+
+	// Only contains the load fields, which are the ones a server worker updates periodically.
+	static Worker_ComponentUpdate CreateLoadReportUpdate(uint32 AuthoritativeActorCount, float AverageFrameTime, float AverageReplicationTime, float RPCsPerSecond,
+		const TMap<VirtualWorkerId, float>& MigrationsPerSecond)
+	{
+		Worker_ComponentUpdate Update = {};
+		Update.component_id = ComponentId;
+		Update.schema_type = Schema_CreateComponentUpdate();
+		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
+
+		Schema_AddUint32(ComponentObject, SpatialConstants::SERVER_WORKER_AUTHORITATIVE_ACTOR_COUNT_ID, AuthoritativeActorCount);
+		Schema_AddFloat(ComponentObject, SpatialConstants::SERVER_WORKER_AVERAGE_FRAME_TIME_ID, AverageFrameTime);
+		Schema_AddFloat(ComponentObject, SpatialConstants::SERVER_WORKER_AVERAGE_REPLICATION_TIME_ID, AverageReplicationTime);
+		Schema_AddFloat(ComponentObject, SpatialConstants::SERVER_WORKER_RPCS_PER_SECOND_ID, RPCsPerSecond);
+
+		// Map fields in updates replace the whole map, and an empty map has to be cleared explicitly.
+		if (MigrationsPerSecond.Num() > 0)
+		{
+			AddUint32ToFloatMapToSchema(ComponentObject, SpatialConstants::SERVER_WORKER_MIGRATIONS_PER_SECOND_ID, MigrationsPerSecond);
+		}
+		else
+		{
+			Schema_AddComponentUpdateClearedField(Update.schema_type, SpatialConstants::SERVER_WORKER_MIGRATIONS_PER_SECOND_ID);
+		}
+
+		return Update;
 	}
 
 	static Worker_CommandRequest CreateForwardPlayerSpawnRequest(Schema_CommandRequest* SchemaCommandRequest)
@@ -112,6 +190,11 @@ struct ServerWorker : Component
 
 	PhysicalWorkerName WorkerName;
 	bool bReadyToBeginPlay;
+	uint32 AuthoritativeActorCount;
+	float AverageFrameTime;
+	float AverageReplicationTime;
+	float RPCsPerSecond;
+	TMap<VirtualWorkerId, float> MigrationsPerSecond;
 };
 
 } // namespace SpatialGDK
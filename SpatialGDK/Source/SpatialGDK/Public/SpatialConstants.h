@@ -179,9 +179,18 @@ const Schema_FieldId AUTHORITY_INTENT_VIRTUAL_WORKER_ID					= 1;
 
 // VirtualWorkerTranslation Field IDs.
 const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_MAPPING_ID				= 1;
+const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_LAYOUT_ID				= 2;
+const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID		= 3;
+const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_LOADS_ID				= 4;
 const Schema_FieldId MAPPING_VIRTUAL_WORKER_ID							= 1;
 const Schema_FieldId MAPPING_PHYSICAL_WORKER_NAME						= 2;
 const Schema_FieldId MAPPING_SERVER_WORKER_ENTITY_ID					= 3;
+const Schema_FieldId VIRTUAL_WORKER_LOAD_VIRTUAL_WORKER_ID				= 1;
+const Schema_FieldId VIRTUAL_WORKER_LOAD_AUTHORITATIVE_ACTOR_COUNT_ID	= 2;
+const Schema_FieldId VIRTUAL_WORKER_LOAD_AVERAGE_FRAME_TIME_ID			= 3;
+const Schema_FieldId VIRTUAL_WORKER_LOAD_AVERAGE_REPLICATION_TIME_ID		= 4;
+const Schema_FieldId VIRTUAL_WORKER_LOAD_RPCS_PER_SECOND_ID				= 5;
+const Schema_FieldId VIRTUAL_WORKER_LOAD_MIGRATIONS_PER_SECOND_ID		= 6;
 const PhysicalWorkerName TRANSLATOR_UNSET_PHYSICAL_NAME = FString("UnsetWorkerName");
 
 // WorkerEntity Field IDs.
@@ -198,6 +207,11 @@ const Schema_FieldId SPATIAL_DEBUGGING_IS_LOCKED                         = 5;
 // ServerWorker Field IDs.
 const Schema_FieldId SERVER_WORKER_NAME_ID								 = 1;
 const Schema_FieldId SERVER_WORKER_READY_TO_BEGIN_PLAY_ID				 = 2;
+const Schema_FieldId SERVER_WORKER_AUTHORITATIVE_ACTOR_COUNT_ID			 = 3;
+const Schema_FieldId SERVER_WORKER_AVERAGE_FRAME_TIME_ID				 = 4;
+const Schema_FieldId SERVER_WORKER_AVERAGE_REPLICATION_TIME_ID			 = 5;
+const Schema_FieldId SERVER_WORKER_RPCS_PER_SECOND_ID					 = 6;
+const Schema_FieldId SERVER_WORKER_MIGRATIONS_PER_SECOND_ID				 = 7;
 const Schema_FieldId SERVER_WORKER_FORWARD_SPAWN_REQUEST_COMMAND_ID		 = 1;
 
 // SpawnPlayerRequest type IDs.
@@ -230,6 +244,8 @@ const float FIRST_COMMAND_RETRY_WAIT_SECONDS = 0.2f;
 const uint32 MAX_NUMBER_COMMAND_ATTEMPTS = 5u;
 const float FORWARD_PLAYER_SPAWN_COMMAND_WAIT_SECONDS = 0.2f;
 
+const float LATENCY_TRACE_EXPORTER_FLUSH_INTERVAL_SECONDS = 5.0f;
+
 const FName DefaultActorGroup = FName(TEXT("Default"));
 
 const VirtualWorkerId INVALID_VIRTUAL_WORKER_ID = 0;
@@ -270,6 +286,10 @@ const Worker_ComponentId MIN_EXTERNAL_SCHEMA_ID = 1000;
 const Worker_ComponentId MAX_EXTERNAL_SCHEMA_ID = 2000;
 
 const FString SPATIALOS_METRICS_DYNAMIC_FPS = TEXT("Dynamic.FPS");
+const FString SPATIALOS_METRICS_AUTHORITY_MIGRATIONS = TEXT("Dynamic.AuthorityMigrationsPerSecond");
+const FString SPATIALOS_METRICS_INTEREST_BUCKET_CHANGES = TEXT("Dynamic.InterestBucketChangesPerSecond");
+const FString SPATIALOS_METRICS_COALESCED_INTEREST_BUCKET_CHANGES = TEXT("Dynamic.CoalescedInterestBucketChangesPerSecond");
+const FString SPATIALOS_METRICS_DROPPED_INTEREST_BUCKET_CHANGES = TEXT("Dynamic.DroppedInterestBucketChangesPerSecond");
 
 // URL that can be used to reconnect using the command line arguments.
 const FString RECONNECT_USING_COMMANDLINE_ARGUMENTS = TEXT("0.0.0.0");
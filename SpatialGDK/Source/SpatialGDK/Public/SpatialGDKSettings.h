@@ -131,6 +131,18 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (DisplayName = "Only Replicate Net Relevant Actors"))
 	bool bUseIsActorRelevantForConnection;
 
+	/**
+	 * When enabled, servers evaluate the interest they sent for each player controller against their Actors, and Actors which no client is
+	 * interested in are only replicated every ReplicationIntervalOutsideClientInterest seconds. Not respected when using the Replication Graph.
+	 * Other server workers and the inspector see the state of these Actors with the same delay, so this is intended for single server configurations.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Replication")
+	bool bThrottleReplicationOutsideClientInterest;
+
+	/** Seconds between replications of Actors which no client is interested in, when bThrottleReplicationOutsideClientInterest is enabled. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (EditCondition = "bThrottleReplicationOutsideClientInterest", ClampMin = "0"))
+	float ReplicationIntervalOutsideClientInterest;
+
 	/**
 	* Specifies the rate, in number of times per second, at which server-worker instance updates are sent to and received from the SpatialOS Runtime.
 	* Default:1000/s
@@ -236,6 +248,18 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Logging", meta = (DisplayName = "Worker Log Level"))
 	TEnumAsByte<ESettingsWorkerLogVerbosity::Type> WorkerLogLevel;
 
+	/**
+	* The maximum rate, in bytes of UTF-8 text per second, at which worker logs are sent to SpatialOS. Logs over the budget are buffered,
+	* and identical buffered messages are merged into one message with a repeat count.
+	* Default: `0`, which means there is no limit.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Logging", meta = (DisplayName = "Worker log bytes per second"))
+	uint32 WorkerLogBytesPerSecond;
+
+	/** The maximum number of distinct worker log messages buffered while waiting to be sent to SpatialOS. Further messages are dropped. */
+	UPROPERTY(EditAnywhere, config, Category = "Logging", meta = (DisplayName = "Maximum buffered worker log messages", ClampMin = "1"))
+	uint32 MaxBufferedWorkerLogMessages;
+
 	UPROPERTY(EditAnywhere, config, Category = "Debug", meta = (MetaClass = "SpatialDebugger"))
 	TSubclassOf<ASpatialDebugger> SpatialDebugger;
 
@@ -247,6 +271,32 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Load Balancing", meta = (EditCondition = "bEnableUnrealLoadBalancer"))
 	FWorkerType LoadBalancingWorkerType;
 
+	/** EXPERIMENTAL: Minimum time, in seconds, that a worker keeps authority over an Actor it gained authority over before the load balancer can move it again. */
+	UPROPERTY(EditAnywhere, Config, Category = "Load Balancing", meta = (EditCondition = "bEnableUnrealLoadBalancer", ClampMin = "0"))
+	float MinimumAuthorityDwellTime;
+
+	/**
+	 * EXPERIMENTAL: How far ahead, in seconds, workers predict that an Actor will leave their area from its velocity. A predicted
+	 * migration is started early: the full handover state is sent and the authority intent is moved while this worker keeps
+	 * simulating the Actor, so the new worker takes over without a freeze. Requires a load balancing strategy that supports
+	 * location queries. 0 to disable.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Load Balancing", meta = (EditCondition = "bEnableUnrealLoadBalancer", ClampMin = "0"))
+	float HandoverPrefetchTime;
+
+	/**
+	 * EXPERIMENTAL: Interval, in seconds, at which server workers report their load (authoritative Actor count, frame time, replication
+	 * time and RPC rate) and the loads are published to every worker, where load balancing strategies can query them through
+	 * GetVirtualWorkerLoad. Strategies whose layout changes at runtime use their layout update interval instead, so loads
+	 * are always reported for them. Default: `0`, which disables reports for other strategies.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Load Balancing", meta = (EditCondition = "bEnableUnrealLoadBalancer", ClampMin = "0"))
+	float WorkerLoadReportInterval;
+
+	/** EXPERIMENTAL: Maximum number of EntityACL updates the load balancer sends per tick. Remaining updates are sent on later ticks. 0 for no limit. */
+	UPROPERTY(EditAnywhere, Config, Category = "Load Balancing", meta = (EditCondition = "bEnableUnrealLoadBalancer", ClampMin = "0"))
+	int32 MaxAclAssignmentsPerTick;
+
 	/** EXPERIMENTAL: Run SpatialWorkerConnection on Game Thread. */
 	UPROPERTY(Config)
 	bool bRunSpatialWorkerConnectionOnGameThread;
@@ -326,6 +376,60 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableNetCullDistanceFrequency"))
 	TArray<FDistanceFrequencyPair> InterestRangeFrequencyPairs;
 
+	/**
+	 * Enable for clients to only receive the Actor's own data component, and none of its subobjects' components, for Actors in the frequency
+	 * buckets at or below LowDetailInterestFrequency. The data components are those of the Actor classes with the bucket's net cull distance.
+	 * Requires result types. Actors whose NetCullDistanceSquared differs from their class default are received without data in these buckets.
+	 * Buckets whose net cull distance no loaded Actor class has keep the full client result type.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableNetCullDistanceFrequency"))
+	bool bEnableLowDetailDistantInterest;
+
+	/** Update frequency, in Hz, at or below which a frequency bucket only receives low detail components. */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableLowDetailDistantInterest", ClampMin = "0"))
+	float LowDetailInterestFrequency;
+
+	/**
+	 * Enable to shrink the higher frequency buckets at runtime when clients would receive more than ClientInterestBandwidthBudget,
+	 * and grow them back towards the configured ratios when they are under budget. The net cull distance itself is never changed.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableNetCullDistanceFrequency"))
+	bool bEnableDynamicNetCullDistanceFrequency;
+
+	/** Estimated replication bytes per second a client should receive from the Actors of a single server worker. 0 disables the budget. */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableDynamicNetCullDistanceFrequency", ClampMin = "0"))
+	float ClientInterestBandwidthBudget;
+
+	/**
+	 * Server load, as average busy frame time relative to the target frame time, above which the frequency buckets are shrunk. Only used with
+	 * bEnableClientQueriesOnServer, where servers receive updates through their clients' queries. 0 disables the budget.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableDynamicNetCullDistanceFrequency", ClampMin = "0"))
+	float NetCullDistanceFrequencyServerLoadBudget;
+
+	/** The smallest fraction of their configured ratio the frequency buckets can be shrunk to. */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableDynamicNetCullDistanceFrequency", ClampMin = "0.01", ClampMax = "1"))
+	float MinimumNetCullDistanceFrequencyScale;
+
+	/** Minimum time in seconds between changes to the frequency buckets. Every change sends an interest update for each client. */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableDynamicNetCullDistanceFrequency", ClampMin = "1"))
+	float NetCullDistanceFrequencyUpdateInterval;
+
+	/** How far over or under budget, as a fraction of the budget, the load must be before the frequency buckets are changed. */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (EditCondition = "bEnableDynamicNetCullDistanceFrequency", ClampMin = "0", ClampMax = "1"))
+	float NetCullDistanceFrequencyHysteresis;
+
+	/**
+	 * Time in seconds that interest updates are held after they are first requested, so that every request for the same Actor in that
+	 * window, for example while a client streams in levels, is sent as one update. 0 sends updates on the tick they are requested.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (ClampMin = "0"))
+	float InterestUpdateDebounceTime;
+
+	/** Maximum number of interest updates sent per tick, oldest request first. Remaining updates are sent on later ticks. 0 for no limit. */
+	UPROPERTY(EditAnywhere, Config, Category = "Interest", meta = (ClampMin = "0"))
+	int32 MaxInterestUpdatesPerTick;
+
 	/** Use TLS encryption for UnrealClient workers connection. May impact performance. */
 	UPROPERTY(EditAnywhere, Config, Category = "Connection")
 	bool bUseSecureClientConnection;
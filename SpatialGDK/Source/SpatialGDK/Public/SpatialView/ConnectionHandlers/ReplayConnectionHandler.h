@@ -0,0 +1,51 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+#include "SpatialView/ConnectionHandlers/AbstractConnectionHandler.h"
+#include "SpatialView/OpList/ReplayOpList.h"
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "Serialization/Archive.h"
+
+namespace SpatialGDK
+{
+
+// Feeds op lists from a recording made by OpListRecorder back as if they came from a deployment.
+// Outgoing messages are discarded, so this can be used to benchmark op processing without a runtime.
+class ReplayConnectionHandler : public AbstractConnectionHandler
+{
+public:
+	// PlaybackRate scales the recorded timing: 1 replays at the original speed, 2 at double speed and so on.
+	// A PlaybackRate of 0 ignores the recorded timing and releases one recorded op list per call to Advance.
+	ReplayConnectionHandler(TUniquePtr<FArchive> Reader, float PlaybackRate);
+
+	// Returns nullptr if the file could not be opened or is not a recording.
+	static TUniquePtr<ReplayConnectionHandler> CreateForFile(const FString& FilePath, float PlaybackRate);
+
+	bool IsValid() const;
+	// True once every recorded op list has been released.
+	bool IsFinished() const;
+
+	void Advance() override;
+	uint32 GetOpListCount() override;
+	TUniquePtr<AbstractOpList> GetNextOpList() override;
+	void SendMessages(TUniquePtr<MessagesToSend> Messages) override;
+
+private:
+	bool ReadNextFrame();
+
+	TUniquePtr<FArchive> Reader;
+	float PlaybackRate;
+	bool bValid = false;
+
+	double ReplayStartTime = 0.0;
+	bool bStarted = false;
+
+	// The next recorded frame, read ahead so we know when it is due.
+	double PendingTimestamp = 0.0;
+	TUniquePtr<ReplayOpList> PendingOpList;
+
+	TArray<TUniquePtr<AbstractOpList>> ReadyOpLists;
+};
+
+}  // namespace SpatialGDK
@@ -0,0 +1,77 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+#include "SpatialView/OpList/AbstractOpList.h"
+#include "Containers/Array.h"
+#include "Serialization/Archive.h"
+#include "Templates/UniquePtr.h"
+#include <improbable/c_schema.h>
+#include <improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// An op list read back from a recording. Owns all memory referenced by its ops, including strings and schema data.
+class ReplayOpList : public AbstractOpList
+{
+public:
+	ReplayOpList() = default;
+	~ReplayOpList();
+
+	ReplayOpList(const ReplayOpList&) = delete;
+	ReplayOpList& operator=(const ReplayOpList&) = delete;
+
+	virtual uint32 GetCount() const override
+	{
+		return Ops.Num();
+	}
+
+	virtual Worker_Op& operator[](uint32 Index) override
+	{
+		return Ops[Index];
+	}
+
+	virtual const Worker_Op& operator[](uint32 Index) const override
+	{
+		return Ops[Index];
+	}
+
+	// Exposes the ops as a Worker_OpList so they can be passed to code that consumes raw op lists, such as USpatialDispatcher.
+	// The returned op list is owned by this object and must not be passed to Worker_OpList_Destroy.
+	Worker_OpList* GetWorkerOpList();
+
+	// Reads one op list written by WriteToArchive. Returns nullptr if the archive is malformed.
+	static TUniquePtr<ReplayOpList> ReadFromArchive(FArchive& Ar);
+
+	static void WriteToArchive(FArchive& Ar, const AbstractOpList& OpList);
+	static void WriteToArchive(FArchive& Ar, const Worker_OpList& OpList);
+
+private:
+	bool ReadOp(FArchive& Ar, Worker_Op& OutOp);
+	const char* ReadString(FArchive& Ar);
+	bool ReadComponentData(FArchive& Ar, Worker_ComponentData& OutData);
+	bool ReadComponentUpdate(FArchive& Ar, Worker_ComponentUpdate& OutUpdate);
+
+	template <typename T>
+	T* AllocateArray(uint32 Num)
+	{
+		if (Num == 0)
+		{
+			return nullptr;
+		}
+		void* Memory = FMemory::MallocZeroed(sizeof(T) * Num, alignof(T));
+		Allocations.Add(Memory);
+		return static_cast<T*>(Memory);
+	}
+
+	TArray<Worker_Op> Ops;
+	Worker_OpList WorkerOpList;
+
+	TArray<void*> Allocations;
+	TArray<Schema_ComponentData*> OwnedComponentData;
+	TArray<Schema_ComponentUpdate*> OwnedComponentUpdates;
+	TArray<Schema_CommandRequest*> OwnedCommandRequests;
+	TArray<Schema_CommandResponse*> OwnedCommandResponses;
+};
+
+}  // namespace SpatialGDK
@@ -0,0 +1,45 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+#include "SpatialView/OpList/AbstractOpList.h"
+#include "Containers/UnrealString.h"
+#include "Serialization/Archive.h"
+#include "Templates/UniquePtr.h"
+#include <improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+namespace OpListRecording
+{
+// Recordings start with the magic number and version, followed by frames of
+// [double seconds since recording start][op list as written by ReplayOpList::WriteToArchive].
+constexpr uint32 FileMagic = 0x4C4F4753; // "SGOL"
+constexpr uint32 FileVersion = 1;
+} // namespace OpListRecording
+
+// Writes every op list it is given to an archive, along with the time it was received, so that it can be
+// replayed later with ReplayConnectionHandler.
+// Not thread safe: all calls must come from the thread that receives the op lists.
+class OpListRecorder
+{
+public:
+	explicit OpListRecorder(TUniquePtr<FArchive> Writer);
+	~OpListRecorder();
+
+	// Returns nullptr if the file could not be opened for writing.
+	static TUniquePtr<OpListRecorder> CreateForFile(const FString& FilePath);
+
+	void RecordOpList(const AbstractOpList& OpList);
+	void RecordOpList(const Worker_OpList& OpList);
+
+	void Flush();
+
+private:
+	void WriteFrameHeader();
+
+	TUniquePtr<FArchive> Writer;
+	double StartTime;
+};
+
+}  // namespace SpatialGDK
@@ -0,0 +1,233 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/NetworkGuid.h"
+
+#include "Schema/UnrealObjectRef.h"
+#include "SpatialConstants.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+// Open-addressing hash table with linear probing. Keys and values are stored inline in a single power-of-two sized
+// array, so a successful lookup usually touches one cache line and never allocates. Removal uses backward-shift
+// deletion, so no tombstones accumulate between rehashes.
+//
+// KeyFuncs must provide:
+//   static KeyType EmptyKey();
+//   static bool IsEmpty(const KeyType& Key);
+//   static bool Matches(const KeyType& A, const KeyType& B);
+//   static uint32 GetKeyHash(const KeyType& Key);
+// The empty key is reserved and can never be added to the table.
+template <typename KeyType, typename ValueType, typename KeyFuncs>
+class TFlatLookupTable
+{
+public:
+	ValueType* Find(const KeyType& Key)
+	{
+		const int32 Index = FindIndex(Key);
+		return Index != INDEX_NONE ? &Slots[Index].Value : nullptr;
+	}
+
+	const ValueType* Find(const KeyType& Key) const
+	{
+		const int32 Index = FindIndex(Key);
+		return Index != INDEX_NONE ? &Slots[Index].Value : nullptr;
+	}
+
+	bool Contains(const KeyType& Key) const
+	{
+		return FindIndex(Key) != INDEX_NONE;
+	}
+
+	// Adds the pair, or overwrites the value if the key is already present.
+	void Add(const KeyType& Key, const ValueType& Value)
+	{
+		check(!KeyFuncs::IsEmpty(Key));
+
+		// Keep the load factor at or below 1/2 so probe sequences stay short.
+		if ((NumElements + 1) * 2 > Slots.Num())
+		{
+			Rehash(FMath::Max(MinCapacity, Slots.Num() * 2));
+		}
+
+		const uint32 Mask = Slots.Num() - 1;
+		uint32 Index = KeyFuncs::GetKeyHash(Key) & Mask;
+		while (!KeyFuncs::IsEmpty(Slots[Index].Key))
+		{
+			if (KeyFuncs::Matches(Slots[Index].Key, Key))
+			{
+				Slots[Index].Value = Value;
+				return;
+			}
+			Index = (Index + 1) & Mask;
+		}
+
+		Slots[Index].Key = Key;
+		Slots[Index].Value = Value;
+		NumElements++;
+	}
+
+	bool Remove(const KeyType& Key)
+	{
+		int32 Index = FindIndex(Key);
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+
+		// Backward-shift deletion: pull later entries of the same probe run into the hole so that
+		// every remaining key is still reachable from its home slot without tombstones.
+		const uint32 Mask = Slots.Num() - 1;
+		uint32 Hole = Index;
+		uint32 Next = (Hole + 1) & Mask;
+		while (!KeyFuncs::IsEmpty(Slots[Next].Key))
+		{
+			const uint32 Home = KeyFuncs::GetKeyHash(Slots[Next].Key) & Mask;
+			// Move the entry if its home slot is not in the (cyclic) range (Hole, Next].
+			const bool bHomeBetween = (Hole <= Next) ? (Hole < Home && Home <= Next) : (Hole < Home || Home <= Next);
+			if (!bHomeBetween)
+			{
+				Slots[Hole] = Slots[Next];
+				Hole = Next;
+			}
+			Next = (Next + 1) & Mask;
+		}
+
+		Slots[Hole].Key = KeyFuncs::EmptyKey();
+		Slots[Hole].Value = ValueType();
+		NumElements--;
+		return true;
+	}
+
+	void Empty()
+	{
+		Slots.Empty();
+		NumElements = 0;
+	}
+
+	void Reserve(int32 Number)
+	{
+		const int32 RequiredCapacity = static_cast<int32>(FMath::RoundUpToPowerOfTwo(FMath::Max(MinCapacity, Number * 2)));
+		if (RequiredCapacity > Slots.Num())
+		{
+			Rehash(RequiredCapacity);
+		}
+	}
+
+	int32 Num() const
+	{
+		return NumElements;
+	}
+
+	template <typename FunctionType>
+	void ForEach(FunctionType&& Function) const
+	{
+		for (const FSlot& Slot : Slots)
+		{
+			if (!KeyFuncs::IsEmpty(Slot.Key))
+			{
+				Function(Slot.Key, Slot.Value);
+			}
+		}
+	}
+
+private:
+	static constexpr int32 MinCapacity = 64;
+
+	struct FSlot
+	{
+		KeyType Key = KeyFuncs::EmptyKey();
+		ValueType Value = ValueType();
+	};
+
+	int32 FindIndex(const KeyType& Key) const
+	{
+		if (NumElements == 0 || KeyFuncs::IsEmpty(Key))
+		{
+			return INDEX_NONE;
+		}
+
+		const uint32 Mask = Slots.Num() - 1;
+		uint32 Index = KeyFuncs::GetKeyHash(Key) & Mask;
+		while (!KeyFuncs::IsEmpty(Slots[Index].Key))
+		{
+			if (KeyFuncs::Matches(Slots[Index].Key, Key))
+			{
+				return Index;
+			}
+			Index = (Index + 1) & Mask;
+		}
+
+		return INDEX_NONE;
+	}
+
+	void Rehash(int32 NewCapacity)
+	{
+		check(FMath::IsPowerOfTwo(NewCapacity));
+
+		TArray<FSlot> OldSlots = MoveTemp(Slots);
+		Slots.SetNum(NewCapacity);
+		NumElements = 0;
+
+		for (const FSlot& Slot : OldSlots)
+		{
+			if (!KeyFuncs::IsEmpty(Slot.Key))
+			{
+				Add(Slot.Key, Slot.Value);
+			}
+		}
+	}
+
+	TArray<FSlot> Slots;
+	int32 NumElements = 0;
+};
+
+// An FUnrealObjectRef that consists only of an entity ID and an offset (no path, no outer).
+// These make up the bulk of object references read and written during replication.
+struct FEntityOffsetKey
+{
+	FEntityOffsetKey() = default;
+	FEntityOffsetKey(Worker_EntityId InEntityId, uint32 InOffset)
+		: EntityId(InEntityId)
+		, Offset(InOffset)
+	{}
+
+	Worker_EntityId EntityId = SpatialConstants::INVALID_ENTITY_ID;
+	uint32 Offset = 0;
+};
+
+struct FEntityOffsetKeyFuncs
+{
+	static FEntityOffsetKey EmptyKey() { return FEntityOffsetKey(); }
+	static bool IsEmpty(const FEntityOffsetKey& Key) { return Key.EntityId == SpatialConstants::INVALID_ENTITY_ID; }
+	static bool Matches(const FEntityOffsetKey& A, const FEntityOffsetKey& B) { return A.EntityId == B.EntityId && A.Offset == B.Offset; }
+	static uint32 GetKeyHash(const FEntityOffsetKey& Key)
+	{
+		// Entity IDs are allocated in dense ranges and offsets are small, so mix both before masking.
+		const uint64 Hash = (static_cast<uint64>(Key.EntityId) * 0x9E3779B97F4A7C15ull) ^ (static_cast<uint64>(Key.Offset) * 0xC2B2AE3D27D4EB4Full);
+		return static_cast<uint32>(Hash >> 32) ^ static_cast<uint32>(Hash);
+	}
+};
+
+struct FNetGUIDKeyFuncs
+{
+	static FNetworkGUID EmptyKey() { return FNetworkGUID(); }
+	static bool IsEmpty(const FNetworkGUID& Key) { return !Key.IsValid(); }
+	static bool Matches(const FNetworkGUID& A, const FNetworkGUID& B) { return A == B; }
+	static uint32 GetKeyHash(const FNetworkGUID& Key)
+	{
+		// NetGUIDs are sequential with the static bit in the lowest position; scramble them so runs don't cluster.
+		return static_cast<uint32>((static_cast<uint64>(GetTypeHash(Key)) * 0x9E3779B97F4A7C15ull) >> 32);
+	}
+};
+
+using FEntityOffsetToNetGUIDTable = TFlatLookupTable<FEntityOffsetKey, FNetworkGUID, FEntityOffsetKeyFuncs>;
+// Stores the whole ref rather than an FEntityOffsetKey, so that flags such as bNoLoadOnClient survive the round trip.
+using FNetGUIDToEntityRefTable = TFlatLookupTable<FNetworkGUID, FUnrealObjectRef, FNetGUIDKeyFuncs>;
+
+} // namespace SpatialGDK
@@ -0,0 +1,79 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Schema/Interest.h"
+#include "Schema/StandardLibrary.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+/**
+ * This class estimates what an Interest component costs, without a deployment. The queries are evaluated against a set of
+ * entities, for example read from a snapshot, with QueryConstraintEvaluator.
+ *
+ * An entity component is received at the highest frequency of all the matching queries whose result type contains it, so each
+ * component's bytes are counted once, in that frequency tier. Frequencies are in Hz, and 0 represents full frequency.
+ */
+
+DECLARE_LOG_CATEGORY_EXTERN(LogInterestCostAnalyser, Log, All);
+
+namespace SpatialGDK
+{
+
+struct FInterestCostEntity
+{
+	Worker_EntityId EntityId;
+	Coordinates Position;
+	// Serialized size, in bytes, of each component on the entity.
+	TMap<Worker_ComponentId, uint32> ComponentSizes;
+};
+
+struct FInterestCostQueryReport
+{
+	// The component the query was added to the Interest component for.
+	Worker_ComponentId ComponentId = SpatialConstants::INVALID_COMPONENT_ID;
+	float Frequency = 0.f;
+	int32 NumConstraints = 0;
+	int32 ConstraintDepth = 0;
+	int32 NumMatchingEntities = 0;
+	uint64 ResultBytes = 0;
+};
+
+struct FInterestCostTierReport
+{
+	float Frequency = 0.f;
+	int32 NumQueries = 0;
+	// Entities whose highest matching frequency is this tier.
+	int32 NumEntities = 0;
+	uint64 Bytes = 0;
+};
+
+struct FInterestCostReport
+{
+	TArray<FInterestCostQueryReport> Queries;
+	// Sorted from full frequency to the lowest frequency.
+	TArray<FInterestCostTierReport> Tiers;
+	int32 NumCheckedOutEntities = 0;
+	uint64 TotalBytes = 0;
+
+	FString ToString() const;
+};
+
+class SPATIALGDK_API InterestCostAnalyser
+{
+public:
+	// Relative constraints are centered on QueryOrigin, the position of the entity the Interest component is on.
+	static FInterestCostReport Analyse(const Interest& InInterest, const Coordinates& QueryOrigin, const TArray<FInterestCostEntity>& Entities);
+
+	// The number of constraints in the tree, and its depth. A single constraint has a depth of 1.
+	static void GetConstraintComplexity(const QueryConstraint& Constraint, int32& OutNumConstraints, int32& OutDepth);
+
+	static bool ReadSnapshot(const FString& SnapshotPath, TArray<FInterestCostEntity>& OutEntities);
+
+private:
+	static float GetQueryFrequency(const Query& InQuery);
+	// Whether a frequency, with 0 as full frequency, is higher than another.
+	static bool IsHigherFrequency(float Frequency, float OtherFrequency);
+};
+
+} // namespace SpatialGDK
@@ -24,6 +24,9 @@
  * will receive the full frequency. More queries will be added representing bigger circles with lower frequencies depending on the
  * configured frequency <-> distance ratio pairs, until the final circle will be at the configured NCD. This approach will generate
  * n queries per client in total where n is the number of configured frequency buckets.
+ *
+ * The frequency buckets can be shrunk at runtime by a frequency distance scale, which multiplies all the configured ratios except the
+ * outermost one, so that the NCD itself is unchanged but fewer entities are received at the higher frequencies.
  */
 
 DECLARE_LOG_CATEGORY_EXTERN(LogNetCullDistanceInterest, Log, All);
@@ -35,7 +38,19 @@ class SPATIALGDK_API NetCullDistanceInterest
 {
 public:
 
-	static FrequencyConstraints CreateCheckoutRadiusConstraints(USpatialClassInfoManager* InClassInfoManager);
+	static FrequencyConstraints CreateCheckoutRadiusConstraints(USpatialClassInfoManager* InClassInfoManager, float FrequencyDistanceScale = 1.f);
+
+	// The update frequency, in Hz, at which a client receives an entity at DistanceRatio of its NCD. Full frequency is returned as
+	// TNumericLimits<float>::Max(), and entities outside the NCD return 0.
+	static float GetFrequencyAtDistanceRatio(float DistanceRatio, float FrequencyDistanceScale);
+
+	// The next frequency distance scale, given the current one and how far over budget (Pressure > 1) or under budget (Pressure < 1)
+	// the interest is. Pressure within Hysteresis of 1 keeps the current scale. The result is clamped to [MinimumScale, 1].
+	static float ComputeFrequencyDistanceScale(float CurrentScale, float Pressure, float MinimumScale, float Hysteresis);
+
+	// The server load relative to LoadBudget, where load is the average time spent working per frame relative to the target frame
+	// time of MaxTickRate. IdleTime, spent waiting for the next frame when the server is under its tick rate, is not counted as work.
+	static float ComputeServerLoadPressure(float FrameTime, float IdleTime, uint32 NumFrames, float MaxTickRate, float LoadBudget);
 
 	// visible for testing
 	static TMap<float, TArray<UClass*>> DedupeDistancesAcrossActorTypes(const TMap<UClass*, float> ComponentSetToRadius);
@@ -44,7 +59,10 @@ private:
 
 	static FrequencyConstraints CreateLegacyNetCullDistanceConstraint(USpatialClassInfoManager* InClassInfoManager);
 	static FrequencyConstraints CreateNetCullDistanceConstraint(USpatialClassInfoManager* InClassInfoManager);
-	static FrequencyConstraints CreateNetCullDistanceConstraintWithFrequency(USpatialClassInfoManager* InClassInfoManager);
+	static FrequencyConstraints CreateNetCullDistanceConstraintWithFrequency(USpatialClassInfoManager* InClassInfoManager, float FrequencyDistanceScale);
+
+	static float GetOuterDistanceRatio();
+	static float ScaleDistanceRatio(float DistanceRatio, float OuterDistanceRatio, float FrequencyDistanceScale);
 
 	static QueryConstraint GetDefaultCheckoutRadiusConstraint();
 	static TMap<UClass*, float> GetActorTypeToRadius();
@@ -0,0 +1,40 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Schema/Interest.h"
+
+#include "Templates/Function.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+/**
+ * This class evaluates interest query constraints against a single entity, the way the SpatialOS runtime does when deciding
+ * what a worker checks out. It lets a server work out which of its entities are in a client's interest without asking the runtime.
+ *
+ * Relative constraints are centered on the query origin, which is the position of the entity the interest is on. Cylinders are
+ * infinitely tall along the vertical axis, and box edge lengths are the full size of the box along each axis.
+ */
+
+namespace SpatialGDK
+{
+
+class SPATIALGDK_API QueryConstraintEvaluator
+{
+public:
+	using FHasComponent = TFunctionRef<bool(Worker_ComponentId)>;
+
+	static bool IsEntityInConstraint(const QueryConstraint& Constraint, Worker_EntityId EntityId, const Coordinates& EntityPosition,
+		FHasComponent HasComponent, const Coordinates& QueryOrigin);
+
+	// Whether any of the queries added to Interest for ComponentId match the entity.
+	static bool IsEntityInInterest(const Interest& Interest, Worker_ComponentId ComponentId, Worker_EntityId EntityId, const Coordinates& EntityPosition,
+		FHasComponent HasComponent, const Coordinates& QueryOrigin);
+
+private:
+	static bool IsInSphere(const Coordinates& Center, double Radius, const Coordinates& Position);
+	static bool IsInCylinder(const Coordinates& Center, double Radius, const Coordinates& Position);
+	static bool IsInBox(const Coordinates& Center, const EdgeLength& Edges, const Coordinates& Position);
+};
+
+} // namespace SpatialGDK
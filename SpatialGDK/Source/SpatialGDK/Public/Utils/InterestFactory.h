@@ -22,14 +22,18 @@
  * The first is actor interest. The factory takes information about an actor (the object, info and corresponding entity ID)
  * and produces an interest data/update for that entity. This interest contains anything specific to that actor, such as self constraints
  * for servers and clients, and if the actor is a player controller, the client worker's interest is also built for that actor.
+ * Player controller interest is large and rebuilt whenever the client's loaded levels change, so the factory remembers the last
+ * interest sent for each player controller and skips updates which wouldn't change it.
  *
  * The other is server worker interest. Given a load balancing strategy, the factory will take the strategy's defined query constraint
  * and produce an interest component to exist on the server's worker entity. This interest component contains the primary interest query made
  * by that server worker.
  */
 
+class APawn;
 class UAbstractLBStrategy;
 class USpatialClassInfoManager;
+class USpatialNetConnection;
 class USpatialPackageMapClient;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogInterestFactory, Log, All);
@@ -42,11 +46,52 @@ class SPATIALGDK_API InterestFactory
 public:
 	InterestFactory(USpatialClassInfoManager* InClassInfoManager, USpatialPackageMapClient* InPackageMap);
 
-	Worker_ComponentData CreateInterestData(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const;
-	Worker_ComponentUpdate CreateInterestUpdate(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const;
+	Worker_ComponentData CreateInterestData(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId);
+
+	// Returns false if the interest is the same as the one last sent for this entity, in which case there is nothing to send.
+	bool CreateInterestUpdate(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId, Worker_ComponentUpdate& OutUpdate);
+
+	// Called when the last interest sent for an entity may no longer be current, because the entity was removed or
+	// another worker became authoritative over its interest. The next update is then sent even if it looks unchanged.
+	void ForgetSentInterest(const Worker_EntityId InEntityId);
+
+	// The last interest sent for a player controller this worker is authoritative over, or nullptr if none was sent.
+	const Interest* GetSentPlayerControllerInterest(const Worker_EntityId InEntityId) const { return SentPlayerControllerInterest.Find(InEntityId); }
 
 	Interest CreateServerWorkerInterest(const UAbstractLBStrategy* LBStrategy);
 
+	// Builds the interest an Actor would get, for offline analysis. Player controllers, which have no connection, are treated as
+	// having every level loaded, and references to other Actors are left out when there is no package map.
+	Interest CreateInterestForAnalysis(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) { return CreateInterest(InActor, InInfo, InEntityId, /* bAllLevelsLoaded */ true); }
+
+	// Called when an Actor's owner changes, which changes the Actor hierarchies user defined interest is collected from.
+	void OnActorOwnerChanged(const AActor* InActor);
+
+	// Called when the user defined interest of an Actor changes, because its ActorInterestComponent was added, removed or had its
+	// Queries changed. The constraints of every hierarchy the Actor is part of are collected again.
+	void OnUserDefinedInterestChanged(const AActor* InActor);
+
+	// The user defined constraints of an Actor's hierarchy, collected again only when the hierarchy or its user defined interest
+	// changes. Visible for testing.
+	const FrequencyToConstraintsMap& GetUserDefinedFrequencyToConstraintsMap(const AActor* InActor);
+
+	// The client result type for distant net cull distance buckets: the required components and the data components of the Actor
+	// classes whose net cull distance marker components appear in the constraint, without any subobject components. If no loaded
+	// Actor class has one of the marker components, the full client result type is returned. Visible for testing.
+	ResultType CreateClientLowDetailInterestResultType(const QueryConstraint& Constraint) const;
+	bool ShouldUseLowDetailResultType(const TSchemaOption<float>& Frequency) const;
+
+	// The constraint limiting a client's interest to the levels it has loaded. It is cached on the connection, which resets it
+	// when the client's level visibility changes. Visible for testing.
+	QueryConstraint GetCachedLevelConstraint(USpatialNetConnection& Connection) const;
+	// Builds the level constraint for a set of loaded level package names, without a cache. Visible for testing.
+	QueryConstraint CreateLevelConstraint(const TSet<FName>& LoadedLevels) const;
+
+	// Rebuilds the net cull distance queries with the frequency buckets scaled by InScale. Returns true if they changed, in which case
+	// the interest of every player controller needs to be updated.
+	bool SetNetCullDistanceFrequencyScale(float InScale);
+	float GetNetCullDistanceFrequencyScale() const { return NetCullDistanceFrequencyScale; }
+
 private:
 	// Shared constraints and result types are created at initialization and reused throughout the lifetime of the factory.
 	void CreateAndCacheInterestState();
@@ -57,11 +102,16 @@ private:
 	ResultType CreateClientAuthInterestResultType();
 	ResultType CreateServerNonAuthInterestResultType();
 	ResultType CreateServerAuthInterestResultType();
+	// The non-auth server result type restricted to some types of generated components, for load balancing interest regions.
+	ResultType CreateServerRegionInterestResultType(const TArray<ESchemaComponentType>& SchemaComponentTypes) const;
+	// Groups the data components of the loaded Actor classes by net cull distance marker component.
+	void CreateNetCullDistanceActorComponentIds();
 
-	Interest CreateInterest(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId) const;
+	// With bAllLevelsLoaded, player controller interest covers every level instead of the levels loaded by the client connection.
+	Interest CreateInterest(AActor* InActor, const FClassInfo& InInfo, const Worker_EntityId InEntityId, const bool bAllLevelsLoaded = false);
 
 	// Defined Constraint AND Level Constraint
-	void AddPlayerControllerActorInterest(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo) const;
+	void AddPlayerControllerActorInterest(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo, const bool bAllLevelsLoaded);
 	// Self interests require the entity ID to know which entity is "self". This would no longer be required if there was a first class self constraint.
 	// The components clients need to see on entities they are have authority over that they don't already see through authority.
 	void AddClientSelfInterest(Interest& OutInterest, const Worker_EntityId& EntityId) const;
@@ -71,10 +121,10 @@ private:
 	// Add the always relevant and the always interested query.
 	void AddAlwaysRelevantAndInterestedQuery(Interest& OutInterest, const AActor* InActor, const FClassInfo& InInfo, const QueryConstraint& LevelConstraint) const;
 
-	void AddUserDefinedQueries(Interest& OutInterest, const AActor* InActor, const QueryConstraint& LevelConstraint) const;
-	FrequencyToConstraintsMap GetUserDefinedFrequencyToConstraintsMap(const AActor* InActor) const;
-	void GetActorUserDefinedQueryConstraints(const AActor* InActor, FrequencyToConstraintsMap& OutFrequencyToConstraints, bool bRecurseChildren) const;
+	void AddUserDefinedQueries(Interest& OutInterest, const AActor* InActor, const QueryConstraint& LevelConstraint);
+	void GetActorUserDefinedQueryConstraints(const AActor* InActor, FrequencyToConstraintsMap& OutFrequencyToConstraints, TSet<const AActor*>& OutHierarchyActors, bool bRecurseChildren) const;
 
+	void CreateNetCullDistanceQueries();
 	void AddNetCullDistanceQueries(Interest& OutInterest, const QueryConstraint& LevelConstraint) const;
 
 	void AddComponentQueryPairToInterestComponent(Interest& OutInterest, const Worker_ComponentId ComponentId, const Query& QueryToAdd) const;
@@ -86,6 +136,7 @@ private:
 
 	// Only checkout entities that are in loaded sub-levels
 	QueryConstraint CreateLevelConstraints(const AActor* InActor) const;
+	QueryConstraint CreateAllLevelsConstraint() const;
 
 	void AddObjectToConstraint(UObjectPropertyBase* Property, uint8* Data, QueryConstraint& OutConstraint) const;
 
@@ -95,15 +146,35 @@ private:
 	USpatialClassInfoManager* ClassInfoManager;
 	USpatialPackageMapClient* PackageMap;
 
-	// The checkout radius constraint is built once for all actors in CreateCheckoutRadiusConstraint as it is equivalent for all actors.
-	// It is built once per net driver initialization.
-	FrequencyConstraints ClientCheckoutRadiusConstraint;
+	// The checkout radius queries and the always relevant constraint are the same for every player controller, so they are built
+	// once per net driver initialization. The client queries are completed with each connection's level constraint.
+	TArray<Query> ClientNetCullDistanceQueries;
+	TArray<Query> ServerNetCullDistanceQueries;
+	float NetCullDistanceFrequencyScale = 1.f;
+	QueryConstraint AlwaysRelevantConstraint;
 
 	// Cache the result types of queries.
 	ResultType ClientNonAuthInterestResultType;
 	ResultType ClientAuthInterestResultType;
 	ResultType ServerNonAuthInterestResultType;
 	ResultType ServerAuthInterestResultType;
+
+	// The data components of the Actor classes with each net cull distance, keyed by the net cull distance marker component.
+	TMap<Worker_ComponentId, TArray<Worker_ComponentId>> NetCullDistanceComponentToActorComponentIds;
+
+	// The last interest sent for each player controller this worker is authoritative over.
+	TMap<Worker_EntityId_Key, Interest> SentPlayerControllerInterest;
+
+	// User defined constraints collected from the ActorInterestComponents of an Actor's hierarchy. They are collected again when the
+	// hierarchy changes, or when a player controller possesses another pawn.
+	struct FCachedUserDefinedConstraints
+	{
+		TWeakObjectPtr<const APawn> Pawn;
+		// The Actors the constraints were collected from. These are only compared against, never dereferenced.
+		TSet<const AActor*> HierarchyActors;
+		FrequencyToConstraintsMap FrequencyToConstraints;
+	};
+	TMap<TWeakObjectPtr<const AActor>, FCachedUserDefinedConstraints> CachedUserDefinedConstraints;
 };
 
 } // namespace SpatialGDK
@@ -0,0 +1,65 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpatialCommonTypes.h"
+
+namespace SpatialGDK
+{
+
+// A span or key frame produced by USpatialLatencyTracer. Times are microseconds since the Unix epoch so that
+// spans from different workers line up, assuming worker clocks are synced.
+struct FLatencyTraceSpan
+{
+	FString Name;
+	TArray<uint8> TraceId;
+	TraceKey Key = InvalidTraceKey;
+	int64 StartTimeMicros = 0;
+	// Zero for key frames, which mark a single point in time.
+	int64 DurationMicros = 0;
+	bool bIsKeyFrame = false;
+};
+
+// Receives spans from USpatialLatencyTracer. Exporters are called with the tracer's mutex held, so they must not call back into it.
+class SPATIALGDK_API FLatencyTraceExporter
+{
+public:
+	virtual ~FLatencyTraceExporter() = default;
+
+	virtual void ExportSpan(const FLatencyTraceSpan& Span) = 0;
+	virtual void Flush() {}
+};
+
+// Writes spans to a local file in the Chrome trace event format, which can be opened in chrome://tracing or Perfetto.
+// Traces are sampled by trace ID, so every worker keeps or drops the same traces. At most MaxBufferedSpans are held
+// in memory; the buffer is written out whenever it fills up and when the exporter is flushed or destroyed.
+class SPATIALGDK_API FLocalFileLatencyTraceExporter : public FLatencyTraceExporter
+{
+public:
+	FLocalFileLatencyTraceExporter(TUniquePtr<FArchive> Writer, const FString& WorkerId, float SampleRate, int32 MaxBufferedSpans);
+	virtual ~FLocalFileLatencyTraceExporter();
+
+	// Returns nullptr if the file could not be opened for writing.
+	static TUniquePtr<FLocalFileLatencyTraceExporter> CreateForFile(const FString& FilePath, const FString& WorkerId, float SampleRate, int32 MaxBufferedSpans);
+
+	static bool IsTraceSampled(const TArray<uint8>& TraceId, float SampleRate);
+
+	virtual void ExportSpan(const FLatencyTraceSpan& Span) override;
+	virtual void Flush() override;
+
+	int32 GetNumSpansWritten() const { return NumSpansWritten; }
+
+private:
+	void WriteString(const FString& String);
+
+	TUniquePtr<FArchive> Writer;
+	float SampleRate;
+	int32 MaxBufferedSpans;
+
+	TArray<FLatencyTraceSpan> BufferedSpans;
+	int32 NumSpansWritten = 0;
+};
+
+} // namespace SpatialGDK
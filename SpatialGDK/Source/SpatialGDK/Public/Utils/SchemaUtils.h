@@ -200,6 +200,30 @@ inline StringToEntityMap GetStringToEntityMapFromSchema(Schema_Object* Object, S
 	return Map;
 }
 
+inline void AddUint32ToFloatMapToSchema(Schema_Object* Object, Schema_FieldId Id, const TMap<uint32, float>& Map)
+{
+	for (const auto& Pair : Map)
+	{
+		Schema_Object* PairObject = Schema_AddObject(Object, Id);
+		Schema_AddUint32(PairObject, SCHEMA_MAP_KEY_FIELD_ID, Pair.Key);
+		Schema_AddFloat(PairObject, SCHEMA_MAP_VALUE_FIELD_ID, Pair.Value);
+	}
+}
+
+inline TMap<uint32, float> GetUint32ToFloatMapFromSchema(Schema_Object* Object, Schema_FieldId Id)
+{
+	TMap<uint32, float> Map;
+
+	int32 MapCount = (int32)Schema_GetObjectCount(Object, Id);
+	for (int32 i = 0; i < MapCount; i++)
+	{
+		Schema_Object* PairObject = Schema_IndexObject(Object, Id, i);
+		Map.Add(Schema_GetUint32(PairObject, SCHEMA_MAP_KEY_FIELD_ID), Schema_GetFloat(PairObject, SCHEMA_MAP_VALUE_FIELD_ID));
+	}
+
+	return Map;
+}
+
 inline void AddRotatorToSchema(Schema_Object* Object, Schema_FieldId Id, FRotator Rotator)
 {
 	Schema_Object* RotatorObject = Schema_AddObject(Object, Id);
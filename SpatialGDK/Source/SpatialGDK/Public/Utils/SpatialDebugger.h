@@ -36,6 +36,7 @@ DECLARE_CYCLE_STAT(TEXT("DrawIcons"), STAT_DrawIcons, STATGROUP_SpatialDebugger)
 DECLARE_CYCLE_STAT(TEXT("DrawText"), STAT_DrawText, STATGROUP_SpatialDebugger);
 DECLARE_CYCLE_STAT(TEXT("BuildText"), STAT_BuildText, STATGROUP_SpatialDebugger);
 DECLARE_CYCLE_STAT(TEXT("SortingActors"), STAT_SortingActors, STATGROUP_SpatialDebugger);
+DECLARE_CYCLE_STAT(TEXT("DrawWorkerRegionLoads"), STAT_DrawWorkerRegionLoads, STATGROUP_SpatialDebugger);
 
 USTRUCT()
 struct FWorkerRegionInfo
@@ -47,6 +48,32 @@ struct FWorkerRegionInfo
 
 	UPROPERTY()
 	FBox2D Extents;
+
+	UPROPERTY()
+	uint32 VirtualWorkerId = 0;
+
+	// The load last reported by the worker, see FVirtualWorkerLoad. INDEX_NONE until the worker has reported.
+	UPROPERTY()
+	int32 AuthoritativeActorCount = INDEX_NONE;
+
+	UPROPERTY()
+	float AverageFrameTime = 0.f;
+};
+
+// Authority handed over from one worker region to another, as reported by the worker handing it over.
+USTRUCT()
+struct FWorkerRegionMigrationInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint32 FromVirtualWorkerId = 0;
+
+	UPROPERTY()
+	uint32 ToVirtualWorkerId = 0;
+
+	UPROPERTY()
+	float MigrationsPerSecond = 0.f;
 };
 
 UCLASS(SpatialType=(Singleton, NotPersistent), Blueprintable, NotPlaceable)
@@ -98,6 +125,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Visualization, meta = (ToolTip = "Show a transparent Worker Region cuboid representing the area of authority for each server worker"))
 	bool bShowWorkerRegions = false;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Visualization, meta = (ToolTip = "Color worker regions by load, and label them with their authoritative Actor count, frame time and the rate of migrations across each edge. Loads are only reported with a non-zero WorkerLoadReportInterval, or a strategy whose layout changes at runtime"))
+	bool bShowWorkerRegionLoad = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Visualization, meta = (ToolTip = "Authoritative Actor count at which a worker region is drawn fully hot. 0 scales the heat to the busiest region", ClampMin = "0"))
+	int32 WorkerRegionHeatActorCount = 0;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Visualization, meta = (ToolTip = "Texture to use for the Auth Icon"))
 	UTexture2D *AuthTexture;
 
@@ -128,6 +161,9 @@ public:
 	UFUNCTION()
 	virtual void OnRep_SetWorkerRegions();
 
+	UPROPERTY(Replicated)
+	TArray<FWorkerRegionMigrationInfo> WorkerRegionMigrations;
+
 	void ActorAuthorityChanged(const Worker_AuthorityChangeOp& AuthOp) const;
 	void ActorAuthorityIntentChanged(Worker_EntityId EntityId, VirtualWorkerId NewIntentVirtualWorkerId) const;
 
@@ -145,7 +181,14 @@ private:
 	void DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation, const Worker_EntityId EntityId, const FString& ActorName);
 	void DrawDebugLocalPlayer(UCanvas* Canvas);
 
+	void DrawWorkerRegionLoads(UCanvas* Canvas);
+	void DrawWorkerRegionLabel(UCanvas* Canvas, const FVector2D& Location, const FString& Label, const FColor& Color);
+
+	// Fills WorkerRegions and WorkerRegionMigrations from the load balancing strategy, on the server authoritative over the debugger.
+	void RefreshWorkerRegions();
+
 	void CreateWorkerRegions();
+	void UpdateWorkerRegions();
 	void DestroyWorkerRegions();
 
 	FColor GetTextColorForBackgroundColor(const FColor& BackgroundColor) const;
@@ -170,6 +213,9 @@ private:
 	// Mapping of the entities a client has checked out
 	TMap<Worker_EntityId_Key, TWeakObjectPtr<AActor>> EntityActorMapping;
 
+	// One per entry in WorkerRegions, while worker regions are shown.
+	TArray<TWeakObjectPtr<AWorkerRegion>> WorkerRegionActors;
+
 	FDelegateHandle DrawDebugDelegateHandle;
 	FDelegateHandle OnEntityAddedHandle;
 	FDelegateHandle OnEntityRemovedHandle;
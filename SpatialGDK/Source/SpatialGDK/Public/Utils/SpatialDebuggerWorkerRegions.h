@@ -0,0 +1,41 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "LoadBalancing/AbstractLBStrategy.h"
+#include "Utils/SpatialDebugger.h"
+
+/**
+ * The parts of the spatial debugger worker region overlay that don't depend on the world: which stats a region shows,
+ * how its load is coloured and how its labels read. ASpatialDebugger only spawns the region Actors and draws the results.
+ */
+
+namespace SpatialGDK
+{
+
+class SPATIALGDK_API SpatialDebuggerWorkerRegions
+{
+public:
+
+	// Copies the load reported by the region's virtual worker into the region, and adds a migration entry for every virtual
+	// worker it handed authority over to.
+	static void ApplyWorkerLoad(const FVirtualWorkerLoad& Load, FWorkerRegionInfo& OutWorkerRegionInfo, TArray<FWorkerRegionMigrationInfo>& OutWorkerRegionMigrations);
+
+	// The actor count at which a region is drawn fully red: ConfiguredHeatActorCount when it is positive, otherwise the busiest region's.
+	static int32 GetHeatActorCount(const TArray<FWorkerRegionInfo>& WorkerRegions, int32 ConfiguredHeatActorCount);
+
+	// The region's own colour, or a green to red heat colour for its load relative to HeatActorCount when the load is shown and known.
+	static FColor GetRegionColor(const FWorkerRegionInfo& WorkerRegionInfo, int32 HeatActorCount, bool bShowLoad);
+
+	static FString GetRegionLabel(const FWorkerRegionInfo& WorkerRegionInfo);
+	static FString GetMigrationLabel(const FWorkerRegionMigrationInfo& MigrationInfo);
+
+	// Where the migration label is drawn: the centre of the edge the two regions share, nudged towards the destination by Offset
+	// so that both directions of an edge are readable. Returns false if either region is missing.
+	static bool GetMigrationLabelLocation(const TArray<FWorkerRegionInfo>& WorkerRegions, const FWorkerRegionMigrationInfo& MigrationInfo, float Offset, FVector2D& OutLocation);
+
+	// The centre of the edge two touching regions share, or the midpoint between their centres if they don't touch.
+	static FVector2D GetSharedEdgeCenter(const FBox2D& A, const FBox2D& B);
+};
+
+} // namespace SpatialGDK
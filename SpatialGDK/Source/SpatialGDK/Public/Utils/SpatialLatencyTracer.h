@@ -8,6 +8,7 @@
 #include "Containers/Map.h"
 #include "Containers/StaticArray.h"
 #include "SpatialLatencyPayload.h"
+#include "Utils/LatencyTraceExporter.h"
 
 #if TRACE_LIB_ACTIVE
 #include "WorkerSDK/improbable/trace.h"
@@ -60,7 +61,8 @@ public:
 	// updates. This framework also assumes that the worker that calls BeginLatencyTrace will also eventually
 	// call EndLatencyTrace on the trace. This allows accurate end-to-end timings.
 	//
-	// These timings are logged to Google's Stackdriver (https://cloud.google.com/stackdriver/)
+	// These timings are logged to Google's Stackdriver (https://cloud.google.com/stackdriver/), and/or to a local
+	// file in the Chrome trace event format if `RegisterLocalFileExporter` has been called.
 	//
 	// Setup:
 	// 1. Run UnrealGDK SetupIncTraceLibs.bat to include latency tracking libraries.
@@ -70,7 +72,7 @@ public:
 	// 5. Set an environment variable GRPC_DEFAULT_SSL_ROOTS_FILE_PATH to your `roots.pem` gRPC path
 	//
 	// Usage:
-	// 1. Register your Google's project id with `RegisterProject`
+	// 1. Register your Google's project id with `RegisterProject`, or call `RegisterLocalFileExporter` to trace without cloud access.
 	// 2. Start a latency trace using `BeginLatencyTrace` and store the returned payload.
 	// 3. Pass this payload to a variant of `ContinueLatencyTrace` depending on how you want to continue the trace (rpc/property/tag)
 	//	- If continuing via an RPC include the FSpatialLatencyPayload as an RPC parameter
@@ -88,6 +90,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SpatialOS", meta = (WorldContext = "WorldContextObject"))
 	static void RegisterProject(UObject* WorldContextObject, const FString& ProjectId);
 
+	// Write this worker's spans to a local trace file (Chrome trace event format). An empty FilePath writes to
+	// Saved/Logs/LatencyTraces/<WorkerId>.json. SampleRate is the fraction of traces kept, and at most MaxBufferedSpans
+	// spans are held in memory before being written out.
+	UFUNCTION(BlueprintCallable, Category = "SpatialOS", meta = (WorldContext = "WorldContextObject"))
+	static bool RegisterLocalFileExporter(UObject* WorldContextObject, const FString& FilePath, float SampleRate = 1.0f, int32 MaxBufferedSpans = 4096);
+
 	// Set metadata string to be included in all span names. Resulting uploaded span names are of the format "USER_SPECIFIED_NAME (METADATA : WORKER_ID)".
 	UFUNCTION(BlueprintCallable, Category = "SpatialOS", meta = (WorldContext = "WorldContextObject"))
 	static bool SetTraceMetadata(UObject* WorldContextObject, const FString& NewTraceMetadata);
@@ -142,6 +150,9 @@ public:
 	void OnEnqueueMessage(const SpatialGDK::FOutgoingMessage*);
 	void OnDequeueMessage(const SpatialGDK::FOutgoingMessage*);
 
+	void AddExporter(TUniquePtr<SpatialGDK::FLatencyTraceExporter> Exporter);
+	void FlushExporters();
+
 private:
 
 	using ActorFuncKey = TPair<const AActor*, const UFunction*>;
@@ -160,9 +171,19 @@ private:
 	TraceKey GenerateNewTraceKey();
 	void ResolveKeyInLatencyPayload(FSpatialLatencyPayload& Payload);
 
-	void WriteKeyFrameToTrace(const TraceSpan* Trace, const FString& TraceDesc);
+	void WriteKeyFrameToTrace(const TraceKey Key, const TraceSpan* Trace, const FString& TraceDesc);
 	FString FormatMessage(const FString& Message, bool bIncludeMetadata = false) const;
 
+	// Bookkeeping for FLatencyTraceExporters, which need the start time and name of each trace when it ends.
+	void OnTraceStarted(const TraceKey Key, const FString& SpanMsg);
+	void OnTraceEnded(const TraceKey Key, const TraceSpan& Trace);
+
+	struct FActiveTraceInfo
+	{
+		FString Name;
+		int64 StartTimeMicros;
+	};
+
 	FString WorkerId;
 	FString TraceMetadata;
 
@@ -177,6 +198,9 @@ private:
 
 	TSet<TraceKey> RootTraces;
 
+	TMap<TraceKey, FActiveTraceInfo> ActiveTraceInfo;
+	TArray<TUniquePtr<SpatialGDK::FLatencyTraceExporter>> Exporters;
+
 public:
 
 #endif // TRACE_LIB_ACTIVE
@@ -15,6 +15,15 @@ class USpatialWorkerConnection;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialMetrics, Log, All);
 
+// The kind of outgoing traffic a bandwidth sample is attributed to.
+enum class EBandwidthCategory : uint8
+{
+	ComponentUpdate,
+	RPC,
+	EntityCreation,
+	Count
+};
+
 UCLASS()
 class SPATIALGDK_API USpatialMetrics : public UObject
 {
@@ -44,6 +53,39 @@ public:
 
 	void TrackSentRPC(UFunction* Function, ERPCType RPCType, int PayloadSize);
 
+	UFUNCTION(Exec)
+	void SpatialStartBandwidthMetrics();
+
+	UFUNCTION(Exec)
+	void SpatialStopBandwidthMetrics();
+
+	UFUNCTION(Exec)
+	void SpatialDumpBandwidthMetrics(const FString& FilePath);
+
+	bool IsBandwidthTrackingEnabled() const { return bBandwidthTrackingEnabled; }
+
+	// Attributes sent bytes to an object class or to a component. Callers should check IsBandwidthTrackingEnabled first,
+	// since measuring the size of outgoing schema data is not free.
+	void TrackSentClassBandwidth(const UClass* Class, EBandwidthCategory Category, uint32 Bytes);
+	void TrackSentComponentBandwidth(Worker_ComponentId ComponentId, EBandwidthCategory Category, uint32 Bytes);
+
+	// Counts and bytes recorded since bandwidth tracking started, or 0 if nothing was recorded.
+	int64 GetSentClassBandwidthCount(const UClass* Class, EBandwidthCategory Category) const;
+	int64 GetSentComponentBandwidthCount(Worker_ComponentId ComponentId, EBandwidthCategory Category) const;
+	int64 GetSentComponentBandwidthBytes(Worker_ComponentId ComponentId, EBandwidthCategory Category) const;
+
+	// Counts Actors this worker handed over to another worker. Reported as a rate with the worker metrics.
+	void TrackAuthorityMigration();
+	int64 GetTotalAuthorityMigrations() const { return TotalAuthorityMigrations; }
+
+	// Counts interest bucket changes requested by ownership changes, how many of them were sent after coalescing the changes
+	// to each entity, and how many were dropped because this worker lost authority over the entity. Requested changes that
+	// were neither sent nor dropped were coalesced. Reported as rates with the worker metrics.
+	void TrackInterestBucketChanges(int32 NumRequested, int32 NumSent, int32 NumDropped);
+	int64 GetTotalInterestBucketChangesSent() const { return TotalInterestBucketChangesSent; }
+	int64 GetTotalInterestBucketChangesCoalesced() const { return TotalInterestBucketChangesCoalesced; }
+	int64 GetTotalInterestBucketChangesDropped() const { return TotalInterestBucketChangesDropped; }
+
 	void HandleWorkerMetrics(Worker_Op* Op);
 
 	// The user can bind their own delegate to handle worker metrics.
@@ -71,6 +113,16 @@ private:
 	double AverageFPS;
 	double WorkerLoad;
 
+	int32 AuthorityMigrationsSinceLastReport;
+	int64 TotalAuthorityMigrations;
+
+	int32 InterestBucketChangesRequestedSinceLastReport;
+	int32 InterestBucketChangesSentSinceLastReport;
+	int32 InterestBucketChangesDroppedSinceLastReport;
+	int64 TotalInterestBucketChangesSent;
+	int64 TotalInterestBucketChangesCoalesced;
+	int64 TotalInterestBucketChangesDropped;
+
 	// RPC tracking is activated with "SpatialStartRPCMetrics" and stopped with "SpatialStopRPCMetrics"
 	// console command. It will record every sent RPC as well as the size of its payload, and then display
 	// tracked data upon stopping. Calling these console commands on the client will also start/stop RPC
@@ -82,8 +134,29 @@ private:
 		int Calls;
 		int TotalPayload;
 	};
-	TMap<FString, RPCStat> RecentRPCs;
+	TMap<TWeakObjectPtr<UFunction>, RPCStat> RecentRPCs;
 	bool bRPCTrackingEnabled;
 	float RPCTrackingStartTime;
+
+	// Bandwidth tracking is activated with "SpatialStartBandwidthMetrics" and stopped with "SpatialStopBandwidthMetrics".
+	// It attributes the bytes of every sent component update, RPC and entity creation request to the class of the
+	// replicated object and to each component ID involved. "SpatialDumpBandwidthMetrics [FilePath]" writes the data
+	// recorded so far to a CSV file. Unlike RPC tracking, this only applies to the worker the command is run on.
+	struct BandwidthStat
+	{
+		FString Name;
+		int64 Count[static_cast<int32>(EBandwidthCategory::Count)];
+		int64 Bytes[static_cast<int32>(EBandwidthCategory::Count)];
+
+		int64 GetTotalCount() const;
+		int64 GetTotalBytes() const;
+	};
+	TMap<TWeakObjectPtr<const UClass>, BandwidthStat> ClassBandwidth;
+	TMap<Worker_ComponentId, BandwidthStat> ComponentBandwidth;
+	bool bBandwidthTrackingEnabled;
+	double BandwidthTrackingStartTime;
+
+	void LogBandwidthStats(const TCHAR* Title, TArray<const BandwidthStat*>& Stats, double Interval) const;
+	static BandwidthStat CreateBandwidthStat(const FString& Name);
 };
 
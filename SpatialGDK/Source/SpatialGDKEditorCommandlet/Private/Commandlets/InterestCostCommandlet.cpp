@@ -0,0 +1,117 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "InterestCostCommandlet.h"
+#include "SpatialGDKEditorCommandletPrivate.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/SpatialClassInfoManager.h"
+#include "Utils/Interest/InterestCostAnalyser.h"
+#include "Utils/InterestFactory.h"
+#include "Utils/SpatialActorGroupManager.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+using namespace SpatialGDK;
+
+UInterestCostCommandlet::UInterestCostCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UInterestCostCommandlet::Main(const FString& Args)
+{
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Interest Cost Commandlet Started"));
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*Args, Tokens, Switches, Params);
+
+	const FString* ClassPath = Params.Find(TEXT("Class"));
+	const FString* SnapshotPath = Params.Find(TEXT("Snapshot"));
+	if (ClassPath == nullptr || SnapshotPath == nullptr)
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("Both -Class and -Snapshot must be specified."));
+		return 1;
+	}
+
+	FVector Origin = FVector::ZeroVector;
+	if (const FString* OriginString = Params.Find(TEXT("Origin")))
+	{
+		if (!Origin.InitFromString(*OriginString))
+		{
+			UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("Failed to parse origin %s, expected \"X=0 Y=0 Z=0\"."), **OriginString);
+			return 1;
+		}
+	}
+
+	UClass* ActorClass = LoadClass<AActor>(nullptr, **ClassPath);
+	if (ActorClass == nullptr)
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("Failed to load Actor class %s."), **ClassPath);
+		return 1;
+	}
+
+	TArray<FInterestCostEntity> Entities;
+	if (!InterestCostAnalyser::ReadSnapshot(*SnapshotPath, Entities))
+	{
+		return 1;
+	}
+
+	// The class info manager only needs a net driver to remap paths in PIE, and to quit when the schema database is missing.
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	SpatialActorGroupManager ActorGroupManager;
+	ActorGroupManager.Init();
+
+	USpatialClassInfoManager* ClassInfoManager = NewObject<USpatialClassInfoManager>();
+	if (!ClassInfoManager->TryInit(NetDriver, &ActorGroupManager))
+	{
+		return 1;
+	}
+
+	if (!ClassInfoManager->IsSupportedClass(ActorClass->GetPathName()))
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("%s is not in the schema database. Please generate schema first."), *ActorClass->GetPathName());
+		return 1;
+	}
+
+	// Spawn the Actor in a world of its own, so that components added in Blueprints, such as ActorInterestComponents, are created.
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, /* bInformEngineOfWorld */ false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	int32 Result = 1;
+	if (AActor* Actor = World->SpawnActor<AActor>(ActorClass, Origin, FRotator::ZeroRotator))
+	{
+		// Give the Actor an entity id that isn't in the snapshot, so that its self queries match nothing else.
+		Worker_EntityId AnalysedEntityId = 1;
+		for (const FInterestCostEntity& Entity : Entities)
+		{
+			AnalysedEntityId = FMath::Max(AnalysedEntityId, Entity.EntityId + 1);
+		}
+
+		InterestFactory Factory(ClassInfoManager, nullptr);
+		const Interest ActorInterest = Factory.CreateInterestForAnalysis(Actor, ClassInfoManager->GetOrCreateClassInfoByClass(ActorClass), AnalysedEntityId);
+		const FInterestCostReport Report = InterestCostAnalyser::Analyse(ActorInterest, Coordinates::FromFVector(Origin), Entities);
+
+		UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Interest cost of %s against %d entities of %s:\n%s"),
+			*ActorClass->GetName(), Entities.Num(), **SnapshotPath, *Report.ToString());
+		Result = 0;
+	}
+	else
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("Failed to spawn an instance of %s."), *ActorClass->GetName());
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(/* bInformEngineOfWorld */ false);
+
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Interest Cost Commandlet Complete"));
+
+	return Result;
+}
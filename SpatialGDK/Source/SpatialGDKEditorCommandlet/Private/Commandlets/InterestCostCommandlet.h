@@ -0,0 +1,25 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "InterestCostCommandlet.generated.h"
+
+/**
+ * Reports what the Interest component of an Actor class costs, without a deployment. The interest is built by the InterestFactory
+ * for an instance of the class spawned at Origin, and its queries are evaluated against the entities of a snapshot.
+ *
+ * Usage: -run=InterestCost -Class=/Game/Path/BP_PlayerController.BP_PlayerController_C -Snapshot=Path/To/default.snapshot [-Origin="X=0 Y=0 Z=0"]
+ */
+UCLASS()
+class UInterestCostCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UInterestCostCommandlet();
+
+public:
+	virtual int32 Main(const FString& Params) override;
+};
@@ -252,3 +252,147 @@ VIRTUALWORKERTRANSLATOR_TEST(GIVEN_have_a_valid_mapping_WHEN_try_to_change_local
 
 	return true;
 }
+
+VIRTUALWORKERTRANSLATOR_TEST(GIVEN_have_a_valid_mapping_WHEN_a_mapping_with_one_changed_entry_is_received_THEN_only_report_that_entry)
+{
+	ULBStrategyStub* LBStrategyStub = NewObject<ULBStrategyStub>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(LBStrategyStub, "ValidWorkerOne");
+
+	TArray<VirtualWorkerId> ReportedVirtualWorkerIds;
+	Translator->OnMappingChanged.AddLambda([&ReportedVirtualWorkerIds](const TArray<VirtualWorkerId>& ChangedVirtualWorkerIds)
+	{
+		ReportedVirtualWorkerIds.Append(ChangedVirtualWorkerIds);
+	});
+
+	// Create a valid initial mapping.
+	Schema_Object* FirstValidDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(FirstValidDataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(FirstValidDataObject, 2, "ValidWorkerTwo");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(FirstValidDataObject, 3, "ValidWorkerThree");
+	Schema_AddUint32(FirstValidDataObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID, 1);
+
+	Translator->ApplyVirtualWorkerManagerData(FirstValidDataObject);
+
+	TestEqual<int32>("Every entry of the first mapping is reported.", ReportedVirtualWorkerIds.Num(), 3);
+	ReportedVirtualWorkerIds.Reset();
+
+	// Virtual worker 2 moves to a new physical worker, and virtual worker 3 is removed.
+	Schema_Object* SecondValidDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(SecondValidDataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(SecondValidDataObject, 2, "ValidWorkerFour");
+	Schema_AddUint32(SecondValidDataObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID, 2);
+
+	Translator->ApplyVirtualWorkerManagerData(SecondValidDataObject);
+
+	TestEqual<int32>("Only the changed entries are reported.", ReportedVirtualWorkerIds.Num(), 2);
+	TestTrue("The changed entry is reported.", ReportedVirtualWorkerIds.Contains(2));
+	TestTrue("The removed entry is reported.", ReportedVirtualWorkerIds.Contains(3));
+	TestNull("There is no mapping for virtual worker 3", Translator->GetPhysicalWorkerForVirtualWorker(3));
+	TestEqual<uint32>("The mapping version is updated.", Translator->GetMappingVersion(), 2);
+
+	return true;
+}
+
+VIRTUALWORKERTRANSLATOR_TEST(GIVEN_have_a_versioned_mapping_WHEN_a_mapping_with_an_old_version_is_received_THEN_ignore_it)
+{
+	ULBStrategyStub* LBStrategyStub = NewObject<ULBStrategyStub>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(LBStrategyStub, "ValidWorkerOne");
+
+	Schema_Object* FirstValidDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(FirstValidDataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(FirstValidDataObject, 2, "ValidWorkerTwo");
+	Schema_AddUint32(FirstValidDataObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID, 2);
+
+	Translator->ApplyVirtualWorkerManagerData(FirstValidDataObject);
+
+	bool bMappingChangeReported = false;
+	Translator->OnMappingChanged.AddLambda([&bMappingChangeReported](const TArray<VirtualWorkerId>& ChangedVirtualWorkerIds)
+	{
+		bMappingChangeReported = true;
+	});
+
+	// An older mapping, as well as an update which leaves the mapping out and only carries the current version.
+	Schema_Object* OldDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(OldDataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(OldDataObject, 2, "ValidWorkerThree");
+	Schema_AddUint32(OldDataObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID, 1);
+
+	Schema_Object* LayoutOnlyDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	Schema_AddUint32(LayoutOnlyDataObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID, 2);
+
+	Translator->ApplyVirtualWorkerManagerData(OldDataObject);
+	Translator->ApplyVirtualWorkerManagerData(LayoutOnlyDataObject);
+
+	const PhysicalWorkerName* VirtualWorker2PhysicalName = Translator->GetPhysicalWorkerForVirtualWorker(2);
+	TestNotNull("There is a mapping for virtual worker 2", VirtualWorker2PhysicalName);
+	TestEqual<FString>("VirtualWorker 2 is still ValidWorkerTwo", *VirtualWorker2PhysicalName, "ValidWorkerTwo");
+	TestNotNull("There is still a mapping for virtual worker 1", Translator->GetPhysicalWorkerForVirtualWorker(1));
+	TestFalse("No mapping change is reported.", bMappingChangeReported);
+	TestEqual<uint32>("The mapping version is unchanged.", Translator->GetMappingVersion(), 2);
+
+	return true;
+}
+
+VIRTUALWORKERTRANSLATOR_TEST(GIVEN_an_invalid_versioned_mapping_was_received_WHEN_a_valid_mapping_with_the_same_version_is_received_THEN_apply_it)
+{
+	ULBStrategyStub* LBStrategyStub = NewObject<ULBStrategyStub>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(LBStrategyStub, "ValidWorkerOne");
+
+	// A mapping which doesn't contain the local worker is rejected as invalid.
+	Schema_Object* InvalidDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(InvalidDataObject, 2, "ValidWorkerTwo");
+	Schema_AddUint32(InvalidDataObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID, 1);
+
+	Translator->ApplyVirtualWorkerManagerData(InvalidDataObject);
+
+	TestEqual<uint32>("The version of the rejected mapping is not stored.", Translator->GetMappingVersion(), 0);
+	TestFalse("Translator without a valid mapping is not ready.", Translator->IsReady());
+
+	Schema_Object* ValidDataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(ValidDataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(ValidDataObject, 2, "ValidWorkerTwo");
+	Schema_AddUint32(ValidDataObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_MAPPING_VERSION_ID, 1);
+
+	Translator->ApplyVirtualWorkerManagerData(ValidDataObject);
+
+	TestEqual<VirtualWorkerId>("Local virtual worker ID is known.", Translator->GetLocalVirtualWorkerId(), 1);
+	TestTrue("Translator with a valid mapping is ready.", Translator->IsReady());
+	TestEqual<uint32>("The mapping version is stored once the mapping is applied.", Translator->GetMappingVersion(), 1);
+
+	return true;
+}
+
+VIRTUALWORKERTRANSLATOR_TEST(GIVEN_have_a_valid_mapping_WHEN_virtual_worker_loads_are_received_THEN_the_strategy_can_query_them)
+{
+	ULBStrategyStub* LBStrategyStub = NewObject<ULBStrategyStub>();
+	TUniquePtr<SpatialVirtualWorkerTranslator> Translator = MakeUnique<SpatialVirtualWorkerTranslator>(LBStrategyStub, "ValidWorkerOne");
+
+	Schema_Object* DataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, 1, "ValidWorkerOne");
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, 2, "ValidWorkerTwo");
+
+	Schema_Object* LoadObject = Schema_AddObject(DataObject, SpatialConstants::VIRTUAL_WORKER_TRANSLATION_LOADS_ID);
+	Schema_AddUint32(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_VIRTUAL_WORKER_ID, 2);
+	Schema_AddUint32(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_AUTHORITATIVE_ACTOR_COUNT_ID, 42);
+	Schema_AddFloat(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_AVERAGE_FRAME_TIME_ID, 0.05f);
+	Schema_AddFloat(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_AVERAGE_REPLICATION_TIME_ID, 0.01f);
+	Schema_AddFloat(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_RPCS_PER_SECOND_ID, 120.f);
+	SpatialGDK::AddUint32ToFloatMapToSchema(LoadObject, SpatialConstants::VIRTUAL_WORKER_LOAD_MIGRATIONS_PER_SECOND_ID, { { 1, 2.5f } });
+
+	Translator->ApplyVirtualWorkerManagerData(DataObject);
+
+	const FVirtualWorkerLoad* VirtualWorker2Load = LBStrategyStub->GetVirtualWorkerLoad(2);
+	TestNotNull("There is a load for virtual worker 2", VirtualWorker2Load);
+	if (VirtualWorker2Load != nullptr)
+	{
+		TestEqual<uint32>("The authoritative Actor count is reported.", VirtualWorker2Load->AuthoritativeActorCount, 42);
+		TestEqual<float>("The frame time is reported.", VirtualWorker2Load->AverageFrameTime, 0.05f);
+		TestEqual<float>("The replication time is reported.", VirtualWorker2Load->AverageReplicationTime, 0.01f);
+		TestEqual<float>("The RPC rate is reported.", VirtualWorker2Load->RPCsPerSecond, 120.f);
+		const float* MigrationsTo1 = VirtualWorker2Load->MigrationsPerSecond.Find(1);
+		TestTrue("The migration rate to virtual worker 1 is reported.", MigrationsTo1 != nullptr && *MigrationsTo1 == 2.5f);
+	}
+	TestNull("There is no load for virtual worker 1", LBStrategyStub->GetVirtualWorkerLoad(1));
+
+	return true;
+}
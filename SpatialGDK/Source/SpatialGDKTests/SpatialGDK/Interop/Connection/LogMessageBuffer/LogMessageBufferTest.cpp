@@ -0,0 +1,157 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/LogMessageBuffer.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+#define LOGMESSAGEBUFFER_TEST(TestName) \
+	GDK_TEST(Core, FLogMessageBuffer, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+	const FName TestLoggerName(TEXT("TestLogger"));
+
+	struct FSentLogMessage
+	{
+		uint8 Level;
+		FString Message;
+	};
+
+	TArray<FSentLogMessage> FlushBuffer(FLogMessageBuffer& Buffer, double CurrentTime)
+	{
+		TArray<FSentLogMessage> Sent;
+		Buffer.Flush(CurrentTime, [&Sent](uint8 Level, const FName& LoggerName, const FString& Message)
+		{
+			Sent.Add(FSentLogMessage{ Level, Message });
+		});
+		return Sent;
+	}
+} // anonymous namespace
+
+LOGMESSAGEBUFFER_TEST(GIVEN_repeated_identical_messages_WHEN_flushed_THEN_one_message_with_a_repeat_count_is_sent)
+{
+	// GIVEN
+	FLogMessageBuffer Buffer(0, 16);
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("Spam"));
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("Other"));
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("Spam"));
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("Spam"));
+
+	// WHEN
+	TArray<FSentLogMessage> Sent = FlushBuffer(Buffer, 0.0);
+
+	// THEN
+	TestTrue("Two messages were sent", Sent.Num() == 2);
+	TestTrue("Repeated message keeps its original position and reports its count", Sent.Num() == 2 && Sent[0].Message == TEXT("Spam (repeated 3 times)"));
+	TestTrue("Other message is sent unchanged", Sent.Num() == 2 && Sent[1].Message == TEXT("Other"));
+	TestTrue("Buffer is empty", Buffer.GetNumBufferedMessages() == 0);
+
+	return true;
+}
+
+LOGMESSAGEBUFFER_TEST(GIVEN_same_message_with_different_levels_WHEN_flushed_THEN_messages_are_not_merged)
+{
+	// GIVEN
+	FLogMessageBuffer Buffer(0, 16);
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("Message"));
+	Buffer.Add(WORKER_LOG_LEVEL_ERROR, TestLoggerName, TEXT("Message"));
+
+	// WHEN
+	TArray<FSentLogMessage> Sent = FlushBuffer(Buffer, 0.0);
+
+	// THEN
+	TestTrue("Both messages were sent", Sent.Num() == 2);
+	TestTrue("Levels are preserved", Sent.Num() == 2 && Sent[0].Level == WORKER_LOG_LEVEL_WARN && Sent[1].Level == WORKER_LOG_LEVEL_ERROR);
+
+	return true;
+}
+
+LOGMESSAGEBUFFER_TEST(GIVEN_same_message_interleaved_with_different_levels_and_loggers_WHEN_flushed_THEN_each_level_and_logger_is_merged_separately)
+{
+	// GIVEN
+	const FName OtherLoggerName(TEXT("OtherLogger"));
+
+	FLogMessageBuffer Buffer(0, 16);
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("Message"));
+	Buffer.Add(WORKER_LOG_LEVEL_ERROR, TestLoggerName, TEXT("Message"));
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, OtherLoggerName, TEXT("Message"));
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("Message"));
+	Buffer.Add(WORKER_LOG_LEVEL_ERROR, TestLoggerName, TEXT("Message"));
+
+	// WHEN
+	TArray<FSentLogMessage> Sent = FlushBuffer(Buffer, 0.0);
+
+	// THEN
+	TestTrue("One message was sent per level and logger", Sent.Num() == 3);
+	TestTrue("Warning is merged", Sent.Num() == 3 && Sent[0].Level == WORKER_LOG_LEVEL_WARN && Sent[0].Message == TEXT("Message (repeated 2 times)"));
+	TestTrue("Error is merged", Sent.Num() == 3 && Sent[1].Level == WORKER_LOG_LEVEL_ERROR && Sent[1].Message == TEXT("Message (repeated 2 times)"));
+	TestTrue("Warning from the other logger is not merged", Sent.Num() == 3 && Sent[2].Level == WORKER_LOG_LEVEL_WARN && Sent[2].Message == TEXT("Message"));
+
+	return true;
+}
+
+LOGMESSAGEBUFFER_TEST(GIVEN_messages_over_the_byte_budget_WHEN_flushed_THEN_remaining_messages_are_sent_as_budget_refills)
+{
+	// GIVEN
+	const uint32 BytesPerSecond = 20;
+	FLogMessageBuffer Buffer(BytesPerSecond, 16);
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("0123456789"));
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("abcdefghij"));
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("ABCDEFGHIJ"));
+
+	// WHEN
+	TArray<FSentLogMessage> FirstFlush = FlushBuffer(Buffer, 10.0);
+	TArray<FSentLogMessage> SecondFlush = FlushBuffer(Buffer, 10.1);
+	TArray<FSentLogMessage> ThirdFlush = FlushBuffer(Buffer, 10.6);
+
+	// THEN
+	TestTrue("First flush sends what fits in the budget", FirstFlush.Num() == 2);
+	TestTrue("Second flush has not refilled enough budget", SecondFlush.Num() == 0);
+	TestTrue("Third flush sends the remaining message", ThirdFlush.Num() == 1 && ThirdFlush[0].Message == TEXT("ABCDEFGHIJ"));
+
+	return true;
+}
+
+LOGMESSAGEBUFFER_TEST(GIVEN_messages_with_multibyte_characters_WHEN_flushed_THEN_budget_is_counted_in_utf8_bytes)
+{
+	// GIVEN
+	// Each character is two bytes in UTF-8, so the messages fit in the budget by character count but not by byte count.
+	const uint32 BytesPerSecond = 10;
+	FLogMessageBuffer Buffer(BytesPerSecond, 16);
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("\u00e4\u00e4\u00e4\u00e4"));
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("\u00f6\u00f6"));
+
+	// WHEN
+	TArray<FSentLogMessage> Sent = FlushBuffer(Buffer, 0.0);
+
+	// THEN
+	TestTrue("Only the message that fits in the budget in UTF-8 bytes is sent", Sent.Num() == 1);
+	TestTrue("The second message is still buffered", Buffer.GetNumBufferedMessages() == 1);
+
+	return true;
+}
+
+LOGMESSAGEBUFFER_TEST(GIVEN_full_buffer_WHEN_more_messages_are_added_THEN_they_are_dropped_and_reported)
+{
+	// GIVEN
+	FLogMessageBuffer Buffer(0, 2);
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("First"));
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("Second"));
+
+	// WHEN
+	Buffer.Add(WORKER_LOG_LEVEL_WARN, TestLoggerName, TEXT("Third"));
+	Buffer.Add(WORKER_LOG_LEVEL_FATAL, TestLoggerName, TEXT("Fatal"));
+	TArray<FSentLogMessage> Sent = FlushBuffer(Buffer, 0.0);
+
+	// THEN
+	TestTrue("One message was dropped", Buffer.GetNumDroppedMessages() == 1);
+	TestTrue("Buffered messages, the fatal message and a drop report were sent", Sent.Num() == 4);
+	TestTrue("Fatal message is kept", Sent.Num() == 4 && Sent[2].Message == TEXT("Fatal"));
+	TestTrue("Drop report is sent last", Sent.Num() == 4 && Sent[3].Level == WORKER_LOG_LEVEL_WARN && Sent[3].Message.Contains(TEXT("Dropped 1 log messages")));
+
+	return true;
+}
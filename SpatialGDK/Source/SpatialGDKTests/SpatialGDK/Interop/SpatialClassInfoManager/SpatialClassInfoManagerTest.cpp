@@ -0,0 +1,64 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/SpatialClassInfoManager.h"
+#include "SpatialConstants.h"
+#include "Utils/SchemaDatabase.h"
+
+#define SPATIALCLASSINFOMANAGER_TEST(TestName) \
+	GDK_TEST(Core, SpatialClassInfoManager, TestName)
+
+namespace
+{
+
+const TCHAR* const TestLevelPath = TEXT("/Game/Maps/TestSublevel");
+const TCHAR* const TestPIELevelPath = TEXT("/Game/Maps/UEDPIE_0_TestSublevel");
+constexpr Worker_ComponentId TestLevelComponentId = 10000;
+
+USpatialClassInfoManager* CreateClassInfoManagerWithLevelComponent()
+{
+	USpatialClassInfoManager* ClassInfoManager = NewObject<USpatialClassInfoManager>();
+	ClassInfoManager->SchemaDatabase = NewObject<USchemaDatabase>();
+	ClassInfoManager->SchemaDatabase->LevelPathToComponentId.Add(TestLevelPath, TestLevelComponentId);
+	return ClassInfoManager;
+}
+
+} // anonymous namespace
+
+SPATIALCLASSINFOMANAGER_TEST(GIVEN_level_names_with_and_without_PIE_prefix_WHEN_resolved_by_name_THEN_component_id_matches_the_level_path_lookup)
+{
+	// GIVEN
+	USpatialClassInfoManager* ClassInfoManager = CreateClassInfoManagerWithLevelComponent();
+
+	// WHEN
+	const Worker_ComponentId ComponentId = ClassInfoManager->GetComponentIdFromLevelName(FName(TestLevelPath));
+	const Worker_ComponentId PIEComponentId = ClassInfoManager->GetComponentIdFromLevelName(FName(TestPIELevelPath));
+	const Worker_ComponentId UnknownComponentId = ClassInfoManager->GetComponentIdFromLevelName(FName(TEXT("/Game/Maps/UnknownSublevel")));
+
+	// THEN
+	TestTrue("The level name resolves to the level's component", ComponentId == ClassInfoManager->GetComponentIdFromLevelPath(TestLevelPath));
+	TestTrue("The PIE level name resolves to the level's component", PIEComponentId == ClassInfoManager->GetComponentIdFromLevelPath(TestPIELevelPath));
+	TestTrue("The PIE level name resolves to the same component as the level name", PIEComponentId == TestLevelComponentId);
+	TestTrue("An unknown level name resolves to no component", UnknownComponentId == SpatialConstants::INVALID_COMPONENT_ID);
+
+	return true;
+}
+
+SPATIALCLASSINFOMANAGER_TEST(GIVEN_resolved_level_name_WHEN_resolved_again_THEN_cached_component_id_is_returned)
+{
+	// GIVEN
+	USpatialClassInfoManager* ClassInfoManager = CreateClassInfoManagerWithLevelComponent();
+	ClassInfoManager->GetComponentIdFromLevelName(FName(TestPIELevelPath));
+
+	// WHEN
+	// Without the schema database entry, only the cached name can still resolve to the level's component.
+	ClassInfoManager->SchemaDatabase->LevelPathToComponentId.Remove(TestLevelPath);
+	const Worker_ComponentId ComponentId = ClassInfoManager->GetComponentIdFromLevelName(FName(TestPIELevelPath));
+
+	// THEN
+	TestTrue("The cached component is returned", ComponentId == TestLevelComponentId);
+	TestTrue("The level path lookup no longer finds the component", ClassInfoManager->GetComponentIdFromLevelPath(TestPIELevelPath) == SpatialConstants::INVALID_COMPONENT_ID);
+
+	return true;
+}
@@ -0,0 +1,333 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/Connection/OutgoingMessages.h"
+#include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/SpatialSender.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "Tests/TestingComponentViewHelpers.h"
+#include "Utils/SpatialActorGroupManager.h"
+#include "Utils/SpatialMetrics.h"
+
+#include "GameFramework/Actor.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+#define SPATIALSENDER_TEST(TestName) \
+	GDK_TEST(Core, SpatialSender, TestName)
+
+namespace
+{
+
+constexpr Worker_EntityId TestEntityId = 1;
+constexpr Worker_ComponentId TestComponentId = 10000;
+
+constexpr Worker_ComponentId FirstInterestBucketComponentId = 10001;
+constexpr Worker_ComponentId SecondInterestBucketComponentId = 10002;
+constexpr Worker_ComponentId ThirdInterestBucketComponentId = 10003;
+
+struct FSentMessage
+{
+	SpatialGDK::EOutgoingMessageType Type;
+	Worker_EntityId EntityId;
+	Worker_ComponentId ComponentId;
+};
+
+// A sender on a net driver that isn't connected to SpatialOS. The messages the sender queues on the worker connection are recorded.
+class FSenderTestContext
+{
+public:
+	FSenderTestContext()
+	{
+		NetDriver = NewObject<USpatialNetDriver>();
+		NetDriver->Connection = NewObject<USpatialWorkerConnection>();
+		NetDriver->StaticComponentView = NewObject<USpatialStaticComponentView>();
+		NetDriver->SpatialMetrics = NewObject<USpatialMetrics>();
+		NetDriver->ActorGroupManager = &ActorGroupManager;
+
+		NetDriver->Connection->OnEnqueueMessage.AddRaw(this, &FSenderTestContext::OnEnqueueMessage);
+
+		Sender = NewObject<USpatialSender>();
+		Sender->Init(NetDriver, nullptr, nullptr);
+	}
+
+	FSenderTestContext(const FSenderTestContext&) = delete;
+	FSenderTestContext& operator=(const FSenderTestContext&) = delete;
+
+	void SetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Worker_Authority Authority)
+	{
+		Worker_AuthorityChangeOp AuthorityChangeOp{};
+		AuthorityChangeOp.entity_id = EntityId;
+		AuthorityChangeOp.component_id = ComponentId;
+		AuthorityChangeOp.authority = Authority;
+		NetDriver->StaticComponentView->OnAuthorityChange(AuthorityChangeOp);
+	}
+
+	// An entity this worker is authoritative over, which can have its interest bucket component changed.
+	void AddAuthoritativeEntity(Worker_EntityId EntityId)
+	{
+		TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*NetDriver->StaticComponentView, EntityId,
+			SpatialConstants::POSITION_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+		TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*NetDriver->StaticComponentView, EntityId,
+			SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	}
+
+	int32 CountSentMessages(SpatialGDK::EOutgoingMessageType Type, Worker_EntityId EntityId, Worker_ComponentId ComponentId) const
+	{
+		return SentMessages.FilterByPredicate([Type, EntityId, ComponentId](const FSentMessage& Message)
+		{
+			return Message.Type == Type && Message.EntityId == EntityId && Message.ComponentId == ComponentId;
+		}).Num();
+	}
+
+	USpatialNetDriver* NetDriver;
+	USpatialSender* Sender;
+	TArray<FSentMessage> SentMessages;
+
+private:
+	void OnEnqueueMessage(const SpatialGDK::FOutgoingMessage* Message)
+	{
+		switch (Message->Type)
+		{
+		case SpatialGDK::EOutgoingMessageType::ComponentUpdate:
+		{
+			const SpatialGDK::FComponentUpdate* ComponentUpdate = static_cast<const SpatialGDK::FComponentUpdate*>(Message);
+			SentMessages.Add(FSentMessage{ Message->Type, ComponentUpdate->EntityId, ComponentUpdate->Update.component_id });
+			break;
+		}
+		case SpatialGDK::EOutgoingMessageType::AddComponent:
+		{
+			const SpatialGDK::FAddComponent* AddComponent = static_cast<const SpatialGDK::FAddComponent*>(Message);
+			SentMessages.Add(FSentMessage{ Message->Type, AddComponent->EntityId, AddComponent->Data.component_id });
+			break;
+		}
+		case SpatialGDK::EOutgoingMessageType::RemoveComponent:
+		{
+			const SpatialGDK::FRemoveComponent* RemoveComponent = static_cast<const SpatialGDK::FRemoveComponent*>(Message);
+			SentMessages.Add(FSentMessage{ Message->Type, RemoveComponent->EntityId, RemoveComponent->ComponentId });
+			break;
+		}
+		default:
+			SentMessages.Add(FSentMessage{ Message->Type, SpatialConstants::INVALID_ENTITY_ID, SpatialConstants::INVALID_COMPONENT_ID });
+			break;
+		}
+	}
+
+	SpatialActorGroupManager ActorGroupManager;
+};
+
+FWorkerComponentUpdate CreateTestComponentUpdate()
+{
+	Worker_ComponentUpdate Update{};
+	Update.component_id = TestComponentId;
+	Update.schema_type = Schema_CreateComponentUpdate();
+	Schema_AddUint32(Schema_GetComponentUpdateFields(Update.schema_type), 1, 7);
+	return FWorkerComponentUpdate(Update);
+}
+
+} // anonymous namespace
+
+SPATIALSENDER_TEST(GIVEN_authority_over_component_WHEN_component_update_sent_THEN_update_is_sent_and_tracked)
+{
+	// GIVEN
+	FSenderTestContext Context;
+	Context.SetAuthority(TestEntityId, TestComponentId, WORKER_AUTHORITY_AUTHORITATIVE);
+	Context.NetDriver->SpatialMetrics->SpatialStartBandwidthMetrics();
+	AActor* Actor = NewObject<AActor>();
+
+	// WHEN
+	Context.Sender->SendOrQueueComponentUpdate(Actor, TestEntityId, CreateTestComponentUpdate());
+
+	// THEN
+	const USpatialMetrics* SpatialMetrics = Context.NetDriver->SpatialMetrics;
+	TestEqual("Update is sent", Context.CountSentMessages(SpatialGDK::EOutgoingMessageType::ComponentUpdate, TestEntityId, TestComponentId), 1);
+	TestTrue("Update is tracked for its component", SpatialMetrics->GetSentComponentBandwidthCount(TestComponentId, EBandwidthCategory::ComponentUpdate) == 1);
+	TestTrue("Update bytes are tracked for its component", SpatialMetrics->GetSentComponentBandwidthBytes(TestComponentId, EBandwidthCategory::ComponentUpdate) > 0);
+	TestTrue("Update is tracked for the object class", SpatialMetrics->GetSentClassBandwidthCount(Actor->GetClass(), EBandwidthCategory::ComponentUpdate) == 1);
+
+	return true;
+}
+
+SPATIALSENDER_TEST(GIVEN_no_authority_over_component_WHEN_component_update_sent_THEN_update_is_not_tracked_until_it_is_sent)
+{
+	// GIVEN
+	FSenderTestContext Context;
+	Context.SetAuthority(TestEntityId, TestComponentId, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	Context.NetDriver->SpatialMetrics->SpatialStartBandwidthMetrics();
+	AActor* Actor = NewObject<AActor>();
+
+	// WHEN
+	Context.Sender->SendOrQueueComponentUpdate(Actor, TestEntityId, CreateTestComponentUpdate());
+
+	// THEN
+	const USpatialMetrics* SpatialMetrics = Context.NetDriver->SpatialMetrics;
+	TestEqual("Update is not sent without authority", Context.CountSentMessages(SpatialGDK::EOutgoingMessageType::ComponentUpdate, TestEntityId, TestComponentId), 0);
+	TestTrue("Queued update is not tracked", SpatialMetrics->GetSentComponentBandwidthCount(TestComponentId, EBandwidthCategory::ComponentUpdate) == 0);
+
+	// WHEN
+	Context.SetAuthority(TestEntityId, TestComponentId, WORKER_AUTHORITY_AUTHORITATIVE);
+	Context.Sender->ProcessUpdatesQueuedUntilAuthority(TestEntityId, TestComponentId);
+
+	// THEN
+	TestEqual("Queued update is sent once authority is gained", Context.CountSentMessages(SpatialGDK::EOutgoingMessageType::ComponentUpdate, TestEntityId, TestComponentId), 1);
+	TestTrue("Queued update is tracked for its component once sent", SpatialMetrics->GetSentComponentBandwidthCount(TestComponentId, EBandwidthCategory::ComponentUpdate) == 1);
+	TestTrue("Queued update is tracked for the object class once sent", SpatialMetrics->GetSentClassBandwidthCount(Actor->GetClass(), EBandwidthCategory::ComponentUpdate) == 1);
+
+	return true;
+}
+
+SPATIALSENDER_TEST(GIVEN_several_interest_bucket_changes_in_a_frame_WHEN_processed_THEN_one_remove_and_one_add_are_sent)
+{
+	// GIVEN
+	FSenderTestContext Context;
+	Context.AddAuthoritativeEntity(TestEntityId);
+	Context.Sender->QueueInterestBucketComponentChange(TestEntityId, FirstInterestBucketComponentId, SecondInterestBucketComponentId);
+	Context.Sender->QueueInterestBucketComponentChange(TestEntityId, SecondInterestBucketComponentId, ThirdInterestBucketComponentId);
+
+	// WHEN
+	Context.Sender->ProcessInterestBucketComponentChanges();
+
+	// THEN
+	const USpatialMetrics* SpatialMetrics = Context.NetDriver->SpatialMetrics;
+	TestEqual("The original bucket is removed", Context.CountSentMessages(SpatialGDK::EOutgoingMessageType::RemoveComponent, TestEntityId, FirstInterestBucketComponentId), 1);
+	TestEqual("The final bucket is added", Context.CountSentMessages(SpatialGDK::EOutgoingMessageType::AddComponent, TestEntityId, ThirdInterestBucketComponentId), 1);
+	TestEqual("The intermediate bucket is neither added nor removed",
+		Context.CountSentMessages(SpatialGDK::EOutgoingMessageType::AddComponent, TestEntityId, SecondInterestBucketComponentId)
+		+ Context.CountSentMessages(SpatialGDK::EOutgoingMessageType::RemoveComponent, TestEntityId, SecondInterestBucketComponentId), 0);
+	TestTrue("One change is sent", SpatialMetrics->GetTotalInterestBucketChangesSent() == 1);
+	TestTrue("One change is coalesced", SpatialMetrics->GetTotalInterestBucketChangesCoalesced() == 1);
+	TestTrue("No change is dropped", SpatialMetrics->GetTotalInterestBucketChangesDropped() == 0);
+
+	// WHEN
+	const int32 NumSentMessages = Context.SentMessages.Num();
+	Context.Sender->ProcessInterestBucketComponentChanges();
+
+	// THEN
+	TestEqual("Processed changes are not sent again", Context.SentMessages.Num(), NumSentMessages);
+
+	return true;
+}
+
+SPATIALSENDER_TEST(GIVEN_interest_bucket_changes_back_to_the_original_bucket_WHEN_processed_THEN_nothing_is_sent)
+{
+	// GIVEN
+	FSenderTestContext Context;
+	Context.AddAuthoritativeEntity(TestEntityId);
+	Context.Sender->QueueInterestBucketComponentChange(TestEntityId, FirstInterestBucketComponentId, SecondInterestBucketComponentId);
+	Context.Sender->QueueInterestBucketComponentChange(TestEntityId, SecondInterestBucketComponentId, FirstInterestBucketComponentId);
+
+	// WHEN
+	Context.Sender->ProcessInterestBucketComponentChanges();
+
+	// THEN
+	const USpatialMetrics* SpatialMetrics = Context.NetDriver->SpatialMetrics;
+	TestEqual("Nothing is sent", Context.SentMessages.Num(), 0);
+	TestTrue("No change is sent", SpatialMetrics->GetTotalInterestBucketChangesSent() == 0);
+	TestTrue("Both changes are coalesced", SpatialMetrics->GetTotalInterestBucketChangesCoalesced() == 2);
+	TestTrue("No change is dropped", SpatialMetrics->GetTotalInterestBucketChangesDropped() == 0);
+
+	return true;
+}
+
+SPATIALSENDER_TEST(GIVEN_authority_lost_before_interest_bucket_changes_are_processed_WHEN_processed_THEN_changes_are_dropped)
+{
+	// GIVEN
+	constexpr Worker_EntityId OtherEntityId = TestEntityId + 1;
+
+	FSenderTestContext Context;
+	Context.AddAuthoritativeEntity(TestEntityId);
+	Context.AddAuthoritativeEntity(OtherEntityId);
+	Context.Sender->QueueInterestBucketComponentChange(TestEntityId, FirstInterestBucketComponentId, SecondInterestBucketComponentId);
+	Context.Sender->QueueInterestBucketComponentChange(TestEntityId, SecondInterestBucketComponentId, ThirdInterestBucketComponentId);
+	Context.Sender->QueueInterestBucketComponentChange(OtherEntityId, FirstInterestBucketComponentId, SecondInterestBucketComponentId);
+	Context.SetAuthority(TestEntityId, SpatialConstants::POSITION_COMPONENT_ID, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	// WHEN
+	Context.Sender->ProcessInterestBucketComponentChanges();
+
+	// THEN
+	const USpatialMetrics* SpatialMetrics = Context.NetDriver->SpatialMetrics;
+	TestEqual("Nothing is removed from the entity no longer authoritative", Context.CountSentMessages(SpatialGDK::EOutgoingMessageType::RemoveComponent, TestEntityId, FirstInterestBucketComponentId), 0);
+	TestEqual("Nothing is added to the entity no longer authoritative", Context.CountSentMessages(SpatialGDK::EOutgoingMessageType::AddComponent, TestEntityId, ThirdInterestBucketComponentId), 0);
+	TestEqual("The change to the authoritative entity is sent", Context.CountSentMessages(SpatialGDK::EOutgoingMessageType::AddComponent, OtherEntityId, SecondInterestBucketComponentId), 1);
+	TestTrue("One change is sent", SpatialMetrics->GetTotalInterestBucketChangesSent() == 1);
+	TestTrue("No change is coalesced", SpatialMetrics->GetTotalInterestBucketChangesCoalesced() == 0);
+	TestTrue("Both changes to the entity no longer authoritative are dropped", SpatialMetrics->GetTotalInterestBucketChangesDropped() == 2);
+
+	return true;
+}
+
+SPATIALSENDER_TEST(GIVEN_pending_interest_updates_WHEN_taken_within_the_debounce_time_THEN_they_stay_pending_until_it_has_passed)
+{
+	// GIVEN
+	AActor* Actor = NewObject<AActor>();
+	FPendingInterestUpdates PendingUpdates;
+	PendingUpdates.Add(TestEntityId, FPendingInterestUpdate{ Actor, 10.f });
+
+	// WHEN
+	const TArray<AActor*> EarlyUpdates = USpatialSender::TakeInterestUpdatesToSend(PendingUpdates, 10.5f, 1.f, 0);
+
+	// THEN
+	TestEqual("No update is sent within the debounce time", EarlyUpdates.Num(), 0);
+	TestTrue("The update stays pending", PendingUpdates.Contains(TestEntityId));
+
+	// WHEN
+	const TArray<AActor*> Updates = USpatialSender::TakeInterestUpdatesToSend(PendingUpdates, 11.f, 1.f, 0);
+
+	// THEN
+	TestTrue("The update is sent once the debounce time has passed", Updates.Num() == 1 && Updates[0] == Actor);
+	TestEqual("No update is pending", PendingUpdates.Num(), 0);
+
+	return true;
+}
+
+SPATIALSENDER_TEST(GIVEN_more_pending_interest_updates_than_the_budget_WHEN_taken_THEN_the_oldest_are_sent_first)
+{
+	// GIVEN
+	AActor* OldestActor = NewObject<AActor>();
+	AActor* OlderActor = NewObject<AActor>();
+	AActor* NewestActor = NewObject<AActor>();
+	FPendingInterestUpdates PendingUpdates;
+	PendingUpdates.Add(TestEntityId, FPendingInterestUpdate{ NewestActor, 3.f });
+	PendingUpdates.Add(TestEntityId + 1, FPendingInterestUpdate{ OldestActor, 1.f });
+	PendingUpdates.Add(TestEntityId + 2, FPendingInterestUpdate{ OlderActor, 2.f });
+
+	// WHEN
+	const TArray<AActor*> FirstUpdates = USpatialSender::TakeInterestUpdatesToSend(PendingUpdates, 5.f, 0.f, 2);
+
+	// THEN
+	TestEqual("The budget is respected", FirstUpdates.Num(), 2);
+	TestTrue("The oldest updates are sent", FirstUpdates.Contains(OldestActor) && FirstUpdates.Contains(OlderActor));
+	TestTrue("The newest update stays pending", PendingUpdates.Num() == 1 && PendingUpdates.Contains(TestEntityId));
+
+	// WHEN
+	const TArray<AActor*> SecondUpdates = USpatialSender::TakeInterestUpdatesToSend(PendingUpdates, 5.f, 0.f, 2);
+
+	// THEN
+	TestTrue("The deferred update is sent on the next tick", SecondUpdates.Num() == 1 && SecondUpdates[0] == NewestActor);
+
+	return true;
+}
+
+SPATIALSENDER_TEST(GIVEN_pending_interest_update_WHEN_authority_is_lost_before_it_is_taken_THEN_it_is_dropped)
+{
+	// GIVEN
+	AActor* Actor = NewObject<AActor>();
+	AActor* AuthoritativeActor = NewObject<AActor>();
+	FPendingInterestUpdates PendingUpdates;
+	PendingUpdates.Add(TestEntityId, FPendingInterestUpdate{ Actor, 1.f });
+	PendingUpdates.Add(TestEntityId + 1, FPendingInterestUpdate{ AuthoritativeActor, 1.f });
+
+	// WHEN
+	Actor->Role = ROLE_SimulatedProxy;
+	const TArray<AActor*> Updates = USpatialSender::TakeInterestUpdatesToSend(PendingUpdates, 5.f, 0.f, 0);
+
+	// THEN
+	TestTrue("Only the update of the authoritative Actor is sent", Updates.Num() == 1 && Updates[0] == AuthoritativeActor);
+	TestEqual("The update of the Actor no longer authoritative is not kept pending", PendingUpdates.Num(), 0);
+
+	return true;
+}
@@ -483,3 +483,143 @@ LOADBALANCEENFORCER_TEST(GIVEN_component_presence_component_removal_WHEN_request
 
 	return true;
 }
+
+LOADBALANCEENFORCER_TEST(GIVEN_more_requests_than_the_per_tick_limit_WHEN_processed_THEN_remaining_requests_are_carried_over_in_order)
+{
+	// GIVEN
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdOne, VirtualWorkerOne, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdTwo, VirtualWorkerTwo, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ValidWorkerOne, StaticComponentView, VirtualWorkerTranslator.Get());
+	LoadBalanceEnforcer->SetMaxAclAssignmentsPerTick(1);
+
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdOne);
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdTwo);
+
+	// WHEN
+	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> FirstRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+	const bool bSecondRequestCarriedOver = LoadBalanceEnforcer->AclAssignmentRequestIsQueued(EntityIdTwo);
+	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> SecondRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	// THEN
+	TestTrue("First tick processes the oldest request", FirstRequests.Num() == 1 && FirstRequests[0].EntityId == EntityIdOne);
+	TestTrue("Second request was carried over", bSecondRequestCarriedOver);
+	TestTrue("Second tick processes the carried over request", SecondRequests.Num() == 1 && SecondRequests[0].EntityId == EntityIdTwo);
+	TestTrue("Queue is empty", LoadBalanceEnforcer->GetNumQueuedAclAssignmentRequests() == 0);
+
+	return true;
+}
+
+LOADBALANCEENFORCER_TEST(GIVEN_dropped_request_WHEN_the_entity_is_queued_again_THEN_one_acl_assignment_request_is_returned_at_its_new_place)
+{
+	// GIVEN
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdOne, VirtualWorkerOne, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdTwo, VirtualWorkerTwo, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ValidWorkerOne, StaticComponentView, VirtualWorkerTranslator.Get());
+
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdOne);
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdTwo);
+
+	Worker_AuthorityChangeOp AuthOp;
+	AuthOp.entity_id = EntityIdOne;
+	AuthOp.authority = WORKER_AUTHORITY_NOT_AUTHORITATIVE;
+	AuthOp.component_id = SpatialConstants::ENTITY_ACL_COMPONENT_ID;
+	LoadBalanceEnforcer->OnAclAuthorityChanged(AuthOp);
+
+	// WHEN
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdOne);
+	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> ACLRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	// THEN
+	int32 NumEntityOneRequests = 0;
+	for (const SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest& Request : ACLRequests)
+	{
+		NumEntityOneRequests += Request.EntityId == EntityIdOne ? 1 : 0;
+	}
+	TestTrue("Both entities have a request", ACLRequests.Num() == 2);
+	TestTrue("The requeued entity has exactly one request", NumEntityOneRequests == 1);
+	TestTrue("The requeued entity is processed after the entity queued before it", ACLRequests.Num() == 2 && ACLRequests[1].EntityId == EntityIdOne);
+
+	return true;
+}
+
+LOADBALANCEENFORCER_TEST(GIVEN_processed_acl_requests_WHEN_the_mapping_of_one_virtual_worker_changes_THEN_only_entities_with_that_intent_are_queued)
+{
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdOne, VirtualWorkerOne, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdTwo, VirtualWorkerTwo, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ValidWorkerOne, StaticComponentView, VirtualWorkerTranslator.Get());
+	VirtualWorkerTranslator->OnMappingChanged.AddRaw(LoadBalanceEnforcer.Get(), &SpatialLoadBalanceEnforcer::OnVirtualWorkerMappingChanged);
+
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdOne);
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdTwo);
+	LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	// Virtual worker two is now simulated by a different physical worker.
+	Schema_Object* DataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, VirtualWorkerOne, ValidWorkerOne);
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, VirtualWorkerTwo, TEXT("ValidWorkerThree"));
+	VirtualWorkerTranslator->ApplyVirtualWorkerManagerData(DataObject);
+
+	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> ACLRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	bool bSuccess = true;
+	if (ACLRequests.Num() == 1)
+	{
+		bSuccess &= ACLRequests[0].EntityId == EntityIdTwo;
+		bSuccess &= ACLRequests[0].OwningWorkerId == TEXT("ValidWorkerThree");
+	}
+	else
+	{
+		bSuccess = false;
+	}
+
+	TestTrue("LoadBalanceEnforcer returned expected ACL assignment results", bSuccess);
+
+	return true;
+}
+
+LOADBALANCEENFORCER_TEST(GIVEN_processed_acl_requests_WHEN_a_mapped_virtual_worker_is_removed_THEN_no_acl_assignment_requests_are_queued)
+{
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator = CreateVirtualWorkerTranslator();
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdOne, VirtualWorkerOne, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	AddEntityToStaticComponentView(*StaticComponentView, EntityIdTwo, VirtualWorkerTwo, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(ValidWorkerOne, StaticComponentView, VirtualWorkerTranslator.Get());
+	VirtualWorkerTranslator->OnMappingChanged.AddRaw(LoadBalanceEnforcer.Get(), &SpatialLoadBalanceEnforcer::OnVirtualWorkerMappingChanged);
+
+	TArray<VirtualWorkerId> BroadcastVirtualWorkerIds;
+	VirtualWorkerTranslator->OnMappingChanged.AddLambda([&BroadcastVirtualWorkerIds](const TArray<VirtualWorkerId>& ChangedVirtualWorkerIds)
+	{
+		BroadcastVirtualWorkerIds.Append(ChangedVirtualWorkerIds);
+	});
+
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdOne);
+	LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(EntityIdTwo);
+	LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	// Virtual worker two is no longer mapped to a physical worker.
+	Schema_Object* DataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, VirtualWorkerOne, ValidWorkerOne);
+	VirtualWorkerTranslator->ApplyVirtualWorkerManagerData(DataObject);
+
+	TArray<SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest> ACLRequests = LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests();
+
+	TestTrue("The removed virtual worker is no longer mapped", VirtualWorkerTranslator->GetPhysicalWorkerForVirtualWorker(VirtualWorkerTwo) == nullptr);
+	TestFalse("The removed virtual worker is not broadcast", BroadcastVirtualWorkerIds.Contains(VirtualWorkerTwo));
+	TestEqual("No ACL assignment requests are queued", ACLRequests.Num(), 0);
+
+	return true;
+}
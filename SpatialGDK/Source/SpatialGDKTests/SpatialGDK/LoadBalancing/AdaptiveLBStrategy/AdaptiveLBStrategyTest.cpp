@@ -0,0 +1,272 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LoadBalancing/AdaptiveLBStrategy.h"
+#include "Schema/StandardLibrary.h"
+#include "SpatialConstants.h"
+#include "TestAdaptiveLBStrategy.h"
+
+#include "CoreMinimal.h"
+#include "Serialization/MemoryWriter.h"
+#include "Tests/TestDefinitions.h"
+
+#define ADAPTIVELBSTRATEGY_TEST(TestName) \
+	GDK_TEST(Core, UAdaptiveLBStrategy, TestName)
+
+namespace
+{
+
+// With 4 workers in a 10000x10000 world, the initial layout is one quadrant per worker:
+// 1: X < 0, Y < 0    2: X < 0, Y >= 0    3: X >= 0, Y < 0    4: X >= 0, Y >= 0
+UAdaptiveLBStrategy* CreateFourWorkerStrategy(float InterestBorder = 0.f)
+{
+	UAdaptiveLBStrategy* Strat = UTestAdaptiveLBStrategy::Create(4, 10000.f, 10000.f, 1000.f, InterestBorder);
+	Strat->Init();
+	return Strat;
+}
+
+TMap<VirtualWorkerId, FVirtualWorkerLoad> MakeLoads(const TArray<uint32>& ActorCounts)
+{
+	TMap<VirtualWorkerId, FVirtualWorkerLoad> Loads;
+	for (int32 i = 0; i < ActorCounts.Num(); i++)
+	{
+		FVirtualWorkerLoad& Load = Loads.Add(i + 1);
+		Load.AuthoritativeActorCount = ActorCounts[i];
+	}
+	return Loads;
+}
+
+// A two worker layout with a single split of the whole world.
+TArray<uint8> MakeTwoWorkerLayout(uint32 Version, uint8 SplitAxis, float SplitPosition)
+{
+	TArray<uint8> Layout;
+	FMemoryWriter Writer(Layout);
+
+	int32 NumNodes = 3;
+	uint8 bIsLeaf = 0;
+	Writer << Version << NumNodes << bIsLeaf << SplitAxis << SplitPosition;
+
+	bIsLeaf = 1;
+	for (uint32 WorkerId : { 1, 2 })
+	{
+		Writer << bIsLeaf << WorkerId;
+	}
+	return Layout;
+}
+
+} // anonymous namespace
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_four_workers_WHEN_initialized_THEN_each_quadrant_maps_to_a_different_worker)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = CreateFourWorkerStrategy();
+
+	// WHEN
+	const VirtualWorkerId BottomLeft = Strat->GetVirtualWorkerForLocation(FVector2D(-2500.f, -2500.f));
+	const VirtualWorkerId TopLeft = Strat->GetVirtualWorkerForLocation(FVector2D(-2500.f, 2500.f));
+	const VirtualWorkerId BottomRight = Strat->GetVirtualWorkerForLocation(FVector2D(2500.f, -2500.f));
+	const VirtualWorkerId TopRight = Strat->GetVirtualWorkerForLocation(FVector2D(2500.f, 2500.f));
+
+	// THEN
+	TestTrue("Bottom left quadrant belongs to worker 1", BottomLeft == 1);
+	TestTrue("Top left quadrant belongs to worker 2", TopLeft == 2);
+	TestTrue("Bottom right quadrant belongs to worker 3", BottomRight == 3);
+	TestTrue("Top right quadrant belongs to worker 4", TopRight == 4);
+	TestTrue("Points on a split belong to the upper side", Strat->GetVirtualWorkerForLocation(FVector2D(0.f, 0.f)) == 4);
+	TestTrue("Points outside the world belong to the nearest region", Strat->GetVirtualWorkerForLocation(FVector2D(-100000.f, 100000.f)) == 2);
+	TestTrue("Initial layout version is 0", Strat->GetLayoutVersion() == 0);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_balanced_loads_WHEN_layout_is_updated_THEN_layout_is_unchanged)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = CreateFourWorkerStrategy();
+
+	// WHEN
+	const bool bChanged = Strat->UpdateLayout(MakeLoads({ 10, 12, 9, 11 }));
+
+	// THEN
+	TestFalse("Layout did not change", bChanged);
+	TestTrue("Layout version is unchanged", Strat->GetLayoutVersion() == 0);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_missing_worker_load_WHEN_layout_is_updated_THEN_layout_is_unchanged)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = CreateFourWorkerStrategy();
+
+	// WHEN
+	const bool bChanged = Strat->UpdateLayout(MakeLoads({ 100, 1, 1 }));
+
+	// THEN
+	TestFalse("Layout did not change", bChanged);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_one_overloaded_worker_WHEN_layout_is_updated_THEN_its_region_is_split_with_a_worker_freed_by_a_merge)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = CreateFourWorkerStrategy();
+	bool bLayoutChangedBroadcast = false;
+	Strat->OnLayoutChanged.AddLambda([&bLayoutChangedBroadcast]() { bLayoutChangedBroadcast = true; });
+
+	// WHEN
+	const bool bChanged = Strat->UpdateLayout(MakeLoads({ 10, 1, 1, 1 }));
+
+	// THEN
+	TestTrue("Layout changed", bChanged);
+	TestTrue("Layout change was broadcast", bLayoutChangedBroadcast);
+	TestTrue("Layout version was incremented", Strat->GetLayoutVersion() == 1);
+
+	// Worker 1's quadrant is split along X, and worker 4 is freed by merging the right half into worker 3.
+	TestTrue("Worker 1 keeps the lower half of its region", Strat->GetVirtualWorkerForLocation(FVector2D(-4000.f, -2500.f)) == 1);
+	TestTrue("Worker 4 takes the upper half of worker 1's region", Strat->GetVirtualWorkerForLocation(FVector2D(-1000.f, -2500.f)) == 4);
+	TestTrue("Worker 2 is unchanged", Strat->GetVirtualWorkerForLocation(FVector2D(-2500.f, 2500.f)) == 2);
+	TestTrue("Worker 3 owns the bottom right", Strat->GetVirtualWorkerForLocation(FVector2D(2500.f, -2500.f)) == 3);
+	TestTrue("Worker 3 owns the top right", Strat->GetVirtualWorkerForLocation(FVector2D(2500.f, 2500.f)) == 3);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_overloaded_worker_with_a_small_region_WHEN_layout_is_updated_THEN_layout_is_unchanged)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = UTestAdaptiveLBStrategy::Create(4, 10000.f, 10000.f, 4000.f);
+	Strat->Init();
+
+	// WHEN
+	const bool bChanged = Strat->UpdateLayout(MakeLoads({ 10, 1, 1, 1 }));
+
+	// THEN
+	TestFalse("Layout did not change", bChanged);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_updated_layout_WHEN_written_and_applied_to_another_strategy_THEN_both_strategies_agree)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Source = CreateFourWorkerStrategy();
+	UAdaptiveLBStrategy* Target = CreateFourWorkerStrategy();
+	Source->UpdateLayout(MakeLoads({ 10, 1, 1, 1 }));
+
+	TArray<uint8> Layout;
+	Source->WriteLayout(Layout);
+
+	// WHEN
+	const bool bApplied = Target->ApplyLayout(Layout);
+
+	// THEN
+	TestTrue("Layout was applied", bApplied);
+	TestTrue("Layout versions match", Target->GetLayoutVersion() == Source->GetLayoutVersion());
+
+	const UAdaptiveLBStrategy::LBStrategyRegions SourceRegions = Source->GetLBStrategyRegions();
+	const UAdaptiveLBStrategy::LBStrategyRegions TargetRegions = Target->GetLBStrategyRegions();
+	TestTrue("Region counts match", SourceRegions.Num() == TargetRegions.Num());
+	for (int32 i = 0; i < SourceRegions.Num() && i < TargetRegions.Num(); i++)
+	{
+		TestTrue("Regions match", SourceRegions[i].Key == TargetRegions[i].Key && SourceRegions[i].Value == TargetRegions[i].Value);
+	}
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_applied_layout_WHEN_an_older_layout_is_applied_THEN_it_is_ignored)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Source = CreateFourWorkerStrategy();
+	UAdaptiveLBStrategy* Target = CreateFourWorkerStrategy();
+	Source->UpdateLayout(MakeLoads({ 10, 1, 1, 1 }));
+
+	TArray<uint8> NewLayout;
+	Source->WriteLayout(NewLayout);
+	Target->ApplyLayout(NewLayout);
+
+	TArray<uint8> OldLayout;
+	CreateFourWorkerStrategy()->WriteLayout(OldLayout);
+
+	// WHEN
+	const bool bApplied = Target->ApplyLayout(OldLayout);
+
+	// THEN
+	TestFalse("Old layout was not applied", bApplied);
+	TestTrue("Layout version is unchanged", Target->GetLayoutVersion() == 1);
+	TestTrue("Split region is kept", Target->GetVirtualWorkerForLocation(FVector2D(-1000.f, -2500.f)) == 4);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_invalid_layout_WHEN_applied_THEN_it_is_ignored)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = CreateFourWorkerStrategy();
+	UAdaptiveLBStrategy* TwoWorkerStrat = UTestAdaptiveLBStrategy::Create(2, 10000.f, 10000.f, 1000.f);
+	TwoWorkerStrat->Init();
+
+	TArray<uint8> Layout;
+	TwoWorkerStrat->WriteLayout(Layout);
+
+	// Bump the version so the layout is not rejected as old.
+	Layout[0] = 5;
+
+	// WHEN
+	const bool bApplied = Strat->ApplyLayout(Layout);
+
+	// THEN
+	TestFalse("Layout with the wrong number of workers was not applied", bApplied);
+	TestTrue("Layout version is unchanged", Strat->GetLayoutVersion() == 0);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_layout_with_a_split_on_or_outside_the_region_edge_WHEN_applied_THEN_it_is_ignored)
+{
+	// GIVEN
+	// The world spans -5000 to 5000 along both axes.
+	UAdaptiveLBStrategy* Strat = UTestAdaptiveLBStrategy::Create(2, 10000.f, 10000.f, 1000.f);
+	Strat->Init();
+
+	// WHEN
+	const bool bAppliedOnEdge = Strat->ApplyLayout(MakeTwoWorkerLayout(1, 0, 5000.f));
+	const bool bAppliedOutside = Strat->ApplyLayout(MakeTwoWorkerLayout(2, 1, -6000.f));
+	const bool bAppliedNaN = Strat->ApplyLayout(MakeTwoWorkerLayout(3, 0, NAN));
+
+	// THEN
+	TestFalse("Layout split on the edge of the world was not applied", bAppliedOnEdge);
+	TestFalse("Layout split outside the world was not applied", bAppliedOutside);
+	TestFalse("Layout split at NaN was not applied", bAppliedNaN);
+	TestTrue("Layout version is unchanged", Strat->GetLayoutVersion() == 0);
+
+	// WHEN
+	const bool bAppliedInside = Strat->ApplyLayout(MakeTwoWorkerLayout(4, 0, 1000.f));
+
+	// THEN
+	TestTrue("Layout split inside the world was applied", bAppliedInside);
+	TestTrue("Layout version is updated", Strat->GetLayoutVersion() == 4);
+
+	return true;
+}
+
+ADAPTIVELBSTRATEGY_TEST(GIVEN_updated_layout_WHEN_get_worker_interest_THEN_constraint_covers_the_new_region)
+{
+	// GIVEN
+	UAdaptiveLBStrategy* Strat = CreateFourWorkerStrategy();
+	Strat->SetLocalVirtualWorkerId(4);
+
+	// WHEN
+	Strat->UpdateLayout(MakeLoads({ 10, 1, 1, 1 }));
+	SpatialGDK::QueryConstraint StratConstraint = Strat->GetWorkerInterestQueryConstraint();
+
+	// THEN
+	// Worker 4 now owns X in [-2500, 0] and Y in [-5000, 0]. SpatialOS x is Unreal Y and SpatialOS z is Unreal X, in meters.
+	SpatialGDK::BoxConstraint Box = StratConstraint.BoxConstraint.GetValue();
+	TestEqual("Centre of the interest region is as expected", Box.Center, SpatialGDK::Coordinates{ -25.0, 0.0, -12.5 });
+	TestEqual("Edge length in x is as expected", Box.EdgeLength.X, 50.0);
+	TestEqual("Edge length in z is as expected", Box.EdgeLength.Z, 25.0);
+
+	return true;
+}
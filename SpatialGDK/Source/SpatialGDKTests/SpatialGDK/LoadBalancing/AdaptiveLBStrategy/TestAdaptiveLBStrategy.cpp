@@ -0,0 +1,18 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "TestAdaptiveLBStrategy.h"
+
+UAdaptiveLBStrategy* UTestAdaptiveLBStrategy::Create(uint32 InNumWorkers, float WorldWidth, float WorldHeight, float MinRegionSize, float InterestBorder)
+{
+	UTestAdaptiveLBStrategy* Strat = NewObject<UTestAdaptiveLBStrategy>();
+
+	Strat->NumWorkers = InNumWorkers;
+
+	Strat->WorldWidth = WorldWidth;
+	Strat->WorldHeight = WorldHeight;
+
+	Strat->MinRegionSize = MinRegionSize;
+	Strat->InterestBorder = InterestBorder;
+
+	return Strat;
+}
@@ -0,0 +1,20 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LoadBalancing/AdaptiveLBStrategy.h"
+#include "TestAdaptiveLBStrategy.generated.h"
+
+/**
+ * This class is for testing purposes only.
+ */
+UCLASS(HideDropdown)
+class SPATIALGDKTESTS_API UTestAdaptiveLBStrategy : public UAdaptiveLBStrategy
+{
+	GENERATED_BODY()
+
+public:
+
+	static UAdaptiveLBStrategy* Create(uint32 NumWorkers, float WorldWidth, float WorldHeight, float MinRegionSize, float InterestBorder = 0.0f);
+};
@@ -10,13 +10,18 @@
 #include "Engine/World.h"
 #include "GameFramework/DefaultPawn.h"
 #include "GameFramework/GameStateBase.h"
+#include "GameFramework/PawnMovementComponent.h"
 #include "Tests/AutomationCommon.h"
 #include "Tests/AutomationEditorCommon.h"
 #include "Tests/TestDefinitions.h"
 
+#include <cmath>
+
 #define GRIDBASEDLBSTRATEGY_TEST(TestName) \
 	GDK_TEST(Core, UGridBasedLBStrategy, TestName)
 
+DEFINE_LOG_CATEGORY_STATIC(LogGridBasedLBStrategyTest, Log, All);
+
 // Test Globals
 namespace
 {
@@ -65,6 +70,17 @@ bool FCreateStrategy::Update()
 	return true;
 }
 
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FCreateTwoRowStrategyWithHysteresis, float, AuthorityHysteresisBand, uint32, LocalWorkerId);
+bool FCreateTwoRowStrategyWithHysteresis::Update()
+{
+	// Worker 1 owns X < 0 and worker 2 owns X >= 0.
+	Strat = UTestGridBasedLBStrategy::Create(2, 1, 10000.f, 10000.f, 0.f, AuthorityHysteresisBand);
+	Strat->Init();
+	Strat->SetLocalVirtualWorkerId(LocalWorkerId);
+
+	return true;
+}
+
 DEFINE_LATENT_AUTOMATION_COMMAND(FWaitForWorld);
 bool FWaitForWorld::Update()
 {
@@ -119,6 +135,30 @@ bool FCheckShouldRelinquishAuthority::Update()
 	return true;
 }
 
+DEFINE_LATENT_AUTOMATION_COMMAND_THREE_PARAMETER(FCheckShouldRelinquishAuthorityWithHysteresis, FAutomationTestBase*, Test, FName, Handle, bool, bExpected);
+bool FCheckShouldRelinquishAuthorityWithHysteresis::Update()
+{
+	bool bActual = Strat->ShouldRelinquishAuthority(*TestActors[Handle]);
+
+	Test->TestEqual(FString::Printf(TEXT("Should Relinquish Authority With Hysteresis. Actual: %d, Expected: %d"), bActual, bExpected), bActual, bExpected);
+
+	return true;
+}
+
+// Sets the velocity and checks the prediction in the same frame, since the pawn's movement component decelerates it every tick.
+DEFINE_LATENT_AUTOMATION_COMMAND_FIVE_PARAMETER(FCheckPredictAuthority, FAutomationTestBase*, Test, FName, Handle, FVector, Velocity, float, LookaheadTime, uint32, ExpectedVirtualWorker);
+bool FCheckPredictAuthority::Update()
+{
+	APawn* TestPawn = CastChecked<APawn>(TestActors[Handle]);
+	TestPawn->GetMovementComponent()->Velocity = Velocity;
+
+	uint32 Actual = Strat->PredictAuthority(*TestPawn, LookaheadTime);
+
+	Test->TestEqual(FString::Printf(TEXT("Predict Authority. Actual: %d, Expected: %d"), Actual, ExpectedVirtualWorker), Actual, ExpectedVirtualWorker);
+
+	return true;
+}
+
 DEFINE_LATENT_AUTOMATION_COMMAND_THREE_PARAMETER(FCheckWhoShouldHaveAuthority, FAutomationTestBase*, Test, FName, Handle, uint32, ExpectedVirtualWorker);
 bool FCheckWhoShouldHaveAuthority::Update()
 {
@@ -150,6 +190,28 @@ bool FCheckVirtualWorkersDiffer::Update()
 	return true;
 }
 
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FCheckBatchedWhoShouldHaveAuthority, FAutomationTestBase*, Test, TArray<FName>, Handles);
+bool FCheckBatchedWhoShouldHaveAuthority::Update()
+{
+	TArray<const AActor*> Actors;
+	for (const FName& Handle : Handles)
+	{
+		Actors.Add(TestActors[Handle]);
+	}
+
+	TArray<VirtualWorkerId> BatchedVirtualWorkerIds;
+	Strat->WhoShouldHaveAuthorityForActors(Actors, BatchedVirtualWorkerIds);
+
+	Test->TestEqual(TEXT("Batched result has one entry per Actor"), BatchedVirtualWorkerIds.Num(), Actors.Num());
+	for (int i = 0; i < Actors.Num() && i < BatchedVirtualWorkerIds.Num(); i++)
+	{
+		const VirtualWorkerId Expected = Strat->WhoShouldHaveAuthority(*Actors[i]);
+		Test->TestEqual(FString::Printf(TEXT("Batched Who Should Have Authority for %s"), *Handles[i].ToString()), BatchedVirtualWorkerIds[i], Expected);
+	}
+
+	return true;
+}
+
 DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FCheckVirtualWorkersMatch, FAutomationTestBase*, Test, TArray<FName>, Handles);
 bool FCheckVirtualWorkersMatch::Update()
 {
@@ -232,6 +294,59 @@ GRIDBASEDLBSTRATEGY_TEST(GIVEN_four_cells_WHEN_get_worker_interest_for_virtual_w
 	return true;
 }
 
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_no_border_limits_WHEN_get_worker_interest_regions_THEN_returns_single_full_region)
+{
+	Strat = UTestGridBasedLBStrategy::Create(2, 2, 10000.f, 10000.f, 1000.0f, 200.0f);
+	Strat->Init();
+	Strat->SetLocalVirtualWorkerId(4);
+
+	TArray<FWorkerInterestRegion> Regions = Strat->GetWorkerInterestRegions();
+
+	TestEqual("Number of regions", Regions.Num(), 1);
+	TestTrue("Region is checked out in full", Regions[0].IsFullInterest());
+	TestTrue("Region matches the interest constraint", Regions[0].Constraint == Strat->GetWorkerInterestQueryConstraint());
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_border_limits_WHEN_get_worker_interest_regions_THEN_returns_full_inner_region_and_limited_border_strips)
+{
+	Strat = UTestGridBasedLBStrategy::Create(2, 2, 10000.f, 10000.f, 1000.0f, 200.0f, 2.0f, true);
+	Strat->Init();
+
+	// Take the top right corner, as then all our testing numbers can be positive.
+	Strat->SetLocalVirtualWorkerId(4);
+
+	TArray<FWorkerInterestRegion> Regions = Strat->GetWorkerInterestRegions();
+
+	TestEqual("Number of regions", Regions.Num(), 5);
+	if (Regions.Num() != 5)
+	{
+		return true;
+	}
+
+	// The inner region is the cell expanded by the hysteresis band: a 54x54 box around the centre.
+	TestTrue("Inner region is checked out in full", Regions[0].IsFullInterest());
+	const SpatialGDK::BoxConstraint Inner = Regions[0].Constraint.BoxConstraint.GetValue();
+	TestEqual("Centre of the inner region is as expected", Inner.Center, SpatialGDK::Coordinates{ 25.0, 0.0, 25.0 });
+	TestEqual("Edge length in x of the inner region is as expected", Inner.EdgeLength.X, 54.0);
+	TestEqual("Edge length in z of the inner region is as expected", Inner.EdgeLength.Z, 54.0);
+
+	// The strips cover the rest of the 70x70 interest box without overlapping.
+	double StripArea = 0.0;
+	for (int32 i = 1; i < Regions.Num(); i++)
+	{
+		TestEqual("Border frequency", Regions[i].Frequency, 2.0f);
+		TestTrue("Border only checks out data", Regions[i].SchemaComponentTypes == TArray<ESchemaComponentType>{ SCHEMA_Data });
+
+		const SpatialGDK::BoxConstraint Strip = Regions[i].Constraint.BoxConstraint.GetValue();
+		StripArea += Strip.EdgeLength.X * Strip.EdgeLength.Z;
+	}
+	TestEqual("Strips cover the border", StripArea, 70.0 * 70.0 - 54.0 * 54.0, 0.01);
+
+	return true;
+}
+
 GRIDBASEDLBSTRATEGY_TEST(GIVEN_four_cells_WHEN_get_worker_entity_position_for_virtual_worker_THEN_returns_correct_position)
 {
 	Strat = UTestGridBasedLBStrategy::Create(2, 2, 10000.f, 10000.f, 1000.0f);
@@ -249,6 +364,119 @@ GRIDBASEDLBSTRATEGY_TEST(GIVEN_four_cells_WHEN_get_worker_entity_position_for_vi
 	return true;
 }
 
+VirtualWorkerId FindVirtualWorkerByScanningCells(const UGridBasedLBStrategy::LBStrategyRegions& Regions, const FVector2D& Location)
+{
+	for (const TPair<VirtualWorkerId, FBox2D>& Region : Regions)
+	{
+		const FBox2D& Cell = Region.Value;
+		if (Location.X >= Cell.Min.X && Location.Y >= Cell.Min.Y && Location.X < Cell.Max.X && Location.Y < Cell.Max.Y)
+		{
+			return Region.Key;
+		}
+	}
+	return SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_uneven_grid_WHEN_get_virtual_worker_for_location_THEN_matches_scanning_every_cell)
+{
+	// Cell sizes that aren't exactly representable, so that accumulated cell edges differ from computed ones.
+	Strat = UTestGridBasedLBStrategy::Create(7, 3, 10000.f, 7777.f);
+	Strat->Init();
+
+	const UGridBasedLBStrategy::LBStrategyRegions Regions = Strat->GetLBStrategyRegions();
+
+	TArray<FVector2D> Locations;
+	for (const TPair<VirtualWorkerId, FBox2D>& Region : Regions)
+	{
+		// Every corner and edge of every cell, plus points just either side of them.
+		for (float X : { Region.Value.Min.X, Region.Value.Max.X })
+		{
+			for (float Y : { Region.Value.Min.Y, Region.Value.Max.Y })
+			{
+				Locations.Add(FVector2D(X, Y));
+				Locations.Add(FVector2D(std::nextafter(X, -FLT_MAX), std::nextafter(Y, -FLT_MAX)));
+				Locations.Add(FVector2D(std::nextafter(X, FLT_MAX), std::nextafter(Y, FLT_MAX)));
+			}
+		}
+		Locations.Add(Region.Value.GetCenter());
+	}
+	Locations.Add(FVector2D(-100000.f, 0.f));
+	Locations.Add(FVector2D(0.f, 100000.f));
+
+	for (const FVector2D& Location : Locations)
+	{
+		const VirtualWorkerId Expected = FindVirtualWorkerByScanningCells(Regions, Location);
+		const VirtualWorkerId Actual = Strat->GetVirtualWorkerForLocation(Location);
+		TestEqual(FString::Printf(TEXT("Virtual worker for (%f, %f)"), Location.X, Location.Y), Actual, Expected);
+	}
+
+	return true;
+}
+
+// Compares the cost of finding a cell directly against scanning every cell, as WhoShouldHaveAuthority used to. With 256 cells,
+// a scan checks over a hundred cells per lookup on average, so the direct lookup is expected to be faster on any machine.
+GRIDBASEDLBSTRATEGY_TEST(Benchmark_virtual_worker_lookup_against_scanning_every_cell)
+{
+	const uint32 Rows = 16;
+	const uint32 Cols = 16;
+	const float WorldSize = 1000000.f;
+	const int32 NumLocations = 50000;
+	const int32 NumPasses = 10;
+
+	Strat = UTestGridBasedLBStrategy::Create(Rows, Cols, WorldSize, WorldSize);
+	Strat->Init();
+
+	const UGridBasedLBStrategy::LBStrategyRegions Regions = Strat->GetLBStrategyRegions();
+
+	FRandomStream Random(1234);
+	TArray<FVector2D> Locations;
+	Locations.Reserve(NumLocations);
+	for (int32 i = 0; i < NumLocations; i++)
+	{
+		Locations.Add(FVector2D(Random.FRandRange(-WorldSize / 2.f, WorldSize / 2.f), Random.FRandRange(-WorldSize / 2.f, WorldSize / 2.f)));
+	}
+
+	TArray<VirtualWorkerId> ScanResults;
+	ScanResults.SetNumUninitialized(NumLocations);
+	const double ScanStart = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; Pass++)
+	{
+		for (int32 i = 0; i < NumLocations; i++)
+		{
+			ScanResults[i] = FindVirtualWorkerByScanningCells(Regions, Locations[i]);
+		}
+	}
+	const double ScanSeconds = FPlatformTime::Seconds() - ScanStart;
+
+	TArray<VirtualWorkerId> LookupResults;
+	LookupResults.SetNumUninitialized(NumLocations);
+	const double LookupStart = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; Pass++)
+	{
+		for (int32 i = 0; i < NumLocations; i++)
+		{
+			LookupResults[i] = Strat->GetVirtualWorkerForLocation(Locations[i]);
+		}
+	}
+	const double LookupSeconds = FPlatformTime::Seconds() - LookupStart;
+
+	UE_LOG(LogGridBasedLBStrategyTest, Display, TEXT("%d lookups in a %ux%u grid: scanning cells %.3f ms, direct lookup %.3f ms"),
+		NumLocations * NumPasses, Rows, Cols, ScanSeconds * 1000.0, LookupSeconds * 1000.0);
+
+	int32 NumMismatches = 0;
+	int32 NumInvalid = 0;
+	for (int32 i = 0; i < NumLocations; i++)
+	{
+		NumMismatches += LookupResults[i] != ScanResults[i] ? 1 : 0;
+		NumInvalid += LookupResults[i] == SpatialConstants::INVALID_VIRTUAL_WORKER_ID ? 1 : 0;
+	}
+
+	TestEqual("Direct lookup returns the same virtual worker as scanning for every location", NumMismatches, 0);
+	TestEqual("Every location inside the world has a virtual worker", NumInvalid, 0);
+
+	return true;
+}
+
 }  // anonymous namespace
 
 GRIDBASEDLBSTRATEGY_TEST(GIVEN_a_single_cell_and_valid_local_id_WHEN_should_relinquish_called_THEN_returns_false)
@@ -280,6 +508,7 @@ GRIDBASEDLBSTRATEGY_TEST(GIVEN_four_cells_WHEN_actors_in_each_cell_THEN_should_r
 	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor3"));
 	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor4"));
 	ADD_LATENT_AUTOMATION_COMMAND(FCheckVirtualWorkersDiffer(this, {"Actor1", "Actor2", "Actor3", "Actor4"}));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckBatchedWhoShouldHaveAuthority(this, {"Actor1", "Actor2", "Actor3", "Actor4"}));
 	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
 
 	return true;
@@ -334,3 +563,39 @@ GRIDBASEDLBSTRATEGY_TEST(GIVEN_two_cells_WHEN_actor_in_one_cell_THEN_strategy_re
 
 	return true;
 }
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_hysteresis_band_WHEN_actor_crosses_boundary_THEN_authority_is_relinquished_only_outside_the_band)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateTwoRowStrategyWithHysteresis(100.f, 1));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor1", FVector(-50.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor1"));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckShouldRelinquishAuthorityWithHysteresis(this, "Actor1", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FMoveActor("Actor1", FVector(50.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckShouldRelinquishAuthority(this, "Actor1", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckShouldRelinquishAuthorityWithHysteresis(this, "Actor1", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FMoveActor("Actor1", FVector(150.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckShouldRelinquishAuthorityWithHysteresis(this, "Actor1", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckWhoShouldHaveAuthority(this, "Actor1", 2));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
+
+GRIDBASEDLBSTRATEGY_TEST(GIVEN_actor_moving_towards_boundary_WHEN_predict_authority_called_THEN_returns_worker_it_will_reach)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCreateTwoRowStrategyWithHysteresis(0.f, 1));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld());
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActorAtLocation("Actor1", FVector(-100.f, 0.f, 0.f)));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor("Actor1"));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckPredictAuthority(this, "Actor1", FVector(1000.f, 0.f, 0.f), 0.5f, 2));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckPredictAuthority(this, "Actor1", FVector(1000.f, 0.f, 0.f), 0.05f, 1));
+	ADD_LATENT_AUTOMATION_COMMAND(FCheckPredictAuthority(this, "Actor1", FVector(-1000.f, 0.f, 0.f), 0.5f, 1));
+	ADD_LATENT_AUTOMATION_COMMAND(FCleanup());
+
+	return true;
+}
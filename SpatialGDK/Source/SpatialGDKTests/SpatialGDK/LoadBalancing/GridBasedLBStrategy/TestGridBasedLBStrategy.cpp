@@ -2,7 +2,7 @@
 
 #include "TestGridBasedLBStrategy.h"
 
-UGridBasedLBStrategy* UTestGridBasedLBStrategy::Create(uint32 InRows, uint32 InCols, float WorldWidth, float WorldHeight, float InterestBorder)
+UGridBasedLBStrategy* UTestGridBasedLBStrategy::Create(uint32 InRows, uint32 InCols, float WorldWidth, float WorldHeight, float InterestBorder, float AuthorityHysteresisBand, float BorderInterestFrequency, bool bBorderInterestDataOnly)
 {
 	UTestGridBasedLBStrategy* Strat = NewObject<UTestGridBasedLBStrategy>();
 
@@ -13,6 +13,9 @@ UGridBasedLBStrategy* UTestGridBasedLBStrategy::Create(uint32 InRows, uint32 InC
 	Strat->WorldHeight = WorldHeight;
 
 	Strat->InterestBorder = InterestBorder;
+	Strat->AuthorityHysteresisBand = AuthorityHysteresisBand;
+	Strat->BorderInterestFrequency = BorderInterestFrequency;
+	Strat->bBorderInterestDataOnly = bBorderInterestDataOnly;
 
 	return Strat;
 }
@@ -16,5 +16,5 @@ class SPATIALGDKTESTS_API UTestGridBasedLBStrategy : public UGridBasedLBStrategy
 
 public:
 
-	static UGridBasedLBStrategy* Create(uint32 Rows, uint32 Cols, float WorldWidth, float WorldHeight, float InterestBorder = 0.0f);
+	static UGridBasedLBStrategy* Create(uint32 Rows, uint32 Cols, float WorldWidth, float WorldHeight, float InterestBorder = 0.0f, float AuthorityHysteresisBand = 0.0f, float BorderInterestFrequency = 0.0f, bool bBorderInterestDataOnly = false);
 };
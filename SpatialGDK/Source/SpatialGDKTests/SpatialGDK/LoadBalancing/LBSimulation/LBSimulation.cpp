@@ -0,0 +1,383 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LBSimulation.h"
+
+#include "EngineClasses/SpatialLoadBalanceEnforcer.h"
+#include "EngineClasses/SpatialVirtualWorkerTranslator.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "LoadBalancing/AbstractLBStrategy.h"
+#include "Schema/AuthorityIntent.h"
+#include "Tests/TestingComponentViewHelpers.h"
+#include "Tests/TestingSchemaHelpers.h"
+
+#include "Algo/BinarySearch.h"
+#include "Math/RandomStream.h"
+#include "UObject/Package.h"
+
+namespace
+{
+
+PhysicalWorkerName GetSimulatedWorkerName(VirtualWorkerId WorkerId)
+{
+	return FString::Printf(TEXT("SimWorker%u"), WorkerId);
+}
+
+} // anonymous namespace
+
+namespace SpatialGDK
+{
+
+FString FLBSimulationReport::ToString() const
+{
+	FString Report = FString::Printf(TEXT("Simulated %.1fs with %d entities: %d migrations (%.2f/s), authority gap avg %.3fs max %.3fs, %d layout changes, at most %d queued ACL assignments."),
+		SimulatedTime, NumEntities, NumMigrations, MigrationsPerSecond, AverageAuthorityGap, MaxAuthorityGap, NumLayoutChanges, MaxQueuedAclAssignments);
+
+	for (const FLBSimulationWorkerStats& Stats : WorkerStats)
+	{
+		Report += FString::Printf(TEXT("\n  Worker %u: entities avg %.1f max %d final %d"),
+			Stats.WorkerId, Stats.AverageEntityCount, Stats.MaxEntityCount, Stats.FinalEntityCount);
+	}
+
+	return Report;
+}
+
+FLBSimulation::FLBSimulation(const UAbstractLBStrategy& StrategyTemplate, const FLBSimulationConfig& InConfig)
+	: Config(InConfig)
+{
+	check(StrategyTemplate.SupportsLocationQueries());
+	check(Config.TickInterval > 0.f);
+
+	UAbstractLBStrategy* FirstStrategy = DuplicateObject<UAbstractLBStrategy>(&StrategyTemplate, GetTransientPackage());
+	FirstStrategy->Init();
+	const int32 NumWorkers = FirstStrategy->GetVirtualWorkerIds().Num();
+
+	Strategies.Emplace(FirstStrategy);
+	for (int32 i = 1; i < NumWorkers; i++)
+	{
+		UAbstractLBStrategy* Strategy = DuplicateObject<UAbstractLBStrategy>(&StrategyTemplate, GetTransientPackage());
+		Strategy->Init();
+		Strategies.Emplace(Strategy);
+	}
+
+	// Virtual worker 1 also runs the enforcer, as the worker authoritative over the translation would.
+	VirtualWorkerTranslator = MakeUnique<SpatialVirtualWorkerTranslator>(FirstStrategy, GetSimulatedWorkerName(1));
+
+	Schema_Object* DataObject = TestingSchemaHelpers::CreateTranslationComponentDataFields();
+	for (int32 i = 0; i < NumWorkers; i++)
+	{
+		const VirtualWorkerId WorkerId = i + 1;
+		TestingSchemaHelpers::AddTranslationComponentDataMapping(DataObject, WorkerId, GetSimulatedWorkerName(WorkerId));
+		VirtualWorkerIdsByName.Add(GetSimulatedWorkerName(WorkerId), WorkerId);
+		Strategies[i]->SetLocalVirtualWorkerId(WorkerId);
+	}
+	VirtualWorkerTranslator->ApplyVirtualWorkerManagerData(DataObject);
+
+	StaticComponentView.Reset(NewObject<USpatialStaticComponentView>());
+	LoadBalanceEnforcer = MakeUnique<SpatialLoadBalanceEnforcer>(GetSimulatedWorkerName(1), StaticComponentView.Get(), VirtualWorkerTranslator.Get());
+	LoadBalanceEnforcer->SetMaxAclAssignmentsPerTick(Config.MaxAclAssignmentsPerTick);
+
+	TotalEntityCounts.Init(0, NumWorkers);
+	MaxEntityCounts.Init(0, NumWorkers);
+}
+
+FLBSimulation::~FLBSimulation() = default;
+
+Worker_EntityId FLBSimulation::AddEntity(FLBSimulationTrace Trace)
+{
+	FSimulatedEntity& Entity = Entities.AddDefaulted_GetRef();
+	Entity.EntityId = Entities.Num();
+	Entity.Location = Trace(0.f);
+	Entity.PreviousLocation = Entity.Location;
+	Entity.Trace = MoveTemp(Trace);
+	Entity.AuthoritativeWorker = Strategies[0]->WhoShouldHaveAuthorityAtLocation(Entity.Location);
+	Entity.TimeAuthorityGained = 0.f;
+	Entity.TimeAuthorityLost = 0.f;
+	Entity.PrefetchedWorker = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+
+	// The enforcer only sees the components it needs, as a load balancing worker would.
+	for (Worker_ComponentId ComponentId : { SpatialConstants::AUTHORITY_INTENT_COMPONENT_ID, SpatialConstants::COMPONENT_PRESENCE_COMPONENT_ID, SpatialConstants::NET_OWNING_CLIENT_WORKER_COMPONENT_ID })
+	{
+		TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView, Entity.EntityId, ComponentId, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+	}
+	TestingComponentViewHelpers::AddEntityComponentToStaticComponentView(*StaticComponentView, Entity.EntityId, SpatialConstants::ENTITY_ACL_COMPONENT_ID, WORKER_AUTHORITY_AUTHORITATIVE);
+	StaticComponentView->GetComponentData<AuthorityIntent>(Entity.EntityId)->VirtualWorkerId = Entity.AuthoritativeWorker;
+
+	return Entity.EntityId;
+}
+
+FLBSimulationReport FLBSimulation::Run()
+{
+	float Time = 0.f;
+	while (Time < Config.Duration)
+	{
+		Time += Config.TickInterval;
+		Tick(Time);
+	}
+
+	FLBSimulationReport Report;
+	Report.SimulatedTime = Time;
+	Report.NumEntities = Entities.Num();
+	Report.NumMigrations = NumMigrations;
+	Report.MigrationsPerSecond = Time > 0.f ? NumMigrations / Time : 0.f;
+	Report.AverageAuthorityGap = NumHandovers > 0 ? TotalAuthorityGap / NumHandovers : 0.f;
+	Report.MaxAuthorityGap = MaxAuthorityGap;
+	Report.NumLayoutChanges = NumLayoutChanges;
+	Report.MaxQueuedAclAssignments = MaxQueuedAclAssignments;
+
+	for (int32 i = 0; i < Strategies.Num(); i++)
+	{
+		FLBSimulationWorkerStats& Stats = Report.WorkerStats.AddDefaulted_GetRef();
+		Stats.WorkerId = i + 1;
+		Stats.AverageEntityCount = NumSamples > 0 ? static_cast<float>(TotalEntityCounts[i]) / NumSamples : 0.f;
+		Stats.MaxEntityCount = MaxEntityCounts[i];
+	}
+	for (const FSimulatedEntity& Entity : Entities)
+	{
+		if (Entity.AuthoritativeWorker != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+		{
+			Report.WorkerStats[Entity.AuthoritativeWorker - 1].FinalEntityCount++;
+		}
+	}
+
+	return Report;
+}
+
+void FLBSimulation::Tick(float Time)
+{
+	for (FSimulatedEntity& Entity : Entities)
+	{
+		Entity.PreviousLocation = Entity.Location;
+		Entity.Location = Entity.Trace(Time);
+	}
+
+	DeliverPending(Time);
+	UpdateAuthority(Time);
+	ProcessAclAssignments(Time);
+
+	const float LayoutUpdateInterval = Strategies[0]->GetLayoutUpdateInterval();
+	TimeSinceLayoutUpdate += Config.TickInterval;
+	if (LayoutUpdateInterval > 0.f && TimeSinceLayoutUpdate >= LayoutUpdateInterval)
+	{
+		TimeSinceLayoutUpdate = 0.f;
+		UpdateLayout();
+	}
+
+	TArray<int32> EntityCounts;
+	EntityCounts.Init(0, Strategies.Num());
+	for (const FSimulatedEntity& Entity : Entities)
+	{
+		if (Entity.AuthoritativeWorker != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+		{
+			EntityCounts[Entity.AuthoritativeWorker - 1]++;
+		}
+	}
+	for (int32 i = 0; i < EntityCounts.Num(); i++)
+	{
+		TotalEntityCounts[i] += EntityCounts[i];
+		MaxEntityCounts[i] = FMath::Max(MaxEntityCounts[i], EntityCounts[i]);
+	}
+	NumSamples++;
+}
+
+void FLBSimulation::DeliverPending(float Time)
+{
+	// Deliveries are queued in time order, since every delivery has the same latency.
+	int32 NumDelivered = 0;
+	for (const FPendingDelivery& Delivery : PendingDeliveries)
+	{
+		if (Delivery.DeliveryTime > Time)
+		{
+			break;
+		}
+		NumDelivered++;
+
+		FSimulatedEntity& Entity = Entities[Delivery.EntityIndex];
+		if (Delivery.bIsIntent)
+		{
+			StaticComponentView->GetComponentData<AuthorityIntent>(Entity.EntityId)->VirtualWorkerId = Delivery.WorkerId;
+			LoadBalanceEnforcer->MaybeQueueAclAssignmentRequest(Entity.EntityId);
+			continue;
+		}
+
+		if (Entity.AuthoritativeWorker == Delivery.WorkerId)
+		{
+			// A prefetched handover that was taken back.
+			continue;
+		}
+
+		// After a prefetched handover the previous worker kept simulating the entity, so there is no gap.
+		const float AuthorityGap = Entity.AuthoritativeWorker == SpatialConstants::INVALID_VIRTUAL_WORKER_ID ? Time - Entity.TimeAuthorityLost : 0.f;
+		TotalAuthorityGap += AuthorityGap;
+		MaxAuthorityGap = FMath::Max(MaxAuthorityGap, AuthorityGap);
+		NumHandovers++;
+
+		Entity.AuthoritativeWorker = Delivery.WorkerId;
+		Entity.PrefetchedWorker = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+		Entity.TimeAuthorityGained = Time;
+	}
+
+	PendingDeliveries.RemoveAt(0, NumDelivered, /* bAllowShrinking */ false);
+}
+
+void FLBSimulation::UpdateAuthority(float Time)
+{
+	for (int32 EntityIndex = 0; EntityIndex < Entities.Num(); EntityIndex++)
+	{
+		FSimulatedEntity& Entity = Entities[EntityIndex];
+		if (Entity.AuthoritativeWorker == SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+		{
+			continue;
+		}
+
+		if (Time - Entity.TimeAuthorityGained < Config.MinimumAuthorityDwellTime)
+		{
+			continue;
+		}
+
+		if (Config.IsLocked && Config.IsLocked(Entity.EntityId, Time))
+		{
+			continue;
+		}
+
+		// Mirrors the decisions USpatialActorChannel::ReplicateActor makes, with the velocity taken from the last tick.
+		const UAbstractLBStrategy* Strategy = Strategies[Entity.AuthoritativeWorker - 1].Get();
+		const bool bPrefetch = Config.HandoverPrefetchTime > 0.f;
+		const FVector PredictedLocation = Entity.Location + (Entity.Location - Entity.PreviousLocation) / Config.TickInterval * Config.HandoverPrefetchTime;
+		const bool bPredictedToStay = bPrefetch && !Strategy->ShouldRelinquishAuthorityAtLocation(PredictedLocation);
+
+		if (!Strategy->ShouldRelinquishAuthorityAtLocation(Entity.Location))
+		{
+			if (bPrefetch && !bPredictedToStay)
+			{
+				const VirtualWorkerId PredictedWorker = Strategy->WhoShouldHaveAuthorityAtLocation(PredictedLocation);
+				if (PredictedWorker != SpatialConstants::INVALID_VIRTUAL_WORKER_ID && PredictedWorker != Entity.PrefetchedWorker)
+				{
+					NumMigrations++;
+					Entity.PrefetchedWorker = PredictedWorker;
+					PendingDeliveries.Add(FPendingDelivery{ Time + Config.OpLatency, EntityIndex, PredictedWorker, true });
+				}
+			}
+			else if (Entity.PrefetchedWorker != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+			{
+				Entity.PrefetchedWorker = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+				PendingDeliveries.Add(FPendingDelivery{ Time + Config.OpLatency, EntityIndex, Entity.AuthoritativeWorker, true });
+			}
+			continue;
+		}
+
+		if (bPredictedToStay)
+		{
+			continue;
+		}
+
+		const VirtualWorkerId NewAuthoritativeWorker = Strategy->WhoShouldHaveAuthorityAtLocation(Entity.Location);
+		if (NewAuthoritativeWorker == SpatialConstants::INVALID_VIRTUAL_WORKER_ID
+			|| NewAuthoritativeWorker == Entity.AuthoritativeWorker
+			|| NewAuthoritativeWorker == Entity.PrefetchedWorker)
+		{
+			continue;
+		}
+
+		NumMigrations++;
+		Entity.AuthoritativeWorker = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+		Entity.PrefetchedWorker = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+		Entity.TimeAuthorityLost = Time;
+		PendingDeliveries.Add(FPendingDelivery{ Time + Config.OpLatency, EntityIndex, NewAuthoritativeWorker, true });
+	}
+}
+
+void FLBSimulation::ProcessAclAssignments(float Time)
+{
+	MaxQueuedAclAssignments = FMath::Max(MaxQueuedAclAssignments, LoadBalanceEnforcer->GetNumQueuedAclAssignmentRequests());
+
+	for (const SpatialLoadBalanceEnforcer::AclWriteAuthorityRequest& Request : LoadBalanceEnforcer->ProcessQueuedAclAssignmentRequests())
+	{
+		const VirtualWorkerId* WorkerId = VirtualWorkerIdsByName.Find(Request.OwningWorkerId);
+		check(WorkerId != nullptr);
+		PendingDeliveries.Add(FPendingDelivery{ Time + Config.OpLatency, static_cast<int32>(Request.EntityId) - 1, *WorkerId, false });
+	}
+}
+
+void FLBSimulation::UpdateLayout()
+{
+	TMap<VirtualWorkerId, FVirtualWorkerLoad> Loads;
+	for (int32 i = 0; i < Strategies.Num(); i++)
+	{
+		Loads.Add(i + 1);
+	}
+	for (const FSimulatedEntity& Entity : Entities)
+	{
+		if (Entity.AuthoritativeWorker != SpatialConstants::INVALID_VIRTUAL_WORKER_ID)
+		{
+			Loads[Entity.AuthoritativeWorker].AuthoritativeActorCount++;
+		}
+	}
+
+	if (!Strategies[0]->UpdateLayout(Loads))
+	{
+		return;
+	}
+
+	NumLayoutChanges++;
+
+	TArray<uint8> Layout;
+	Strategies[0]->WriteLayout(Layout);
+	for (int32 i = 1; i < Strategies.Num(); i++)
+	{
+		Strategies[i]->ApplyLayout(Layout);
+	}
+}
+
+FLBSimulationTrace FLBSimulation::MakeStationaryTrace(const FVector& Location)
+{
+	return [Location](float Time)
+	{
+		return Location;
+	};
+}
+
+FLBSimulationTrace FLBSimulation::MakePatrolTrace(const FVector& Start, const FVector& End, float Speed)
+{
+	const float LegDuration = FVector::Dist(Start, End) / FMath::Max(Speed, KINDA_SMALL_NUMBER);
+	if (LegDuration <= 0.f)
+	{
+		return MakeStationaryTrace(Start);
+	}
+
+	return [Start, End, LegDuration](float Time)
+	{
+		const float Phase = FMath::Fmod(Time / LegDuration, 2.f);
+		return FMath::Lerp(Start, End, Phase <= 1.f ? Phase : 2.f - Phase);
+	};
+}
+
+FLBSimulationTrace FLBSimulation::MakeRandomWalkTrace(const FBox& Bounds, float Speed, int32 Seed, float Duration)
+{
+	FRandomStream RandomStream(Seed);
+	Speed = FMath::Max(Speed, KINDA_SMALL_NUMBER);
+
+	// Waypoints and the time each one is reached, covering at least Duration.
+	TArray<FVector> Waypoints;
+	TArray<float> WaypointTimes;
+	Waypoints.Add(RandomStream.RandPointInBox(Bounds));
+	WaypointTimes.Add(0.f);
+	while (WaypointTimes.Last() < Duration)
+	{
+		const FVector Next = RandomStream.RandPointInBox(Bounds);
+		WaypointTimes.Add(WaypointTimes.Last() + FMath::Max(FVector::Dist(Waypoints.Last(), Next) / Speed, KINDA_SMALL_NUMBER));
+		Waypoints.Add(Next);
+	}
+
+	return [Waypoints, WaypointTimes](float Time)
+	{
+		const int32 Next = Algo::UpperBound(WaypointTimes, Time);
+		if (Next >= Waypoints.Num())
+		{
+			return Waypoints.Last();
+		}
+		const float Alpha = (Time - WaypointTimes[Next - 1]) / (WaypointTimes[Next] - WaypointTimes[Next - 1]);
+		return FMath::Lerp(Waypoints[Next - 1], Waypoints[Next], Alpha);
+	};
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,156 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+#include "SpatialConstants.h"
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "UObject/StrongObjectPtr.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+class SpatialLoadBalanceEnforcer;
+class SpatialVirtualWorkerTranslator;
+class UAbstractLBStrategy;
+class USpatialStaticComponentView;
+
+namespace SpatialGDK
+{
+
+// Position of a simulated entity, given the time in seconds since the start of the simulation.
+using FLBSimulationTrace = TFunction<FVector(float Time)>;
+
+struct FLBSimulationConfig
+{
+	float Duration = 60.f;
+	float TickInterval = 1.f / 30.f;
+
+	// One way latency between a worker and the load balancer. An authority intent reaches the enforcer after this delay,
+	// and the resulting ACL update reaches the new worker after the same delay again.
+	float OpLatency = 0.05f;
+
+	// Same meaning as USpatialGDKSettings::MinimumAuthorityDwellTime.
+	float MinimumAuthorityDwellTime = 0.f;
+
+	// Same meaning as USpatialGDKSettings::MaxAclAssignmentsPerTick. 0 means no limit.
+	int32 MaxAclAssignmentsPerTick = 0;
+
+	// Same meaning as USpatialGDKSettings::HandoverPrefetchTime.
+	float HandoverPrefetchTime = 0.f;
+
+	// Optional stand-in for the locking policy. Locked entities are never handed over.
+	TFunction<bool(Worker_EntityId EntityId, float Time)> IsLocked;
+};
+
+struct FLBSimulationWorkerStats
+{
+	VirtualWorkerId WorkerId = SpatialConstants::INVALID_VIRTUAL_WORKER_ID;
+	float AverageEntityCount = 0.f;
+	int32 MaxEntityCount = 0;
+	int32 FinalEntityCount = 0;
+};
+
+struct FLBSimulationReport
+{
+	float SimulatedTime = 0.f;
+	int32 NumEntities = 0;
+
+	int32 NumMigrations = 0;
+	float MigrationsPerSecond = 0.f;
+
+	// Time between a worker relinquishing authority over an entity and the next worker gaining it. Prefetched handovers
+	// have no gap.
+	float AverageAuthorityGap = 0.f;
+	float MaxAuthorityGap = 0.f;
+
+	int32 NumLayoutChanges = 0;
+	int32 MaxQueuedAclAssignments = 0;
+
+	TArray<FLBSimulationWorkerStats> WorkerStats;
+
+	FString ToString() const;
+};
+
+// Simulates a deployment of server workers in a single process, without a SpatialOS runtime.
+// Each virtual worker gets its own copy of the load balancing strategy. Authority intents are handed to a real
+// SpatialLoadBalanceEnforcer over a static component view, and its ACL assignments are delivered back to the workers
+// after the configured latency. Layout changes of adaptive strategies are decided by virtual worker 1 and applied to
+// every worker, as they would be through the virtual worker translation.
+// The strategy must support location queries, since there are no Actors to query.
+class SPATIALGDKTESTS_API FLBSimulation
+{
+public:
+	FLBSimulation(const UAbstractLBStrategy& StrategyTemplate, const FLBSimulationConfig& InConfig);
+	~FLBSimulation();
+
+	// Returns the entity id of the new entity. Entities start on the worker that should have authority over them, so traces
+	// must start inside the area covered by the strategy.
+	Worker_EntityId AddEntity(FLBSimulationTrace Trace);
+
+	FLBSimulationReport Run();
+
+	static FLBSimulationTrace MakeStationaryTrace(const FVector& Location);
+	// Moves back and forth between Start and End at Speed cm/s.
+	static FLBSimulationTrace MakePatrolTrace(const FVector& Start, const FVector& End, float Speed);
+	// Moves at Speed cm/s between random waypoints inside Bounds. The same Seed always gives the same trace.
+	static FLBSimulationTrace MakeRandomWalkTrace(const FBox& Bounds, float Speed, int32 Seed, float Duration);
+
+private:
+	struct FSimulatedEntity
+	{
+		Worker_EntityId EntityId;
+		FLBSimulationTrace Trace;
+		FVector Location;
+		FVector PreviousLocation;
+
+		// INVALID_VIRTUAL_WORKER_ID while authority is being handed over.
+		VirtualWorkerId AuthoritativeWorker;
+		// The worker an authority intent was sent for ahead of time, while the current worker keeps simulating the entity.
+		VirtualWorkerId PrefetchedWorker;
+		float TimeAuthorityGained;
+		float TimeAuthorityLost;
+	};
+
+	struct FPendingDelivery
+	{
+		float DeliveryTime;
+		int32 EntityIndex;
+		VirtualWorkerId WorkerId;
+		// Intents are delivered to the enforcer, ACL assignments to the new authoritative worker.
+		bool bIsIntent;
+	};
+
+	void Tick(float Time);
+	void DeliverPending(float Time);
+	void UpdateAuthority(float Time);
+	void ProcessAclAssignments(float Time);
+	void UpdateLayout();
+
+	FLBSimulationConfig Config;
+
+	TArray<TStrongObjectPtr<UAbstractLBStrategy>> Strategies;
+	TStrongObjectPtr<USpatialStaticComponentView> StaticComponentView;
+	TUniquePtr<SpatialVirtualWorkerTranslator> VirtualWorkerTranslator;
+	TUniquePtr<SpatialLoadBalanceEnforcer> LoadBalanceEnforcer;
+	TMap<PhysicalWorkerName, VirtualWorkerId> VirtualWorkerIdsByName;
+
+	TArray<FSimulatedEntity> Entities;
+	TArray<FPendingDelivery> PendingDeliveries;
+
+	float TimeSinceLayoutUpdate = 0.f;
+
+	int32 NumMigrations = 0;
+	int32 NumHandovers = 0;
+	double TotalAuthorityGap = 0.0;
+	float MaxAuthorityGap = 0.f;
+	int32 NumLayoutChanges = 0;
+	int32 MaxQueuedAclAssignments = 0;
+
+	int32 NumSamples = 0;
+	TArray<int64> TotalEntityCounts;
+	TArray<int32> MaxEntityCounts;
+};
+
+} // namespace SpatialGDK
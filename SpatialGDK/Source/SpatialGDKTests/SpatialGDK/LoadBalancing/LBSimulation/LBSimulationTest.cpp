@@ -0,0 +1,231 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "LBSimulation.h"
+#include "SpatialGDKTests/SpatialGDK/LoadBalancing/AdaptiveLBStrategy/TestAdaptiveLBStrategy.h"
+#include "SpatialGDKTests/SpatialGDK/LoadBalancing/GridBasedLBStrategy/TestGridBasedLBStrategy.h"
+
+#include "CoreMinimal.h"
+#include "Tests/TestDefinitions.h"
+
+#define LBSIMULATION_TEST(TestName) \
+	GDK_TEST(Core, FLBSimulation, TestName)
+
+DEFINE_LOG_CATEGORY_STATIC(LogLBSimulationTest, Log, All);
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+// Two rows in a 10000x10000 world: worker 1 owns X < 0, worker 2 owns X >= 0.
+UGridBasedLBStrategy* CreateTwoRowStrategy(float AuthorityHysteresisBand = 0.f)
+{
+	return UTestGridBasedLBStrategy::Create(2, 1, 10000.f, 10000.f, 0.f, AuthorityHysteresisBand);
+}
+
+FLBSimulationConfig CreateConfig(float Duration)
+{
+	FLBSimulationConfig Config;
+	Config.Duration = Duration;
+	Config.TickInterval = 0.05f;
+	Config.OpLatency = 0.1f;
+	return Config;
+}
+
+} // anonymous namespace
+
+LBSIMULATION_TEST(GIVEN_stationary_entities_WHEN_simulated_THEN_no_migrations_and_entities_stay_on_their_workers)
+{
+	// GIVEN
+	UGridBasedLBStrategy* Strat = CreateTwoRowStrategy();
+	FLBSimulation Simulation(*Strat, CreateConfig(10.f));
+	Simulation.AddEntity(FLBSimulation::MakeStationaryTrace(FVector(-1000.f, 0.f, 0.f)));
+	Simulation.AddEntity(FLBSimulation::MakeStationaryTrace(FVector(1000.f, 0.f, 0.f)));
+	Simulation.AddEntity(FLBSimulation::MakeStationaryTrace(FVector(2000.f, 0.f, 0.f)));
+
+	// WHEN
+	const FLBSimulationReport Report = Simulation.Run();
+
+	// THEN
+	TestTrue("No entities migrated", Report.NumMigrations == 0);
+	TestTrue("There is one report per worker", Report.WorkerStats.Num() == 2);
+	TestTrue("Worker 1 has one entity", Report.WorkerStats.Num() == 2 && Report.WorkerStats[0].FinalEntityCount == 1 && Report.WorkerStats[0].MaxEntityCount == 1);
+	TestTrue("Worker 2 has two entities", Report.WorkerStats.Num() == 2 && Report.WorkerStats[1].FinalEntityCount == 2 && FMath::IsNearlyEqual(Report.WorkerStats[1].AverageEntityCount, 2.f));
+
+	return true;
+}
+
+LBSIMULATION_TEST(GIVEN_an_entity_patrolling_across_a_boundary_WHEN_simulated_THEN_it_migrates_on_each_crossing_with_a_round_trip_authority_gap)
+{
+	// GIVEN
+	// Each leg takes 3 seconds, so the entity crosses the boundary 10 times in 30 seconds.
+	UGridBasedLBStrategy* Strat = CreateTwoRowStrategy();
+	const FLBSimulationConfig Config = CreateConfig(30.f);
+	FLBSimulation Simulation(*Strat, Config);
+	Simulation.AddEntity(FLBSimulation::MakePatrolTrace(FVector(-600.f, 0.f, 0.f), FVector(600.f, 0.f, 0.f), 400.f));
+
+	// WHEN
+	const FLBSimulationReport Report = Simulation.Run();
+
+	// THEN
+	TestTrue("Entity migrated on each crossing", Report.NumMigrations == 10);
+	TestTrue("Migration rate is reported", FMath::IsNearlyEqual(Report.MigrationsPerSecond, Report.NumMigrations / Report.SimulatedTime));
+	TestTrue("Authority gap is at least the round trip to the enforcer", Report.AverageAuthorityGap >= 2 * Config.OpLatency - KINDA_SMALL_NUMBER);
+	TestTrue("Authority gap is at most the round trip plus a tick per hop", Report.MaxAuthorityGap <= 2 * (Config.OpLatency + Config.TickInterval) + KINDA_SMALL_NUMBER);
+
+	return true;
+}
+
+LBSIMULATION_TEST(GIVEN_handover_prefetch_WHEN_an_entity_patrols_across_a_boundary_THEN_authority_moves_without_a_gap)
+{
+	// GIVEN
+	// The entity covers 200cm in the prefetch time, more than the 80cm it moves during the round trip to the enforcer.
+	UGridBasedLBStrategy* Strat = CreateTwoRowStrategy();
+	FLBSimulationConfig Config = CreateConfig(30.f);
+	Config.HandoverPrefetchTime = 0.5f;
+	FLBSimulation Simulation(*Strat, Config);
+	Simulation.AddEntity(FLBSimulation::MakePatrolTrace(FVector(-600.f, 0.f, 0.f), FVector(600.f, 0.f, 0.f), 400.f));
+
+	// WHEN
+	const FLBSimulationReport Report = Simulation.Run();
+
+	// THEN
+	TestTrue("Entity migrated once per crossing", Report.NumMigrations == 10);
+	TestTrue("No worker was without authority during handovers", FMath::IsNearlyZero(Report.MaxAuthorityGap));
+
+	return true;
+}
+
+LBSIMULATION_TEST(GIVEN_an_entity_moving_along_a_boundary_WHEN_hysteresis_band_covers_its_movement_THEN_it_does_not_migrate)
+{
+	// GIVEN
+	UGridBasedLBStrategy* Strat = CreateTwoRowStrategy();
+	UGridBasedLBStrategy* StratWithHysteresis = CreateTwoRowStrategy(200.f);
+	const FLBSimulationTrace Trace = FLBSimulation::MakePatrolTrace(FVector(-150.f, 0.f, 0.f), FVector(150.f, 0.f, 0.f), 100.f);
+
+	FLBSimulation Simulation(*Strat, CreateConfig(30.f));
+	Simulation.AddEntity(Trace);
+	FLBSimulation SimulationWithHysteresis(*StratWithHysteresis, CreateConfig(30.f));
+	SimulationWithHysteresis.AddEntity(Trace);
+
+	// WHEN
+	const FLBSimulationReport Report = Simulation.Run();
+	const FLBSimulationReport ReportWithHysteresis = SimulationWithHysteresis.Run();
+
+	// THEN
+	TestTrue("Entity migrates without hysteresis", Report.NumMigrations > 0);
+	TestTrue("Entity does not migrate with hysteresis", ReportWithHysteresis.NumMigrations == 0);
+
+	return true;
+}
+
+LBSIMULATION_TEST(GIVEN_a_minimum_dwell_time_WHEN_an_entity_crosses_back_quickly_THEN_fewer_migrations_happen)
+{
+	// GIVEN
+	// Each leg takes 0.5 seconds, shorter than the dwell time.
+	UGridBasedLBStrategy* Strat = CreateTwoRowStrategy();
+	const FLBSimulationTrace Trace = FLBSimulation::MakePatrolTrace(FVector(-100.f, 0.f, 0.f), FVector(100.f, 0.f, 0.f), 400.f);
+
+	FLBSimulation Simulation(*Strat, CreateConfig(30.f));
+	Simulation.AddEntity(Trace);
+
+	FLBSimulationConfig DwellConfig = CreateConfig(30.f);
+	DwellConfig.MinimumAuthorityDwellTime = 2.f;
+	FLBSimulation SimulationWithDwell(*Strat, DwellConfig);
+	SimulationWithDwell.AddEntity(Trace);
+
+	// WHEN
+	const FLBSimulationReport Report = Simulation.Run();
+	const FLBSimulationReport ReportWithDwell = SimulationWithDwell.Run();
+
+	// THEN
+	TestTrue("Dwell time reduces migrations", ReportWithDwell.NumMigrations < Report.NumMigrations);
+	TestTrue("At most one migration per dwell time", ReportWithDwell.NumMigrations <= FMath::CeilToInt(DwellConfig.Duration / DwellConfig.MinimumAuthorityDwellTime));
+
+	return true;
+}
+
+LBSIMULATION_TEST(GIVEN_a_locked_entity_WHEN_it_crosses_a_boundary_THEN_it_does_not_migrate)
+{
+	// GIVEN
+	UGridBasedLBStrategy* Strat = CreateTwoRowStrategy();
+	FLBSimulationConfig Config = CreateConfig(10.f);
+	Config.IsLocked = [](Worker_EntityId EntityId, float Time)
+	{
+		return true;
+	};
+	FLBSimulation Simulation(*Strat, Config);
+	Simulation.AddEntity(FLBSimulation::MakePatrolTrace(FVector(-600.f, 0.f, 0.f), FVector(600.f, 0.f, 0.f), 400.f));
+
+	// WHEN
+	const FLBSimulationReport Report = Simulation.Run();
+
+	// THEN
+	TestTrue("Locked entity did not migrate", Report.NumMigrations == 0);
+	TestTrue("Locked entity stayed on its original worker", Report.WorkerStats.Num() == 2 && Report.WorkerStats[0].FinalEntityCount == 1);
+
+	return true;
+}
+
+LBSIMULATION_TEST(GIVEN_an_acl_assignment_cap_WHEN_many_entities_cross_at_once_THEN_requests_queue_and_authority_gaps_grow)
+{
+	// GIVEN
+	// All entities cross the boundary in the same tick.
+	constexpr int32 NumEntities = 20;
+	UGridBasedLBStrategy* Strat = CreateTwoRowStrategy();
+	FLBSimulationConfig Config = CreateConfig(5.f);
+	Config.MaxAclAssignmentsPerTick = 2;
+	FLBSimulation Simulation(*Strat, Config);
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		Simulation.AddEntity(FLBSimulation::MakePatrolTrace(FVector(-100.f, i * 100.f, 0.f), FVector(10000.f, i * 100.f, 0.f), 400.f));
+	}
+
+	// WHEN
+	const FLBSimulationReport Report = Simulation.Run();
+
+	// THEN
+	TestTrue("Every entity migrated once", Report.NumMigrations == NumEntities);
+	TestTrue("Requests beyond the cap were queued", Report.MaxQueuedAclAssignments > Config.MaxAclAssignmentsPerTick);
+	TestTrue("Queued requests waited longer for authority", Report.MaxAuthorityGap > Report.AverageAuthorityGap);
+	TestTrue("All entities ended on worker 2", Report.WorkerStats.Num() == 2 && Report.WorkerStats[1].FinalEntityCount == NumEntities);
+
+	return true;
+}
+
+LBSIMULATION_TEST(Scenario_random_walks_clustered_in_one_quadrant_with_grid_and_adaptive_strategies)
+{
+	// Logs a report for each strategy, so changes to a strategy can be compared on the same traces.
+	constexpr int32 NumEntities = 400;
+	constexpr float Duration = 120.f;
+	const FBox HotSpot(FVector(500.f, 500.f, 0.f), FVector(4500.f, 4500.f, 0.f));
+	const FBox World(FVector(-4500.f, -4500.f, 0.f), FVector(4500.f, 4500.f, 0.f));
+
+	UGridBasedLBStrategy* GridStrat = UTestGridBasedLBStrategy::Create(2, 2, 10000.f, 10000.f, 0.f, 100.f);
+	UAdaptiveLBStrategy* AdaptiveStrat = UTestAdaptiveLBStrategy::Create(4, 10000.f, 10000.f, 1000.f);
+
+	for (UAbstractLBStrategy* Strat : TArray<UAbstractLBStrategy*>{ GridStrat, AdaptiveStrat })
+	{
+		FLBSimulationConfig Config = CreateConfig(Duration);
+		Config.MinimumAuthorityDwellTime = 1.f;
+		FLBSimulation Simulation(*Strat, Config);
+
+		// Three quarters of the entities wander in one quadrant, the rest anywhere in the world.
+		for (int32 i = 0; i < NumEntities; i++)
+		{
+			Simulation.AddEntity(FLBSimulation::MakeRandomWalkTrace(i % 4 == 0 ? World : HotSpot, 300.f, i, Duration));
+		}
+
+		const FLBSimulationReport Report = Simulation.Run();
+		UE_LOG(LogLBSimulationTest, Display, TEXT("%s: %s"), *Strat->GetClass()->GetName(), *Report.ToString());
+
+		int32 NumAuthoritativeEntities = 0;
+		for (const FLBSimulationWorkerStats& Stats : Report.WorkerStats)
+		{
+			NumAuthoritativeEntities += Stats.FinalEntityCount;
+		}
+		TestTrue("No entity is owned by more than one worker", NumAuthoritativeEntities <= NumEntities);
+	}
+
+	return true;
+}
@@ -140,6 +140,16 @@ bool FSetOwnership::Update()
 	return true;
 }
 
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FClearOwnership, TSharedPtr<TestData>, Data, FName, ActorBeingOwnedHandle);
+bool FClearOwnership::Update()
+{
+	AActor* ActorBeingOwned = Data->TestActors[ActorBeingOwnedHandle];
+	AActor* OldOwner = ActorBeingOwned->GetOwner();
+	ActorBeingOwned->SetOwner(nullptr);
+	Data->LockingPolicy->OnOwnerUpdated(ActorBeingOwned, OldOwner);
+	return true;
+}
+
 DEFINE_LATENT_AUTOMATION_COMMAND_FIVE_PARAMETER(FAcquireLock, FAutomationTestBase*, Test, TSharedPtr<TestData>, Data, FName, ActorHandle, FString, DebugString, bool, bExpectedSuccess);
 bool FAcquireLock::Update()
 {
@@ -290,6 +300,15 @@ bool FTestIsLocked::Update()
 	return true;
 }
 
+DEFINE_LATENT_AUTOMATION_COMMAND_FOUR_PARAMETER(FTestIsInCachedHierarchy, FAutomationTestBase*, Test, TSharedPtr<TestData>, Data, FName, Handle, bool, bIsInCachedHierarchyExpected);
+bool FTestIsInCachedHierarchy::Update()
+{
+	const AActor* Actor = Data->TestActors[Handle];
+	const bool bIsInCachedHierarchy = Data->LockingPolicy->IsInCachedHierarchy(Actor);
+	Test->TestEqual(FString::Printf(TEXT("%s. Is in cached hierarchy. Actual: %d. Expected: %d"), *Handle.ToString(), bIsInCachedHierarchy, bIsInCachedHierarchyExpected), bIsInCachedHierarchy, bIsInCachedHierarchyExpected);
+	return true;
+}
+
 void SpawnABCDHierarchy(FAutomationTestBase* Test, TSharedPtr<TestData> Data)
 {
 	//        A 
@@ -986,6 +1005,70 @@ OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_AcquireLock_is_called_on_hierarchy_root_WHEN_h
 	return true;
 }
 
+OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_AcquireLock_is_called_on_leaf_hierarchy_Actor_WHEN_hierarchy_path_Actor_switches_owner_and_back_THEN_IsLocked_returns_correctly_for_all_Actors)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = MakeNewTestData();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+
+	SpawnABCDEHierarchy(this, Data);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FAcquireLock(this, Data, "C", "First lock", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetOwnership(Data, "B", "E"));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetOwnership(Data, "B", "A"));
+
+	//        A             E
+	//       / \
+	//      B   D
+	//     /
+	//  C (explicitly locked)
+
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "A", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "B", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "C", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "D", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "E", false));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FReleaseLock(this, Data, "C", "First lock", true));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "A", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "C", false));
+
+	return true;
+}
+
+OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_hierarchy_root_switches_owner_WHEN_AcquireLock_is_called_on_leaf_hierarchy_Actor_THEN_IsLocked_returns_correctly_for_all_Actors)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = MakeNewTestData();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+
+	SpawnABCDEHierarchy(this, Data);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FSetOwnership(Data, "A", "E"));
+	ADD_LATENT_AUTOMATION_COMMAND(FAcquireLock(this, Data, "C", "First lock", true));
+
+	//              E
+	//             /
+	//            A
+	//	    	 / \
+	//          B    D
+	//         /
+	//  C (explicitly locked)
+
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "A", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "B", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "C", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "D", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "E", true));
+
+	return true;
+}
+
 // AcquireLockDelegate and ReleaseLockDelegate
 
 OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_Actor_is_not_locked_WHEN_ReleaseLock_delegate_is_executed_THEN_it_errors_and_returns_false)
@@ -1061,3 +1144,53 @@ OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_AcquireLockDelegate_and_ReleaseLockDelegate_ar
 
 	return true;
 }
+
+// Cached ownership hierarchy
+
+OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_unlocked_Actor_has_an_owner_WHEN_its_owner_is_cleared_THEN_neither_Actor_is_in_the_cached_hierarchy)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = MakeNewTestData();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActor(Data, "Owner"));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActor(Data, "Owned"));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor(Data, "Owner"));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor(Data, "Owned"));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetOwnership(Data, "Owned", "Owner"));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsInCachedHierarchy(this, Data, "Owner", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsInCachedHierarchy(this, Data, "Owned", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FClearOwnership(Data, "Owned"));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsInCachedHierarchy(this, Data, "Owner", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsInCachedHierarchy(this, Data, "Owned", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "Owner", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "Owned", false));
+
+	return true;
+}
+
+OWNERSHIPLOCKINGPOLICY_TEST(GIVEN_locked_Actor_has_its_owner_cleared_WHEN_its_lock_is_released_THEN_it_is_no_longer_in_the_cached_hierarchy)
+{
+	AutomationOpenMap("/Engine/Maps/Entry");
+
+	TSharedPtr<TestData> Data = MakeNewTestData();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForWorld(Data));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActor(Data, "Owner"));
+	ADD_LATENT_AUTOMATION_COMMAND(FSpawnActor(Data, "Owned"));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor(Data, "Owner"));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitForActor(Data, "Owned"));
+	ADD_LATENT_AUTOMATION_COMMAND(FSetOwnership(Data, "Owned", "Owner"));
+	ADD_LATENT_AUTOMATION_COMMAND(FAcquireLock(this, Data, "Owned", "First lock", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FClearOwnership(Data, "Owned"));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsInCachedHierarchy(this, Data, "Owner", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsInCachedHierarchy(this, Data, "Owned", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "Owner", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "Owned", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FReleaseLock(this, Data, "Owned", "First lock", true));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsInCachedHierarchy(this, Data, "Owned", false));
+	ADD_LATENT_AUTOMATION_COMMAND(FTestIsLocked(this, Data, "Owned", false));
+
+	return true;
+}
@@ -0,0 +1,55 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "CoreMinimal.h"
+
+#include "Tests/TestDefinitions.h"
+#include "Schema/Interest.h"
+#include "SpatialConstants.h"
+
+#define INTEREST_TEST(TestName) \
+	GDK_TEST(Core, Interest, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+Interest CreateTestInterest(float Frequency, Worker_ComponentId LevelComponentId)
+{
+	QueryConstraint RadiusConstraint;
+	RadiusConstraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ 100.0 };
+
+	QueryConstraint LevelConstraint;
+	LevelConstraint.ComponentConstraint = LevelComponentId;
+
+	Query NewQuery;
+	NewQuery.Constraint.AndConstraint.Add(RadiusConstraint);
+	NewQuery.Constraint.AndConstraint.Add(LevelConstraint);
+	NewQuery.ResultComponentIds = ResultType{ SpatialConstants::POSITION_COMPONENT_ID, SpatialConstants::UNREAL_METADATA_COMPONENT_ID };
+	NewQuery.Frequency = Frequency;
+
+	Interest NewInterest;
+	NewInterest.ComponentInterestMap.FindOrAdd(SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID).Queries.Add(NewQuery);
+	return NewInterest;
+}
+
+} // anonymous namespace
+
+INTEREST_TEST(GIVEN_two_interests_built_the_same_way_WHEN_compared_THEN_they_are_equal)
+{
+	TestTrue("Identical interests are equal", CreateTestInterest(10.f, 10000) == CreateTestInterest(10.f, 10000));
+
+	return true;
+}
+
+INTEREST_TEST(GIVEN_two_interests_with_different_queries_WHEN_compared_THEN_they_are_not_equal)
+{
+	TestTrue("A different frequency makes interests different", CreateTestInterest(10.f, 10000) != CreateTestInterest(5.f, 10000));
+	TestTrue("A different nested constraint makes interests different", CreateTestInterest(10.f, 10000) != CreateTestInterest(10.f, 10001));
+
+	Interest InterestWithExtraQuery = CreateTestInterest(10.f, 10000);
+	InterestWithExtraQuery.ComponentInterestMap.FindOrAdd(SpatialConstants::POSITION_COMPONENT_ID).Queries.Add(Query());
+	TestTrue("An extra component interest makes interests different", CreateTestInterest(10.f, 10000) != InterestWithExtraQuery);
+
+	return true;
+}
@@ -71,5 +71,63 @@ namespace SpatialGDK
 
 		return true;
 	}
+
+	CHECKOUT_RADIUS_CONSTRAINT_TEST(GIVEN_pressure_within_hysteresis_WHEN_computing_frequency_distance_scale_THEN_scale_is_unchanged)
+	{
+		TestEqual("Scale is unchanged just over budget", NetCullDistanceInterest::ComputeFrequencyDistanceScale(0.5f, 1.05f, 0.25f, 0.1f), 0.5f);
+		TestEqual("Scale is unchanged just under budget", NetCullDistanceInterest::ComputeFrequencyDistanceScale(0.5f, 0.95f, 0.25f, 0.1f), 0.5f);
+
+		return true;
+	}
+
+	CHECKOUT_RADIUS_CONSTRAINT_TEST(GIVEN_pressure_outside_hysteresis_WHEN_computing_frequency_distance_scale_THEN_scale_follows_pressure_within_bounds)
+	{
+		TestEqual("Scale shrinks with the square root of the pressure", NetCullDistanceInterest::ComputeFrequencyDistanceScale(1.f, 4.f, 0.25f, 0.1f), 0.5f);
+		TestEqual("Scale grows back when under budget", NetCullDistanceInterest::ComputeFrequencyDistanceScale(0.5f, 0.25f, 0.25f, 0.1f), 1.f);
+		TestEqual("Scale doesn't shrink below the minimum", NetCullDistanceInterest::ComputeFrequencyDistanceScale(0.5f, 100.f, 0.25f, 0.1f), 0.25f);
+		TestEqual("Scale doesn't grow above 1", NetCullDistanceInterest::ComputeFrequencyDistanceScale(0.9f, 0.1f, 0.25f, 0.1f), 1.f);
+		TestEqual("No load resets the scale", NetCullDistanceInterest::ComputeFrequencyDistanceScale(0.5f, 0.f, 0.25f, 0.1f), 1.f);
+
+		return true;
+	}
+
+	CHECKOUT_RADIUS_CONSTRAINT_TEST(GIVEN_server_waiting_for_its_tick_rate_WHEN_computing_server_load_pressure_THEN_idle_time_is_not_counted)
+	{
+		// GIVEN
+		// 30 frames at 30 Hz, each spending 10ms working and the rest waiting for the next frame.
+		const uint32 NumFrames = 30;
+		const float MaxTickRate = 30.f;
+		const float FrameTime = NumFrames / MaxTickRate;
+		const float IdleTime = FrameTime - NumFrames * 0.01f;
+
+		// WHEN
+		const float Pressure = NetCullDistanceInterest::ComputeServerLoadPressure(FrameTime, IdleTime, NumFrames, MaxTickRate, 1.f);
+		const float HalfBudgetPressure = NetCullDistanceInterest::ComputeServerLoadPressure(FrameTime, IdleTime, NumFrames, MaxTickRate, 0.5f);
+
+		// THEN
+		TestEqual("Pressure is the busy time relative to the target frame time", Pressure, 0.3f, KINDA_SMALL_NUMBER);
+		TestEqual("Pressure is relative to the budget", HalfBudgetPressure, 0.6f, KINDA_SMALL_NUMBER);
+
+		return true;
+	}
+
+	CHECKOUT_RADIUS_CONSTRAINT_TEST(GIVEN_server_over_its_frame_time_WHEN_computing_server_load_pressure_THEN_pressure_is_over_budget)
+	{
+		// GIVEN
+		// 10 frames at a target of 30 Hz, each taking 50ms without waiting.
+		const uint32 NumFrames = 10;
+		const float FrameTime = NumFrames * 0.05f;
+
+		// WHEN
+		const float Pressure = NetCullDistanceInterest::ComputeServerLoadPressure(FrameTime, 0.f, NumFrames, 30.f, 1.f);
+
+		// THEN
+		TestEqual("Pressure is over budget", Pressure, 1.5f, KINDA_SMALL_NUMBER);
+		TestEqual("No frames give no pressure", NetCullDistanceInterest::ComputeServerLoadPressure(0.f, 0.f, 0, 30.f, 1.f), 0.f);
+		TestEqual("No budget gives no pressure", NetCullDistanceInterest::ComputeServerLoadPressure(FrameTime, 0.f, NumFrames, 30.f, 0.f), 0.f);
+		TestEqual("No max tick rate gives no pressure", NetCullDistanceInterest::ComputeServerLoadPressure(FrameTime, 0.f, NumFrames, 0.f, 1.f), 0.f);
+
+		return true;
+	}
 }
 
@@ -0,0 +1,159 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Schema/UnrealObjectRef.h"
+#include "Utils/FlatLookupTable.h"
+
+#define FLATLOOKUPTABLE_TEST(TestName) \
+	GDK_TEST(Core, TFlatLookupTable, TestName)
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGDKFlatLookupTableTest, Log, All);
+DEFINE_LOG_CATEGORY(LogSpatialGDKFlatLookupTableTest);
+
+namespace SpatialGDK
+{
+
+FLATLOOKUPTABLE_TEST(GIVEN_empty_table_WHEN_key_is_added_THEN_it_can_be_found)
+{
+	FEntityOffsetToNetGUIDTable Table;
+	Table.Add(FEntityOffsetKey(10, 0), FNetworkGUID(42));
+
+	const FNetworkGUID* Found = Table.Find(FEntityOffsetKey(10, 0));
+	TestTrue("Added key is found", Found != nullptr && *Found == FNetworkGUID(42));
+	TestTrue("Key with a different offset is not found", Table.Find(FEntityOffsetKey(10, 1)) == nullptr);
+	TestEqual("Table has one element", Table.Num(), 1);
+
+	return true;
+}
+
+FLATLOOKUPTABLE_TEST(GIVEN_existing_key_WHEN_key_is_added_again_THEN_value_is_overwritten)
+{
+	FEntityOffsetToNetGUIDTable Table;
+	Table.Add(FEntityOffsetKey(10, 3), FNetworkGUID(42));
+	Table.Add(FEntityOffsetKey(10, 3), FNetworkGUID(43));
+
+	const FNetworkGUID* Found = Table.Find(FEntityOffsetKey(10, 3));
+	TestTrue("Value was overwritten", Found != nullptr && *Found == FNetworkGUID(43));
+	TestEqual("Table has one element", Table.Num(), 1);
+
+	return true;
+}
+
+FLATLOOKUPTABLE_TEST(GIVEN_many_keys_WHEN_half_are_removed_THEN_remaining_keys_are_still_found)
+{
+	const int32 NumEntities = 5000;
+	const uint32 NumOffsets = 4;
+
+	FEntityOffsetToNetGUIDTable Table;
+	for (int32 Entity = 1; Entity <= NumEntities; Entity++)
+	{
+		for (uint32 Offset = 0; Offset < NumOffsets; Offset++)
+		{
+			Table.Add(FEntityOffsetKey(Entity, Offset), FNetworkGUID(Entity * NumOffsets + Offset));
+		}
+	}
+
+	for (int32 Entity = 1; Entity <= NumEntities; Entity += 2)
+	{
+		for (uint32 Offset = 0; Offset < NumOffsets; Offset++)
+		{
+			TestTrue("Existing key is removed", Table.Remove(FEntityOffsetKey(Entity, Offset)));
+		}
+	}
+
+	TestEqual("Half of the elements remain", Table.Num(), static_cast<int32>(NumEntities / 2 * NumOffsets));
+
+	bool bAllCorrect = true;
+	for (int32 Entity = 1; Entity <= NumEntities; Entity++)
+	{
+		for (uint32 Offset = 0; Offset < NumOffsets; Offset++)
+		{
+			const FNetworkGUID* Found = Table.Find(FEntityOffsetKey(Entity, Offset));
+			const bool bShouldExist = Entity % 2 == 0;
+			bAllCorrect &= bShouldExist ? (Found != nullptr && *Found == FNetworkGUID(Entity * NumOffsets + Offset)) : Found == nullptr;
+		}
+	}
+	TestTrue("Only the removed keys are missing", bAllCorrect);
+
+	return true;
+}
+
+FLATLOOKUPTABLE_TEST(GIVEN_invalid_netguid_WHEN_looked_up_THEN_nothing_is_found)
+{
+	FNetGUIDToEntityRefTable Table;
+	Table.Add(FNetworkGUID(7), FUnrealObjectRef(1, 2));
+
+	TestTrue("Invalid NetGUID is never found", Table.Find(FNetworkGUID()) == nullptr);
+	TestFalse("Removing an absent key fails", Table.Remove(FNetworkGUID(8)));
+
+	return true;
+}
+
+// Compares lookup cost against the TMap<FUnrealObjectRef, FNetworkGUID> that FSpatialNetGUIDCache used for entity refs.
+// Results are logged rather than asserted on, since timings depend on the machine running the test.
+FLATLOOKUPTABLE_TEST(Benchmark_entity_ref_lookups_against_TMap)
+{
+	const int32 NumEntities = 20000;
+	const uint32 NumOffsets = 8;
+	const int32 NumPasses = 10;
+
+	TMap<FUnrealObjectRef, FNetworkGUID> Map;
+	FEntityOffsetToNetGUIDTable Table;
+	Table.Reserve(NumEntities * NumOffsets);
+	Map.Reserve(NumEntities * NumOffsets);
+
+	for (int32 Entity = 1; Entity <= NumEntities; Entity++)
+	{
+		for (uint32 Offset = 0; Offset < NumOffsets; Offset++)
+		{
+			const FNetworkGUID NetGUID(Entity * NumOffsets + Offset);
+			Map.Add(FUnrealObjectRef(Entity, Offset), NetGUID);
+			Table.Add(FEntityOffsetKey(Entity, Offset), NetGUID);
+		}
+	}
+
+	uint64 MapChecksum = 0;
+	const double MapStart = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; Pass++)
+	{
+		for (int32 Entity = 1; Entity <= NumEntities; Entity++)
+		{
+			for (uint32 Offset = 0; Offset < NumOffsets; Offset++)
+			{
+				if (const FNetworkGUID* Found = Map.Find(FUnrealObjectRef(Entity, Offset)))
+				{
+					MapChecksum += GetTypeHash(*Found);
+				}
+			}
+		}
+	}
+	const double MapSeconds = FPlatformTime::Seconds() - MapStart;
+
+	uint64 TableChecksum = 0;
+	const double TableStart = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; Pass++)
+	{
+		for (int32 Entity = 1; Entity <= NumEntities; Entity++)
+		{
+			for (uint32 Offset = 0; Offset < NumOffsets; Offset++)
+			{
+				if (const FNetworkGUID* Found = Table.Find(FEntityOffsetKey(Entity, Offset)))
+				{
+					TableChecksum += GetTypeHash(*Found);
+				}
+			}
+		}
+	}
+	const double TableSeconds = FPlatformTime::Seconds() - TableStart;
+
+	TestTrue("Both containers return the same values", TableChecksum == MapChecksum);
+
+	const int32 NumLookups = NumEntities * static_cast<int32>(NumOffsets) * NumPasses;
+	UE_LOG(LogSpatialGDKFlatLookupTableTest, Display, TEXT("%d lookups: TMap %.3f ms, TFlatLookupTable %.3f ms"),
+		NumLookups, MapSeconds * 1000.0, TableSeconds * 1000.0);
+
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -0,0 +1,102 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "CoreMinimal.h"
+
+#include "Tests/TestDefinitions.h"
+#include "SpatialConstants.h"
+#include "Utils/Interest/InterestCostAnalyser.h"
+
+#define INTEREST_COST_ANALYSER_TEST(TestName) \
+	GDK_TEST(Core, InterestCostAnalyser, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const Worker_ComponentId InterestedComponentId = 10000;
+const Worker_ComponentId DataComponentId = 10001;
+const Worker_ComponentId DetailComponentId = 10002;
+
+FInterestCostEntity CreateEntity(Worker_EntityId EntityId, const Coordinates& Position)
+{
+	FInterestCostEntity Entity;
+	Entity.EntityId = EntityId;
+	Entity.Position = Position;
+	Entity.ComponentSizes.Add(DataComponentId, 100);
+	Entity.ComponentSizes.Add(DetailComponentId, 1000);
+	return Entity;
+}
+
+Query CreateRadiusQuery(double Radius, float Frequency, const ResultType& ResultComponentIds)
+{
+	Query NewQuery;
+	NewQuery.Constraint.RelativeCylinderConstraint = RelativeCylinderConstraint{ Radius };
+	NewQuery.ResultComponentIds = ResultComponentIds;
+	if (Frequency > 0.f)
+	{
+		NewQuery.Frequency = Frequency;
+	}
+	return NewQuery;
+}
+
+} // anonymous namespace
+
+INTEREST_COST_ANALYSER_TEST(GIVEN_nested_constraints_WHEN_get_complexity_THEN_counts_every_constraint_and_the_depth)
+{
+	QueryConstraint Leaf;
+	Leaf.ComponentConstraint = DataComponentId;
+
+	QueryConstraint Or;
+	Or.OrConstraint.Add(Leaf);
+	Or.OrConstraint.Add(Leaf);
+
+	QueryConstraint Root;
+	Root.AndConstraint.Add(Or);
+	Root.AndConstraint.Add(Leaf);
+
+	int32 NumConstraints = 0;
+	int32 Depth = 0;
+	InterestCostAnalyser::GetConstraintComplexity(Root, NumConstraints, Depth);
+
+	TestEqual("Number of constraints", NumConstraints, 5);
+	TestEqual("Depth", Depth, 3);
+
+	return true;
+}
+
+INTEREST_COST_ANALYSER_TEST(GIVEN_frequency_tiers_WHEN_analysed_THEN_components_are_counted_once_at_their_highest_frequency)
+{
+	Interest TestInterest;
+	ComponentInterest& InterestedComponentQueries = TestInterest.ComponentInterestMap.Add(InterestedComponentId);
+	// Everything within 10m at full frequency, and the data component only within 100m at 1Hz.
+	InterestedComponentQueries.Queries.Add(CreateRadiusQuery(10.0, 0.f, { DataComponentId, DetailComponentId }));
+	InterestedComponentQueries.Queries.Add(CreateRadiusQuery(100.0, 1.f, { DataComponentId }));
+
+	TArray<FInterestCostEntity> Entities;
+	Entities.Add(CreateEntity(1, Coordinates{ 5, 0, 0 }));
+	Entities.Add(CreateEntity(2, Coordinates{ 50, 0, 0 }));
+	Entities.Add(CreateEntity(3, Coordinates{ 500, 0, 0 }));
+
+	const FInterestCostReport Report = InterestCostAnalyser::Analyse(TestInterest, DeploymentOrigin, Entities);
+
+	TestEqual("Number of queries", Report.Queries.Num(), 2);
+	TestEqual("Checked out entities", Report.NumCheckedOutEntities, 2);
+	TestTrue("Total bytes", Report.TotalBytes == 1100 + 100);
+
+	TestEqual("Number of tiers", Report.Tiers.Num(), 2);
+	if (Report.Tiers.Num() != 2)
+	{
+		return true;
+	}
+
+	TestEqual("Full frequency tier is first", Report.Tiers[0].Frequency, 0.f);
+	TestEqual("Entities at full frequency", Report.Tiers[0].NumEntities, 1);
+	TestTrue("Bytes at full frequency", Report.Tiers[0].Bytes == 1100);
+
+	TestEqual("Low frequency tier", Report.Tiers[1].Frequency, 1.f);
+	TestEqual("Entities at low frequency", Report.Tiers[1].NumEntities, 1);
+	TestTrue("The nearby entity's data is not counted again at low frequency", Report.Tiers[1].Bytes == 100);
+
+	return true;
+}
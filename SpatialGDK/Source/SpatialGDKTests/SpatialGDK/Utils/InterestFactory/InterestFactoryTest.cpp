@@ -0,0 +1,359 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/Components/ActorInterestComponent.h"
+#include "EngineClasses/SpatialNetConnection.h"
+#include "Interop/SpatialClassInfoManager.h"
+#include "Interop/SpatialInterestConstraints.h"
+#include "SpatialGDKSettings.h"
+#include "SpatialGDKTests/SpatialGDKEditor/SpatialGDKEditorSchemaGenerator/SchemaGenObjectStub.h"
+#include "Utils/InterestFactory.h"
+#include "Utils/SchemaDatabase.h"
+
+#include "GameFramework/Actor.h"
+
+#define INTERESTFACTORY_TEST(TestName) \
+	GDK_TEST(Core, InterestFactory, TestName)
+
+namespace
+{
+
+constexpr float TestFrequency = 10.f;
+
+constexpr float LowDetailInterestFrequency = 1.f;
+constexpr Worker_ComponentId NetCullDistanceComponentId = 10000;
+constexpr Worker_ComponentId UnknownNetCullDistanceComponentId = 10001;
+constexpr Worker_ComponentId ActorDataComponentId = 10002;
+constexpr Worker_ComponentId OtherDataComponentId = 10003;
+
+const FName FirstLevelName(TEXT("/Game/Maps/FirstSublevel"));
+const FName SecondLevelName(TEXT("/Game/Maps/SecondSublevel"));
+constexpr Worker_ComponentId FirstLevelComponentId = 10004;
+constexpr Worker_ComponentId SecondLevelComponentId = 10005;
+
+// A class info manager with an empty schema database, so the factory has no generated components to add to its queries.
+USpatialClassInfoManager* CreateClassInfoManager()
+{
+	USpatialClassInfoManager* ClassInfoManager = NewObject<USpatialClassInfoManager>();
+	ClassInfoManager->SchemaDatabase = NewObject<USchemaDatabase>();
+	return ClassInfoManager;
+}
+
+void AddSphereQuery(UActorInterestComponent& ActorInterestComponent)
+{
+	FQueryData QueryData;
+	QueryData.Constraint = NewObject<USphereConstraint>(&ActorInterestComponent);
+	QueryData.Frequency = TestFrequency;
+	ActorInterestComponent.Queries.Add(QueryData);
+}
+
+UActorInterestComponent* AddActorInterestComponent(AActor& Actor)
+{
+	UActorInterestComponent* ActorInterestComponent = NewObject<UActorInterestComponent>(&Actor);
+	AddSphereQuery(*ActorInterestComponent);
+	return ActorInterestComponent;
+}
+
+int32 CountConstraints(const SpatialGDK::FrequencyToConstraintsMap& FrequencyToConstraints)
+{
+	const TArray<SpatialGDK::QueryConstraint>* Constraints = FrequencyToConstraints.Find(TestFrequency);
+	return Constraints != nullptr ? Constraints->Num() : 0;
+}
+
+// Enables low detail distant interest for the lifetime of the fixture.
+class FLowDetailInterestTestFixture
+{
+public:
+	FLowDetailInterestTestFixture()
+	{
+		USpatialGDKSettings* SpatialGDKSettings = GetMutableDefault<USpatialGDKSettings>();
+		bCachedEnableLowDetailDistantInterest = SpatialGDKSettings->bEnableLowDetailDistantInterest;
+		bCachedEnableResultTypes = SpatialGDKSettings->bEnableResultTypes;
+		CachedLowDetailInterestFrequency = SpatialGDKSettings->LowDetailInterestFrequency;
+
+		SpatialGDKSettings->bEnableLowDetailDistantInterest = true;
+		SpatialGDKSettings->bEnableResultTypes = true;
+		SpatialGDKSettings->LowDetailInterestFrequency = LowDetailInterestFrequency;
+	}
+
+	~FLowDetailInterestTestFixture()
+	{
+		USpatialGDKSettings* SpatialGDKSettings = GetMutableDefault<USpatialGDKSettings>();
+		SpatialGDKSettings->bEnableLowDetailDistantInterest = bCachedEnableLowDetailDistantInterest;
+		SpatialGDKSettings->bEnableResultTypes = bCachedEnableResultTypes;
+		SpatialGDKSettings->LowDetailInterestFrequency = CachedLowDetailInterestFrequency;
+	}
+
+private:
+	bool bCachedEnableLowDetailDistantInterest;
+	bool bCachedEnableResultTypes;
+	float CachedLowDetailInterestFrequency;
+};
+
+// A schema database with a net cull distance marker component for ASpatialTypeActor's default net cull distance.
+USpatialClassInfoManager* CreateClassInfoManagerWithNetCullDistanceComponent()
+{
+	USpatialClassInfoManager* ClassInfoManager = CreateClassInfoManager();
+
+	FActorSchemaData ActorSchemaData;
+	ActorSchemaData.SchemaComponents[SCHEMA_Data] = ActorDataComponentId;
+	ClassInfoManager->SchemaDatabase->ActorClassPathToSchema.Add(ASpatialTypeActor::StaticClass()->GetPathName(), ActorSchemaData);
+	ClassInfoManager->SchemaDatabase->NetCullDistanceToComponentId.Add(GetDefault<ASpatialTypeActor>()->NetCullDistanceSquared, NetCullDistanceComponentId);
+	ClassInfoManager->SchemaDatabase->DataComponentIds = { ActorDataComponentId, OtherDataComponentId };
+
+	return ClassInfoManager;
+}
+
+SpatialGDK::QueryConstraint CreateComponentConstraint(Worker_ComponentId ComponentId)
+{
+	SpatialGDK::QueryConstraint ComponentConstraint;
+	ComponentConstraint.ComponentConstraint = ComponentId;
+
+	SpatialGDK::QueryConstraint RadiusConstraint;
+	RadiusConstraint.RelativeCylinderConstraint = SpatialGDK::RelativeCylinderConstraint{ 100.f };
+
+	SpatialGDK::QueryConstraint Constraint;
+	Constraint.AndConstraint.Add(RadiusConstraint);
+	Constraint.AndConstraint.Add(ComponentConstraint);
+	return Constraint;
+}
+
+// A schema database with a streaming level component for each of the test levels.
+USpatialClassInfoManager* CreateClassInfoManagerWithLevelComponents()
+{
+	USpatialClassInfoManager* ClassInfoManager = CreateClassInfoManager();
+	ClassInfoManager->SchemaDatabase->LevelPathToComponentId.Add(FirstLevelName.ToString(), FirstLevelComponentId);
+	ClassInfoManager->SchemaDatabase->LevelPathToComponentId.Add(SecondLevelName.ToString(), SecondLevelComponentId);
+	return ClassInfoManager;
+}
+
+// The component IDs a level constraint accepts, in order.
+TArray<uint32> GetLevelConstraintComponentIds(const SpatialGDK::QueryConstraint& LevelConstraint)
+{
+	TArray<uint32> ComponentIds;
+	for (const SpatialGDK::QueryConstraint& Constraint : LevelConstraint.OrConstraint)
+	{
+		if (Constraint.ComponentConstraint.IsSet())
+		{
+			ComponentIds.Add(Constraint.ComponentConstraint.GetValue());
+		}
+	}
+	return ComponentIds;
+}
+
+} // anonymous namespace
+
+INTERESTFACTORY_TEST(GIVEN_collected_user_defined_constraints_WHEN_collected_again_without_changes_THEN_cached_constraints_are_returned)
+{
+	// GIVEN
+	SpatialGDK::InterestFactory Factory(CreateClassInfoManager(), nullptr);
+	AActor* Actor = NewObject<AActor>();
+	UActorInterestComponent* ActorInterestComponent = AddActorInterestComponent(*Actor);
+	const int32 NumConstraints = CountConstraints(Factory.GetUserDefinedFrequencyToConstraintsMap(Actor));
+
+	// WHEN
+	// Queries changed without invalidating the constraints are not picked up.
+	AddSphereQuery(*ActorInterestComponent);
+	const int32 NumCachedConstraints = CountConstraints(Factory.GetUserDefinedFrequencyToConstraintsMap(Actor));
+
+	// THEN
+	TestEqual("The component's constraint is collected", NumConstraints, 1);
+	TestEqual("The cached constraints are returned", NumCachedConstraints, 1);
+
+	return true;
+}
+
+INTERESTFACTORY_TEST(GIVEN_collected_user_defined_constraints_WHEN_the_component_queries_are_invalidated_THEN_the_new_queries_are_collected)
+{
+	// GIVEN
+	SpatialGDK::InterestFactory Factory(CreateClassInfoManager(), nullptr);
+	AActor* Actor = NewObject<AActor>();
+	UActorInterestComponent* ActorInterestComponent = AddActorInterestComponent(*Actor);
+	Factory.GetUserDefinedFrequencyToConstraintsMap(Actor);
+
+	// WHEN
+	AddSphereQuery(*ActorInterestComponent);
+	ActorInterestComponent->InvalidateCompiledConstraints();
+	// The Actor has no net driver in this test, so the factory is notified directly.
+	Factory.OnUserDefinedInterestChanged(Actor);
+
+	// THEN
+	TestEqual("Both constraints are collected", CountConstraints(Factory.GetUserDefinedFrequencyToConstraintsMap(Actor)), 2);
+
+	return true;
+}
+
+INTERESTFACTORY_TEST(GIVEN_collected_user_defined_constraints_of_a_hierarchy_WHEN_a_component_is_added_to_an_owned_actor_THEN_the_owner_constraints_include_it)
+{
+	// GIVEN
+	SpatialGDK::InterestFactory Factory(CreateClassInfoManager(), nullptr);
+	AActor* Owner = NewObject<AActor>();
+	AActor* OwnedActor = NewObject<AActor>();
+	OwnedActor->SetOwner(Owner);
+
+	const int32 NumConstraintsBefore = CountConstraints(Factory.GetUserDefinedFrequencyToConstraintsMap(Owner));
+
+	// WHEN
+	AddActorInterestComponent(*OwnedActor);
+	Factory.OnUserDefinedInterestChanged(OwnedActor);
+
+	// THEN
+	TestEqual("There are no constraints before the component is added", NumConstraintsBefore, 0);
+	TestEqual("The added component's constraint is collected for the owner", CountConstraints(Factory.GetUserDefinedFrequencyToConstraintsMap(Owner)), 1);
+
+	return true;
+}
+
+INTERESTFACTORY_TEST(GIVEN_collected_user_defined_constraints_WHEN_the_component_is_removed_THEN_its_constraints_are_dropped)
+{
+	// GIVEN
+	SpatialGDK::InterestFactory Factory(CreateClassInfoManager(), nullptr);
+	AActor* Actor = NewObject<AActor>();
+	UActorInterestComponent* ActorInterestComponent = AddActorInterestComponent(*Actor);
+	const int32 NumConstraintsBefore = CountConstraints(Factory.GetUserDefinedFrequencyToConstraintsMap(Actor));
+
+	// WHEN
+	ActorInterestComponent->DestroyComponent();
+	Factory.OnUserDefinedInterestChanged(Actor);
+
+	// THEN
+	TestEqual("The component's constraint is collected before it is removed", NumConstraintsBefore, 1);
+	TestEqual("No constraints are collected once the component is removed", CountConstraints(Factory.GetUserDefinedFrequencyToConstraintsMap(Actor)), 0);
+
+	return true;
+}
+
+INTERESTFACTORY_TEST(GIVEN_low_detail_distant_interest_WHEN_checking_bucket_frequencies_THEN_only_buckets_at_or_below_the_low_detail_frequency_use_it)
+{
+	// GIVEN
+	FLowDetailInterestTestFixture Fixture;
+	SpatialGDK::InterestFactory Factory(CreateClassInfoManager(), nullptr);
+
+	// WHEN
+	const bool bFullFrequency = Factory.ShouldUseLowDetailResultType(TSchemaOption<float>());
+	const bool bAboveLowDetailFrequency = Factory.ShouldUseLowDetailResultType(TSchemaOption<float>(LowDetailInterestFrequency * 2.f));
+	const bool bAtLowDetailFrequency = Factory.ShouldUseLowDetailResultType(TSchemaOption<float>(LowDetailInterestFrequency));
+	const bool bBelowLowDetailFrequency = Factory.ShouldUseLowDetailResultType(TSchemaOption<float>(LowDetailInterestFrequency / 2.f));
+
+	// THEN
+	TestFalse("The full frequency bucket doesn't use the low detail result type", bFullFrequency);
+	TestFalse("A bucket above the low detail frequency doesn't use the low detail result type", bAboveLowDetailFrequency);
+	TestTrue("A bucket at the low detail frequency uses the low detail result type", bAtLowDetailFrequency);
+	TestTrue("A bucket below the low detail frequency uses the low detail result type", bBelowLowDetailFrequency);
+
+	// WHEN
+	GetMutableDefault<USpatialGDKSettings>()->bEnableLowDetailDistantInterest = false;
+
+	// THEN
+	TestFalse("No bucket uses the low detail result type when disabled", Factory.ShouldUseLowDetailResultType(TSchemaOption<float>(LowDetailInterestFrequency)));
+
+	return true;
+}
+
+INTERESTFACTORY_TEST(GIVEN_marker_component_of_a_loaded_actor_class_WHEN_creating_the_low_detail_result_type_THEN_it_contains_the_required_and_actor_data_components)
+{
+	// GIVEN
+	FLowDetailInterestTestFixture Fixture;
+	SpatialGDK::InterestFactory Factory(CreateClassInfoManagerWithNetCullDistanceComponent(), nullptr);
+
+	// WHEN
+	const SpatialGDK::ResultType LowDetailResultType = Factory.CreateClientLowDetailInterestResultType(CreateComponentConstraint(NetCullDistanceComponentId));
+
+	// THEN
+	bool bHasRequiredComponents = true;
+	for (const Worker_ComponentId ComponentId : SpatialConstants::REQUIRED_COMPONENTS_FOR_NON_AUTH_CLIENT_INTEREST)
+	{
+		bHasRequiredComponents &= LowDetailResultType.Contains(ComponentId);
+	}
+	TestTrue("The required components are in the result type", bHasRequiredComponents);
+	TestTrue("The Actor data component is in the result type", LowDetailResultType.Contains(ActorDataComponentId));
+	TestFalse("Other data components are not in the result type", LowDetailResultType.Contains(OtherDataComponentId));
+
+	return true;
+}
+
+INTERESTFACTORY_TEST(GIVEN_marker_component_without_a_loaded_actor_class_WHEN_creating_the_low_detail_result_type_THEN_the_full_client_result_type_is_used)
+{
+	// GIVEN
+	FLowDetailInterestTestFixture Fixture;
+	SpatialGDK::InterestFactory Factory(CreateClassInfoManagerWithNetCullDistanceComponent(), nullptr);
+
+	// WHEN
+	const SpatialGDK::ResultType ResultType = Factory.CreateClientLowDetailInterestResultType(CreateComponentConstraint(UnknownNetCullDistanceComponentId));
+
+	// THEN
+	TestTrue("The Actor data component is in the result type", ResultType.Contains(ActorDataComponentId));
+	TestTrue("Other data components are in the result type", ResultType.Contains(OtherDataComponentId));
+
+	return true;
+}
+
+INTERESTFACTORY_TEST(GIVEN_connection_without_cached_level_constraint_WHEN_level_constraint_requested_THEN_it_is_cached_and_matches_the_uncached_constraint)
+{
+	// GIVEN
+	USpatialClassInfoManager* ClassInfoManager = CreateClassInfoManagerWithLevelComponents();
+	SpatialGDK::InterestFactory Factory(ClassInfoManager, nullptr);
+	USpatialNetConnection* Connection = NewObject<USpatialNetConnection>();
+	Connection->ClientVisibleLevelNames.Add(FirstLevelName);
+	Connection->ClientVisibleLevelNames.Add(SecondLevelName);
+
+	// WHEN
+	const SpatialGDK::QueryConstraint LevelConstraint = Factory.GetCachedLevelConstraint(*Connection);
+
+	// THEN
+	TArray<uint32> ExpectedComponentIds = { SpatialConstants::NOT_STREAMED_COMPONENT_ID };
+	for (const FName& LevelName : Connection->ClientVisibleLevelNames)
+	{
+		ExpectedComponentIds.Add(ClassInfoManager->GetComponentIdFromLevelPath(LevelName.ToString()));
+	}
+
+	TestTrue("The level constraint is cached on the connection", Connection->CachedLevelConstraint.IsSet());
+	TestTrue("The level constraint accepts the components found by level path", GetLevelConstraintComponentIds(LevelConstraint) == ExpectedComponentIds);
+	TestTrue("The level constraint is the same as the uncached one",
+		GetLevelConstraintComponentIds(LevelConstraint) == GetLevelConstraintComponentIds(Factory.CreateLevelConstraint(Connection->ClientVisibleLevelNames)));
+
+	return true;
+}
+
+INTERESTFACTORY_TEST(GIVEN_cached_level_constraint_WHEN_level_constraint_requested_again_THEN_cached_constraint_is_returned)
+{
+	// GIVEN
+	SpatialGDK::InterestFactory Factory(CreateClassInfoManagerWithLevelComponents(), nullptr);
+	USpatialNetConnection* Connection = NewObject<USpatialNetConnection>();
+	Connection->ClientVisibleLevelNames.Add(FirstLevelName);
+	Factory.GetCachedLevelConstraint(*Connection);
+
+	// WHEN
+	// Changing the visible levels directly doesn't reset the cache, so the constraint can only come from the cache.
+	Connection->ClientVisibleLevelNames.Add(SecondLevelName);
+	const SpatialGDK::QueryConstraint LevelConstraint = Factory.GetCachedLevelConstraint(*Connection);
+
+	// THEN
+	const TArray<uint32> ExpectedComponentIds = { SpatialConstants::NOT_STREAMED_COMPONENT_ID, FirstLevelComponentId };
+	TestTrue("The cached level constraint is returned", GetLevelConstraintComponentIds(LevelConstraint) == ExpectedComponentIds);
+
+	return true;
+}
+
+INTERESTFACTORY_TEST(GIVEN_cached_level_constraint_WHEN_level_visibility_changes_THEN_level_constraint_is_rebuilt)
+{
+	// GIVEN
+	SpatialGDK::InterestFactory Factory(CreateClassInfoManagerWithLevelComponents(), nullptr);
+	USpatialNetConnection* Connection = NewObject<USpatialNetConnection>();
+	Connection->ClientVisibleLevelNames.Add(FirstLevelName);
+	Factory.GetCachedLevelConstraint(*Connection);
+
+	// WHEN
+	// UpdateLevelVisibility updates the visible levels and resets the cache, then sends an interest update through the net driver.
+	Connection->ClientVisibleLevelNames.Add(SecondLevelName);
+	Connection->ResetCachedLevelConstraint();
+	const SpatialGDK::QueryConstraint LevelConstraint = Factory.GetCachedLevelConstraint(*Connection);
+
+	// THEN
+	TestTrue("The level constraint is rebuilt with the new level",
+		GetLevelConstraintComponentIds(LevelConstraint) == GetLevelConstraintComponentIds(Factory.CreateLevelConstraint(Connection->ClientVisibleLevelNames)));
+	TestTrue("The new level's component is in the level constraint", GetLevelConstraintComponentIds(LevelConstraint).Contains(SecondLevelComponentId));
+
+	return true;
+}
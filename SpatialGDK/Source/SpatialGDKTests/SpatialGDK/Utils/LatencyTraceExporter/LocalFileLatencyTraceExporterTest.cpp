@@ -0,0 +1,55 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Serialization/MemoryWriter.h"
+#include "Utils/LatencyTraceExporter.h"
+
+#define LOCALFILELATENCYTRACEEXPORTER_TEST(TestName) \
+	GDK_TEST(Core, FLocalFileLatencyTraceExporter, TestName)
+
+namespace SpatialGDK
+{
+
+namespace
+{
+	FLatencyTraceSpan CreateSpan(uint8 FirstTraceIdByte)
+	{
+		FLatencyTraceSpan Span;
+		Span.Name = TEXT("Test span");
+		Span.TraceId = { FirstTraceIdByte, FirstTraceIdByte, FirstTraceIdByte, FirstTraceIdByte };
+		Span.Key = 1;
+		Span.StartTimeMicros = 1000;
+		Span.DurationMicros = 50;
+		return Span;
+	}
+} // anonymous namespace
+
+LOCALFILELATENCYTRACEEXPORTER_TEST(GIVEN_full_sample_rate_WHEN_buffer_fills_up_THEN_spans_are_written_out)
+{
+	TArray<uint8> Buffer;
+	FLocalFileLatencyTraceExporter Exporter(MakeUnique<FMemoryWriter>(Buffer), TEXT("TestWorker"), 1.f, 2);
+	const int32 HeaderSize = Buffer.Num();
+
+	Exporter.ExportSpan(CreateSpan(0x10));
+	TestTrue("Spans are buffered until the buffer is full", Buffer.Num() == HeaderSize && Exporter.GetNumSpansWritten() == 0);
+
+	Exporter.ExportSpan(CreateSpan(0x20));
+	TestTrue("Spans are written once the buffer is full", Buffer.Num() > HeaderSize && Exporter.GetNumSpansWritten() == 2);
+
+	return true;
+}
+
+LOCALFILELATENCYTRACEEXPORTER_TEST(GIVEN_partial_sample_rate_WHEN_traces_are_sampled_THEN_decision_depends_only_on_trace_id)
+{
+	const TArray<uint8> LowTraceId = { 0x00, 0x00, 0x00, 0x01 };
+	const TArray<uint8> HighTraceId = { 0xFF, 0xFF, 0xFF, 0xFF };
+
+	TestTrue("Low trace ID is sampled", FLocalFileLatencyTraceExporter::IsTraceSampled(LowTraceId, 0.5f));
+	TestFalse("High trace ID is not sampled", FLocalFileLatencyTraceExporter::IsTraceSampled(HighTraceId, 0.5f));
+	TestFalse("Nothing is sampled at a zero rate", FLocalFileLatencyTraceExporter::IsTraceSampled(LowTraceId, 0.f));
+
+	return true;
+}
+
+} // namespace SpatialGDK
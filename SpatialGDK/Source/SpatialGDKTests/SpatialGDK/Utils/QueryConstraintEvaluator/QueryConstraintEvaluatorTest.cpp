@@ -0,0 +1,135 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "CoreMinimal.h"
+
+#include "Tests/TestDefinitions.h"
+#include "SpatialConstants.h"
+#include "Utils/Interest/QueryConstraintEvaluator.h"
+
+#define QUERY_CONSTRAINT_EVALUATOR_TEST(TestName) \
+	GDK_TEST(Core, QueryConstraintEvaluator, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+const Worker_EntityId TestEntityId = 10;
+const Worker_ComponentId TestComponentId = 10000;
+const Worker_ComponentId OtherComponentId = 10001;
+
+bool HasTestComponent(Worker_ComponentId ComponentId)
+{
+	return ComponentId == TestComponentId;
+}
+
+bool IsInConstraint(const QueryConstraint& Constraint, const Coordinates& EntityPosition, const Coordinates& QueryOrigin = DeploymentOrigin)
+{
+	return QueryConstraintEvaluator::IsEntityInConstraint(Constraint, TestEntityId, EntityPosition, HasTestComponent, QueryOrigin);
+}
+
+} // anonymous namespace
+
+QUERY_CONSTRAINT_EVALUATOR_TEST(GIVEN_spatial_constraints_WHEN_evaluated_THEN_match_positions_inside_them)
+{
+	QueryConstraint Sphere;
+	Sphere.SphereConstraint = SphereConstraint{ Coordinates{ 10, 0, 0 }, 5.0 };
+	TestTrue("Entity inside the sphere matches", IsInConstraint(Sphere, Coordinates{ 13, 3, 0 }));
+	TestFalse("Entity outside the sphere doesn't match", IsInConstraint(Sphere, Coordinates{ 13, 5, 0 }));
+
+	QueryConstraint Cylinder;
+	Cylinder.CylinderConstraint = CylinderConstraint{ Coordinates{ 10, 0, 0 }, 5.0 };
+	TestTrue("Cylinders are infinitely tall", IsInConstraint(Cylinder, Coordinates{ 13, 1000, 0 }));
+	TestFalse("Entity outside the cylinder radius doesn't match", IsInConstraint(Cylinder, Coordinates{ 16, 0, 0 }));
+
+	QueryConstraint Box;
+	Box.BoxConstraint = BoxConstraint{ Coordinates{ 0, 0, 0 }, EdgeLength{ 10, 10, 20 } };
+	TestTrue("Entity inside the box matches", IsInConstraint(Box, Coordinates{ 5, -5, 9 }));
+	TestFalse("Entity outside the box doesn't match", IsInConstraint(Box, Coordinates{ 6, 0, 0 }));
+
+	return true;
+}
+
+QUERY_CONSTRAINT_EVALUATOR_TEST(GIVEN_relative_constraints_WHEN_evaluated_THEN_they_are_centered_on_the_query_origin)
+{
+	const Coordinates QueryOrigin{ 100, 0, 100 };
+
+	QueryConstraint Sphere;
+	Sphere.RelativeSphereConstraint = RelativeSphereConstraint{ 5.0 };
+	TestTrue("Entity near the origin matches", IsInConstraint(Sphere, Coordinates{ 102, 0, 100 }, QueryOrigin));
+	TestFalse("Entity near the deployment origin doesn't match", IsInConstraint(Sphere, Coordinates{ 2, 0, 0 }, QueryOrigin));
+
+	QueryConstraint Cylinder;
+	Cylinder.RelativeCylinderConstraint = RelativeCylinderConstraint{ 5.0 };
+	TestTrue("Entity above the origin matches", IsInConstraint(Cylinder, Coordinates{ 100, 50, 103 }, QueryOrigin));
+
+	QueryConstraint Box;
+	Box.RelativeBoxConstraint = RelativeBoxConstraint{ EdgeLength{ 10, 10, 10 } };
+	TestTrue("Entity inside the box matches", IsInConstraint(Box, Coordinates{ 104, 4, 96 }, QueryOrigin));
+	TestFalse("Entity outside the box doesn't match", IsInConstraint(Box, Coordinates{ 106, 0, 100 }, QueryOrigin));
+
+	return true;
+}
+
+QUERY_CONSTRAINT_EVALUATOR_TEST(GIVEN_entity_and_component_constraints_WHEN_evaluated_THEN_match_the_entity)
+{
+	QueryConstraint EntityId;
+	EntityId.EntityIdConstraint = TestEntityId;
+	TestTrue("Same entity id matches", IsInConstraint(EntityId, DeploymentOrigin));
+
+	EntityId.EntityIdConstraint = TestEntityId + 1;
+	TestFalse("Other entity id doesn't match", IsInConstraint(EntityId, DeploymentOrigin));
+
+	QueryConstraint Component;
+	Component.ComponentConstraint = TestComponentId;
+	TestTrue("Component on the entity matches", IsInConstraint(Component, DeploymentOrigin));
+
+	Component.ComponentConstraint = OtherComponentId;
+	TestFalse("Component not on the entity doesn't match", IsInConstraint(Component, DeploymentOrigin));
+
+	return true;
+}
+
+QUERY_CONSTRAINT_EVALUATOR_TEST(GIVEN_and_or_constraints_WHEN_evaluated_THEN_combine_their_children)
+{
+	QueryConstraint Radius;
+	Radius.RelativeCylinderConstraint = RelativeCylinderConstraint{ 5.0 };
+
+	QueryConstraint HasComponent;
+	HasComponent.ComponentConstraint = TestComponentId;
+
+	QueryConstraint HasOtherComponent;
+	HasOtherComponent.ComponentConstraint = OtherComponentId;
+
+	QueryConstraint And;
+	And.AndConstraint.Add(Radius);
+	And.AndConstraint.Add(HasComponent);
+	TestTrue("And matches when all children match", IsInConstraint(And, Coordinates{ 1, 0, 1 }));
+	TestFalse("And doesn't match when any child doesn't", IsInConstraint(And, Coordinates{ 10, 0, 0 }));
+
+	QueryConstraint Or;
+	Or.OrConstraint.Add(HasOtherComponent);
+	Or.OrConstraint.Add(And);
+	TestTrue("Or matches when any child matches", IsInConstraint(Or, Coordinates{ 1, 0, 1 }));
+	TestFalse("Or doesn't match when no child matches", IsInConstraint(Or, Coordinates{ 10, 0, 0 }));
+
+	TestFalse("Empty constraint doesn't match", IsInConstraint(QueryConstraint{}, DeploymentOrigin));
+
+	return true;
+}
+
+QUERY_CONSTRAINT_EVALUATOR_TEST(GIVEN_interest_WHEN_evaluated_THEN_only_queries_for_the_given_component_are_used)
+{
+	Query ComponentQuery;
+	ComponentQuery.Constraint.ComponentConstraint = TestComponentId;
+
+	Interest TestInterest;
+	TestInterest.ComponentInterestMap.FindOrAdd(SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID).Queries.Add(ComponentQuery);
+
+	TestTrue("Queries for the component match", QueryConstraintEvaluator::IsEntityInInterest(TestInterest, SpatialConstants::CLIENT_ENDPOINT_COMPONENT_ID,
+		TestEntityId, DeploymentOrigin, HasTestComponent, DeploymentOrigin));
+	TestFalse("Queries for other components are ignored", QueryConstraintEvaluator::IsEntityInInterest(TestInterest, SpatialConstants::POSITION_COMPONENT_ID,
+		TestEntityId, DeploymentOrigin, HasTestComponent, DeploymentOrigin));
+
+	return true;
+}
@@ -0,0 +1,174 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/SpatialDebuggerWorkerRegions.h"
+
+#define SPATIALDEBUGGERWORKERREGIONS_TEST(TestName) \
+	GDK_TEST(Core, SpatialDebuggerWorkerRegions, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+FWorkerRegionInfo CreateWorkerRegionInfo(uint32 VirtualWorkerId, const FBox2D& Extents, int32 AuthoritativeActorCount = INDEX_NONE)
+{
+	FWorkerRegionInfo WorkerRegionInfo;
+	WorkerRegionInfo.Color = FColor::Blue;
+	WorkerRegionInfo.Extents = Extents;
+	WorkerRegionInfo.VirtualWorkerId = VirtualWorkerId;
+	WorkerRegionInfo.AuthoritativeActorCount = AuthoritativeActorCount;
+	return WorkerRegionInfo;
+}
+
+FWorkerRegionMigrationInfo CreateMigrationInfo(uint32 FromVirtualWorkerId, uint32 ToVirtualWorkerId, float MigrationsPerSecond)
+{
+	FWorkerRegionMigrationInfo MigrationInfo;
+	MigrationInfo.FromVirtualWorkerId = FromVirtualWorkerId;
+	MigrationInfo.ToVirtualWorkerId = ToVirtualWorkerId;
+	MigrationInfo.MigrationsPerSecond = MigrationsPerSecond;
+	return MigrationInfo;
+}
+
+const FBox2D LeftRegion(FVector2D(-100.f, -100.f), FVector2D(0.f, 100.f));
+const FBox2D RightRegion(FVector2D(0.f, -100.f), FVector2D(100.f, 100.f));
+
+} // anonymous namespace
+
+SPATIALDEBUGGERWORKERREGIONS_TEST(GIVEN_worker_load_WHEN_applied_to_region_THEN_region_shows_load_and_migrations_start_from_region)
+{
+	// GIVEN
+	FVirtualWorkerLoad Load;
+	Load.AuthoritativeActorCount = 42;
+	Load.AverageFrameTime = 0.02f;
+	Load.MigrationsPerSecond.Add(2, 1.5f);
+	Load.MigrationsPerSecond.Add(3, 0.5f);
+
+	FWorkerRegionInfo WorkerRegionInfo = CreateWorkerRegionInfo(1, LeftRegion);
+	TArray<FWorkerRegionMigrationInfo> Migrations;
+
+	// WHEN
+	SpatialDebuggerWorkerRegions::ApplyWorkerLoad(Load, WorkerRegionInfo, Migrations);
+
+	// THEN
+	TestTrue("The region shows the reported actor count", WorkerRegionInfo.AuthoritativeActorCount == 42);
+	TestEqual("The region shows the reported frame time", WorkerRegionInfo.AverageFrameTime, 0.02f);
+	TestTrue("A migration is added per destination", Migrations.Num() == 2);
+	for (const FWorkerRegionMigrationInfo& Migration : Migrations)
+	{
+		TestTrue("The migration starts from the region's virtual worker", Migration.FromVirtualWorkerId == 1);
+		TestEqual("The migration rate matches the reported rate", Migration.MigrationsPerSecond, Load.MigrationsPerSecond.FindRef(Migration.ToVirtualWorkerId));
+	}
+
+	return true;
+}
+
+SPATIALDEBUGGERWORKERREGIONS_TEST(GIVEN_no_configured_heat_actor_count_WHEN_getting_heat_actor_count_THEN_busiest_region_count_is_returned)
+{
+	// GIVEN
+	const TArray<FWorkerRegionInfo> WorkerRegions = {
+		CreateWorkerRegionInfo(1, LeftRegion, 10),
+		CreateWorkerRegionInfo(2, RightRegion, 30),
+		CreateWorkerRegionInfo(3, RightRegion)
+	};
+
+	// WHEN
+	const int32 HeatActorCount = SpatialDebuggerWorkerRegions::GetHeatActorCount(WorkerRegions, 0);
+	const int32 ConfiguredHeatActorCount = SpatialDebuggerWorkerRegions::GetHeatActorCount(WorkerRegions, 100);
+
+	// THEN
+	TestTrue("Without a configured count the busiest region is hot", HeatActorCount == 30);
+	TestTrue("A configured count is used as is", ConfiguredHeatActorCount == 100);
+
+	return true;
+}
+
+SPATIALDEBUGGERWORKERREGIONS_TEST(GIVEN_region_loads_WHEN_getting_region_color_THEN_heat_color_is_only_used_for_shown_and_reported_loads)
+{
+	// GIVEN
+	const FWorkerRegionInfo IdleRegion = CreateWorkerRegionInfo(1, LeftRegion, 0);
+	const FWorkerRegionInfo HotRegion = CreateWorkerRegionInfo(2, RightRegion, 200);
+	const FWorkerRegionInfo UnreportedRegion = CreateWorkerRegionInfo(3, RightRegion);
+	const int32 HeatActorCount = 100;
+
+	// WHEN
+	const FColor IdleColor = SpatialDebuggerWorkerRegions::GetRegionColor(IdleRegion, HeatActorCount, true);
+	const FColor HotColor = SpatialDebuggerWorkerRegions::GetRegionColor(HotRegion, HeatActorCount, true);
+	const FColor UnreportedColor = SpatialDebuggerWorkerRegions::GetRegionColor(UnreportedRegion, HeatActorCount, true);
+	const FColor HiddenLoadColor = SpatialDebuggerWorkerRegions::GetRegionColor(HotRegion, HeatActorCount, false);
+	const FColor NoHeatColor = SpatialDebuggerWorkerRegions::GetRegionColor(HotRegion, 0, true);
+
+	// THEN
+	TestTrue("An idle region is green", IdleColor == FLinearColor::Green.ToFColor(true));
+	TestTrue("A region over the heat actor count is red", HotColor == FLinearColor::Red.ToFColor(true));
+	TestTrue("A region without a reported load keeps its own colour", UnreportedColor == UnreportedRegion.Color);
+	TestTrue("A region keeps its own colour when loads are not shown", HiddenLoadColor == HotRegion.Color);
+	TestTrue("A region keeps its own colour without a heat actor count", NoHeatColor == HotRegion.Color);
+
+	return true;
+}
+
+SPATIALDEBUGGERWORKERREGIONS_TEST(GIVEN_region_and_migration_WHEN_getting_labels_THEN_labels_show_load_and_rate)
+{
+	// GIVEN
+	FWorkerRegionInfo ReportedRegion = CreateWorkerRegionInfo(1, LeftRegion, 42);
+	ReportedRegion.AverageFrameTime = 0.015f;
+	const FWorkerRegionInfo UnreportedRegion = CreateWorkerRegionInfo(2, RightRegion);
+	const FWorkerRegionMigrationInfo MigrationInfo = CreateMigrationInfo(1, 2, 2.4f);
+
+	// WHEN
+	const FString ReportedLabel = SpatialDebuggerWorkerRegions::GetRegionLabel(ReportedRegion);
+	const FString UnreportedLabel = SpatialDebuggerWorkerRegions::GetRegionLabel(UnreportedRegion);
+	const FString MigrationLabel = SpatialDebuggerWorkerRegions::GetMigrationLabel(MigrationInfo);
+
+	// THEN
+	TestEqual("The reported region label shows actors and frame time", ReportedLabel, TEXT("1: 42 actors, 15.0 ms"));
+	TestEqual("The unreported region label says no load is reported", UnreportedLabel, TEXT("2: no load reported"));
+	TestEqual("The migration label shows the direction and rate", MigrationLabel, TEXT("1 > 2: 2.4/s"));
+
+	return true;
+}
+
+SPATIALDEBUGGERWORKERREGIONS_TEST(GIVEN_touching_regions_WHEN_getting_shared_edge_center_THEN_center_of_shared_edge_is_returned)
+{
+	// GIVEN
+	const FBox2D FarRegion(FVector2D(200.f, -100.f), FVector2D(300.f, 100.f));
+
+	// WHEN
+	const FVector2D TouchingCenter = SpatialDebuggerWorkerRegions::GetSharedEdgeCenter(LeftRegion, RightRegion);
+	const FVector2D SeparateCenter = SpatialDebuggerWorkerRegions::GetSharedEdgeCenter(LeftRegion, FarRegion);
+
+	// THEN
+	TestTrue("Touching regions use the centre of their shared edge", TouchingCenter.Equals(FVector2D(0.f, 0.f)));
+	TestTrue("Separate regions use the midpoint between their centres", SeparateCenter.Equals(FVector2D(100.f, 0.f)));
+
+	return true;
+}
+
+SPATIALDEBUGGERWORKERREGIONS_TEST(GIVEN_migrations_between_regions_WHEN_getting_label_location_THEN_label_is_nudged_towards_destination)
+{
+	// GIVEN
+	const TArray<FWorkerRegionInfo> WorkerRegions = {
+		CreateWorkerRegionInfo(1, LeftRegion),
+		CreateWorkerRegionInfo(2, RightRegion)
+	};
+	const float Offset = 10.f;
+
+	// WHEN
+	FVector2D LeftToRightLocation;
+	FVector2D RightToLeftLocation;
+	FVector2D UnknownLocation;
+	const bool bFoundLeftToRight = SpatialDebuggerWorkerRegions::GetMigrationLabelLocation(WorkerRegions, CreateMigrationInfo(1, 2, 1.f), Offset, LeftToRightLocation);
+	const bool bFoundRightToLeft = SpatialDebuggerWorkerRegions::GetMigrationLabelLocation(WorkerRegions, CreateMigrationInfo(2, 1, 1.f), Offset, RightToLeftLocation);
+	const bool bFoundUnknown = SpatialDebuggerWorkerRegions::GetMigrationLabelLocation(WorkerRegions, CreateMigrationInfo(1, 3, 1.f), Offset, UnknownLocation);
+
+	// THEN
+	TestTrue("The left to right label location is found", bFoundLeftToRight);
+	TestTrue("The right to left label location is found", bFoundRightToLeft);
+	TestTrue("The left to right label is nudged right", LeftToRightLocation.Equals(FVector2D(Offset, 0.f)));
+	TestTrue("The right to left label is nudged left", RightToLeftLocation.Equals(FVector2D(-Offset, 0.f)));
+	TestFalse("No location is found for a migration to an unknown region", bFoundUnknown);
+
+	return true;
+}